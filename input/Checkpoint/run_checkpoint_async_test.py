@@ -0,0 +1,107 @@
+#!/bin/python
+
+# Running run_checkpoint_async_test.py does the following:
+
+# - Runs Enzo-E with checkpoint_async-balance.in, which writes
+#   asynchronous checkpoints every 5 cycles while load balancing, and
+#   writes every field at cycle 20
+# - Checks that every checkpoint file written can be opened, i.e. that
+#   none was left truncated or unclosed when the run exited
+# - Restarts from the cycle 10 checkpoint with checkpoint_async-restart.in
+#   and checks that the fields it writes at cycle 20 are bitwise equal to
+#   those of the first run
+# - Deletes the checkpoint directories and data outputs
+
+# run_checkpoint_async_test.py takes the argument "--launch_cmd", the
+# command used to run Enzo-E, e.g. /path/to/bin/enzo-e or
+# "/path/to/bin/charmrun +p 4 ++local /path/to/bin/enzo-e"
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+
+import h5py
+import numpy as np
+
+def output_files(run):
+    return glob.glob("checkpoint_async-%s-*.h5" % run)
+
+def checkpoint_dirs(run):
+    return [d for d in glob.glob("checkpoint_async-%s-*" % run)
+            if os.path.isdir(d)]
+
+def read_datasets(run):
+    """Returns {path: values} for every dataset written by run"""
+    datasets = {}
+    for file_name in output_files(run):
+        with h5py.File(file_name, 'r') as f:
+            def visit(name, obj):
+                if isinstance(obj, h5py.Dataset):
+                    datasets[name] = obj[()]
+            f.visititems(visit)
+    return datasets
+
+def check_checkpoints(run):
+    dirs = checkpoint_dirs(run)
+    if len(dirs) == 0:
+        print("no checkpoints found")
+        return False
+    passed = True
+    for d in sorted(dirs):
+        for file_name in glob.glob(os.path.join(d, "*.h5")):
+            try:
+                with h5py.File(file_name, 'r') as f:
+                    f.visititems(lambda name, obj: None)
+            except (IOError, OSError) as err:
+                print("can't read checkpoint file %s: %s" % (file_name, err))
+                passed = False
+    return passed
+
+def compare(datasets, datasets_restart):
+    if len(datasets) == 0:
+        print("no datasets found")
+        return False
+    if set(datasets.keys()) != set(datasets_restart.keys()):
+        print("runs wrote different datasets")
+        return False
+    passed = True
+    for key in sorted(datasets.keys()):
+        a, b = datasets[key], datasets_restart[key]
+        if a.shape != b.shape or not np.array_equal(a, b):
+            print("dataset %s differs after restart" % key)
+            passed = False
+    return passed
+
+def cleanup():
+    for run in ["balance", "restart"]:
+        for file_name in output_files(run):
+            os.remove(file_name)
+        for d in checkpoint_dirs(run):
+            shutil.rmtree(d)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True, type=str)
+    args = parser.parse_args()
+
+    input_dir = os.path.dirname(os.path.abspath(__file__))
+
+    cleanup()
+
+    for run in ["balance", "restart"]:
+        param_file = os.path.join(input_dir,
+                                  'checkpoint_async-%s.in' % run)
+        subprocess.call(args.launch_cmd + ' ' + param_file, shell = True)
+        if run == "balance":
+            passed = check_checkpoints(run)
+
+    passed = compare(read_datasets("balance"),
+                     read_datasets("restart")) and passed
+    print("PASSED" if passed else "FAILED")
+
+    cleanup()
+
+    sys.exit(0 if passed else 3)
@@ -0,0 +1,103 @@
+#!/bin/python
+
+# Running run_fof_test.py does the following:
+
+# - Writes the initial conditions file particles.dat with three halos of
+#   known size (see make_ics below), a group too small to be a halo, and
+#   isolated particles
+# - Runs Enzo-E twice with fof_test.in, to check that rerunning a cycle
+#   overwrites the halo catalog rather than appending to it
+# - Reads the halo catalogs halos-*.txt and checks the number of halos,
+#   their ids (the smallest particle id in each halo), and their
+#   particle counts
+# - Deletes particles.dat and the halo catalogs
+
+# run_fof_test.py takes the argument "--launch_cmd", the command used to
+# run Enzo-E, e.g. /path/to/bin/enzo-e or
+# "/path/to/bin/charmrun +p 4 ++local /path/to/bin/enzo-e"
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+
+def lattice(n, centre, spacing = 0.02):
+    """Positions of an n^3 lattice of particles centred on centre"""
+    offset = [spacing*(i - 0.5*(n-1)) for i in range(n)]
+    return [(centre[0]+dx, centre[1]+dy, centre[2]+dz)
+            for dx in offset for dy in offset for dz in offset]
+
+def make_ics(filename = "particles.dat"):
+    """Writes the particles and returns the expected {halo id: count}.
+    Particle ids are assigned in file order starting from 1"""
+
+    groups = [
+        # straddles the Block boundary at x = 0
+        lattice(4, [0.0, 0.0, 0.0]),
+        # straddles the periodic boundary at x = +/- 2 (wrapped below)
+        lattice(4, [2.0, 1.0, -1.0]),
+        # inside the Block at x > 0
+        lattice(3, [1.0, 1.0, 1.0]),
+        # fewer than min_group_size particles
+        lattice(2, [-1.0, -1.0, -1.0]),
+        # isolated particles
+        [(-1.5, 0.5, 0.5), (0.5, -1.5, 0.5), (1.5, 0.5, -1.5)] ]
+
+    expected = {}
+    first_id = 1
+    for k,group in enumerate(groups):
+        if k < 3:
+            expected[first_id] = len(group)
+        first_id += len(group)
+
+    pos = [p for group in groups for p in group]
+    n = len(pos)
+    with open(filename, "w") as f:
+        for (x,y,z) in pos:
+            if x >= 2.0: x -= 4.0
+            # mass, position, velocity
+            f.write("%.17g %.17g %.17g %.17g 0 0 0\n" % (1.0/n, x, y, z))
+    return expected
+
+def read_catalog():
+    halos = {}
+    for file_name in glob.glob("halos-*.txt"):
+        for line in open(file_name):
+            words = line.split()
+            halo_id, count = int(words[0]), int(words[1])
+            if halo_id in halos:
+                print("halo %d written more than once" % halo_id)
+                return None
+            halos[halo_id] = count
+    return halos
+
+def cleanup():
+    for file_name in glob.glob("halos-*.txt") + ["particles.dat"]:
+        if os.path.isfile(file_name):
+            os.remove(file_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True, type=str)
+    args = parser.parse_args()
+
+    param_file = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                              'fof_test.in')
+
+    cleanup()
+    expected = make_ics()
+
+    # the second run rewrites the cycle 0 catalog
+    for run in range(2):
+        subprocess.call(args.launch_cmd + ' ' + param_file, shell = True)
+
+    halos = read_catalog()
+    passed = (halos == expected)
+    print("expected halos %s" % expected)
+    print("found halos    %s" % halos)
+    print("PASSED" if passed else "FAILED")
+
+    cleanup()
+
+    sys.exit(0 if passed else 3)
@@ -0,0 +1,90 @@
+#!/bin/python
+
+# runs the 2D gravity test with the "bicgstab" and "bicgstab_fused"
+# solvers and compares their convergence
+# - This script expects to be called from the root level of the repository
+#   OR at the same level where its defined
+#
+# Both solvers test convergence on the same relative residual, so each
+# solve must converge below res_tol, and the pipelined solver should
+# need about the same number of iterations as the reference solver
+
+import argparse
+import os.path
+import re
+import subprocess
+import sys
+
+_LOCAL_DIR = os.path.dirname(os.path.realpath(__file__))
+_VLCT_DIR = os.path.join(_LOCAL_DIR, "../vlct")
+if os.path.isdir(_VLCT_DIR):
+    sys.path.insert(0, _VLCT_DIR)
+    from testing_utils import testing_context
+else:
+    raise RuntimeError(f"expected VL+CT tests to be defined in {_VLCT_DIR}, "
+                       "but that that directory does not exist")
+
+RES_TOL = 1e-6
+
+# allowed growth in iteration count from rounding in the recurrences
+ITER_RATIO = 1.25
+ITER_SLACK = 2
+
+_MONITOR = re.compile(r"Solver bcg\s+(?:final)?\s*iter (\d+)\s+err (\S+)")
+
+def run_solves(executable, input_file):
+    """Run enzo-e and return the (iterations, error) of each solve"""
+    command = executable + ' ' + input_file
+    output = subprocess.run(command, shell=True, stdout=subprocess.PIPE,
+                            universal_newlines=True).stdout
+    solves = []
+    for line in output.splitlines():
+        match = _MONITOR.search(line)
+        if match is None:
+            continue
+        n_iter, err = int(match.group(1)), float(match.group(2))
+        if n_iter == 0:
+            solves.append((n_iter, err))
+        elif len(solves) > 0:
+            solves[-1] = (n_iter, err)
+    return solves
+
+def analyze(solves_ref, solves_fused):
+    if len(solves_ref) == 0:
+        print("FAILED: no solves found for bicgstab")
+        return False
+    if len(solves_ref) != len(solves_fused):
+        print("FAILED: {:d} bicgstab solves but {:d} bicgstab_fused solves"
+              .format(len(solves_ref), len(solves_fused)))
+        return False
+
+    success = True
+    for i, ((iter_ref, err_ref), (iter_fused, err_fused)) in \
+            enumerate(zip(solves_ref, solves_fused)):
+        converged = (err_fused < RES_TOL)
+        comparable = (iter_fused <= ITER_RATIO*iter_ref + ITER_SLACK)
+        if not (converged and comparable):
+            success = False
+        print("{} solve {:d}: bicgstab iter {:d} err {:g}  "
+              "bicgstab_fused iter {:d} err {:g}".format(
+                  "Passed" if (converged and comparable) else "FAILED",
+                  i, iter_ref, err_ref, iter_fused, err_fused))
+    return success
+
+if __name__ == '__main__':
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True,type=str)
+    args = parser.parse_args()
+
+    with testing_context():
+        solves_ref = run_solves(args.launch_cmd,
+                                'input/Gravity/method_gravity_bcg-1.in')
+        solves_fused = run_solves(args.launch_cmd,
+                                  'input/Gravity/method_gravity_bcg_fused-1.in')
+        tests_passed = analyze(solves_ref, solves_fused)
+
+    if tests_passed:
+        sys.exit(0)
+    else:
+        sys.exit(3)
@@ -0,0 +1,79 @@
+#!/bin/python
+
+# Running run_refresh_aggregate_test.py does the following:
+
+# - Runs Enzo-E with refresh_aggregate-off.in and refresh_aggregate-on.in,
+#   which differ only in Refresh:aggregate
+# - Reads every field of every Block, including ghost zones, from the
+#   data outputs of both runs and checks that they are bitwise equal
+# - Deletes the data outputs
+
+# run_refresh_aggregate_test.py takes the argument "--launch_cmd", the
+# command used to run Enzo-E, e.g. /path/to/bin/enzo-e or
+# "/path/to/bin/charmrun +p 4 ++local /path/to/bin/enzo-e".  Aggregation
+# only affects messages between processes, so the test should be run
+# with more than one process
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+
+import h5py
+import numpy as np
+
+def output_files(run):
+    return glob.glob("refresh_aggregate-%s-*.h5" % run)
+
+def read_datasets(run):
+    """Returns {(cycle, path): values} for every dataset written by run"""
+    datasets = {}
+    for file_name in output_files(run):
+        cycle = file_name.split('-')[-1]
+        with h5py.File(file_name, 'r') as f:
+            def visit(name, obj):
+                if isinstance(obj, h5py.Dataset):
+                    datasets[(cycle, name)] = obj[()]
+            f.visititems(visit)
+    return datasets
+
+def compare(datasets_off, datasets_on):
+    if len(datasets_off) == 0:
+        print("no datasets found")
+        return False
+    if set(datasets_off.keys()) != set(datasets_on.keys()):
+        print("runs wrote different datasets")
+        return False
+    passed = True
+    for key in sorted(datasets_off.keys()):
+        a, b = datasets_off[key], datasets_on[key]
+        if a.shape != b.shape or not np.array_equal(a, b):
+            print("cycle %s dataset %s differs" % (key[0][:-3], key[1]))
+            passed = False
+    return passed
+
+def cleanup():
+    for file_name in output_files("off") + output_files("on"):
+        os.remove(file_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True, type=str)
+    args = parser.parse_args()
+
+    input_dir = os.path.dirname(os.path.abspath(__file__))
+
+    cleanup()
+
+    for run in ["off", "on"]:
+        param_file = os.path.join(input_dir,
+                                  'refresh_aggregate-%s.in' % run)
+        subprocess.call(args.launch_cmd + ' ' + param_file, shell = True)
+
+    passed = compare(read_datasets("off"), read_datasets("on"))
+    print("PASSED" if passed else "FAILED")
+
+    cleanup()
+
+    sys.exit(0 if passed else 3)
@@ -0,0 +1,137 @@
+#!/bin/python
+
+# Running run_starss_deposits_test.py does the following:
+
+# - Runs Enzo-E with starss_deposits-interior.in, where a single STARSS
+#   supernova deposits only into the Block containing the star, and with
+#   starss_deposits-boundary.in, where the deposits also go to
+#   neighboring Blocks across a level jump and a periodic domain boundary
+# - Checks that the boundary run changed the density in a refined Block
+#   and in a Block on the far side of the periodic boundary
+# - Checks that the gas mass gained in the boundary run equals the gas
+#   mass gained in the interior run, i.e. that no deposits were lost or
+#   counted twice when sent to neighbors
+# - Deletes the data outputs
+
+# run_starss_deposits_test.py takes the argument "--launch_cmd", the
+# command used to run Enzo-E, e.g. /path/to/bin/enzo-e or
+# "/path/to/bin/charmrun +p 4 ++local /path/to/bin/enzo-e"
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+
+import h5py
+import numpy as np
+
+# active cells along each axis of every Block
+block_size = 16
+
+def output_files(run, cycle):
+    return glob.glob("starss_deposits-%s-*-%06d.h5" % (run, cycle))
+
+def read_blocks(run, cycle):
+    """Returns {name: (lower, upper, active density)} for every Block"""
+    blocks = {}
+    for file_name in output_files(run, cycle):
+        with h5py.File(file_name, 'r') as f:
+            for name, group in f.items():
+                if not (isinstance(group, h5py.Group) and
+                        'field_density' in group):
+                    continue
+                d = group['field_density'][()]
+                g = [(m - block_size) // 2 for m in d.shape]
+                d = d[g[0]:d.shape[0]-g[0],
+                      g[1]:d.shape[1]-g[1],
+                      g[2]:d.shape[2]-g[2]]
+                blocks[name] = (np.array(group.attrs['lower']),
+                                np.array(group.attrs['upper']), d)
+    return blocks
+
+def leaves(blocks):
+    """Returns the names of Blocks that contain no smaller Block"""
+    result = []
+    for name, (lower, upper, d) in blocks.items():
+        width = upper - lower
+        is_leaf = True
+        for lower_c, upper_c, d_c in blocks.values():
+            if (np.all(upper_c - lower_c < width) and
+                np.all(lower <= lower_c) and np.all(upper_c <= upper)):
+                is_leaf = False
+                break
+        if is_leaf:
+            result.append(name)
+    return result
+
+def gas_mass(blocks, names):
+    mass = 0.0
+    for name in names:
+        lower, upper, d = blocks[name]
+        volume = np.prod((upper - lower) / block_size)
+        mass += volume * np.sum(d, dtype=np.float64)
+    return mass
+
+def mass_gained(run):
+    blocks_0 = read_blocks(run, 0)
+    blocks_1 = read_blocks(run, 1)
+    names = leaves(blocks_0)
+    if len(names) == 0 or set(names) != set(leaves(blocks_1)):
+        print("%s: missing or inconsistent Blocks" % run)
+        return None, None
+    changed = [name for name in names
+               if not np.array_equal(blocks_0[name][2], blocks_1[name][2])]
+    return gas_mass(blocks_1, names) - gas_mass(blocks_0, names), \
+        [blocks_1[name] for name in changed]
+
+def cleanup():
+    for file_name in glob.glob("starss_deposits-*.h5"):
+        os.remove(file_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True, type=str)
+    args = parser.parse_args()
+
+    input_dir = os.path.dirname(os.path.abspath(__file__))
+
+    cleanup()
+
+    for run in ["interior", "boundary"]:
+        param_file = os.path.join(input_dir,
+                                  'starss_deposits-%s.in' % run)
+        subprocess.call(args.launch_cmd + ' ' + param_file, shell = True)
+
+    dm_interior, changed_interior = mass_gained("interior")
+    dm_boundary, changed_boundary = mass_gained("boundary")
+
+    passed = (dm_interior is not None) and (dm_boundary is not None)
+
+    if passed:
+        # the boundary star is in a coarse Block at x,z < 0.5 and y > 0.5
+        refined = [b for b in changed_boundary
+                   if np.all(b[1] - b[0] < 0.5)]
+        wrapped = [b for b in changed_boundary
+                   if b[0][0] >= 0.5 or b[0][2] >= 0.5]
+        if len(changed_interior) != 1:
+            print("interior deposits changed %d Blocks" %
+                  len(changed_interior))
+            passed = False
+        if len(refined) == 0:
+            print("no deposits across the level jump")
+            passed = False
+        if len(wrapped) == 0:
+            print("no deposits across the periodic boundary")
+            passed = False
+        if not (dm_interior > 0.0 and
+                abs(dm_boundary - dm_interior) <= 1e-6 * dm_interior):
+            print("gas mass gained %g in interior run but %g in boundary run"
+                  % (dm_interior, dm_boundary))
+            passed = False
+
+    print("PASSED" if passed else "FAILED")
+
+    cleanup()
+
+    sys.exit(0 if passed else 3)
@@ -0,0 +1,84 @@
+#!/bin/python
+
+# Running run_vlct_tile_test.py does the following:
+
+# - Runs Enzo-E with the hydro and MHD inputs vlct_tile-{hd,mhd}-{0,5}.in,
+#   which differ only in Method:mhd_vlct:tile_size
+# - Reads every field of every Block from the data outputs and checks
+#   that the tiled and untiled runs of each problem are bitwise equal
+# - Deletes the data outputs
+
+# run_vlct_tile_test.py takes the argument "--launch_cmd", the command
+# used to run Enzo-E, e.g. /path/to/bin/enzo-e
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+
+import h5py
+import numpy as np
+
+PROBLEMS = ["hd", "mhd"]
+TILE_SIZES = [0, 5]
+
+def output_files(problem, tile_size):
+    return glob.glob("vlct_tile-%s-%d-*.h5" % (problem, tile_size))
+
+def read_datasets(problem, tile_size):
+    """Returns {path: values} for every dataset written by a run"""
+    datasets = {}
+    for file_name in output_files(problem, tile_size):
+        with h5py.File(file_name, 'r') as f:
+            def visit(name, obj):
+                if isinstance(obj, h5py.Dataset):
+                    datasets[name] = obj[()]
+            f.visititems(visit)
+    return datasets
+
+def compare(problem, datasets_ref, datasets_tiled):
+    if len(datasets_ref) == 0:
+        print("%s: no datasets found" % problem)
+        return False
+    if set(datasets_ref.keys()) != set(datasets_tiled.keys()):
+        print("%s: runs wrote different datasets" % problem)
+        return False
+    passed = True
+    for key in sorted(datasets_ref.keys()):
+        a, b = datasets_ref[key], datasets_tiled[key]
+        if a.shape != b.shape or not np.array_equal(a, b):
+            print("%s: dataset %s differs" % (problem, key))
+            passed = False
+    return passed
+
+def cleanup():
+    for problem in PROBLEMS:
+        for tile_size in TILE_SIZES:
+            for file_name in output_files(problem, tile_size):
+                os.remove(file_name)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--launch_cmd', required=True, type=str)
+    args = parser.parse_args()
+
+    input_dir = os.path.dirname(os.path.abspath(__file__))
+
+    cleanup()
+
+    passed = True
+    for problem in PROBLEMS:
+        for tile_size in TILE_SIZES:
+            param_file = os.path.join(input_dir, 'vlct_tile-%s-%d.in' %
+                                      (problem, tile_size))
+            subprocess.call(args.launch_cmd + ' ' + param_file, shell = True)
+        passed = compare(problem,
+                         read_datasets(problem, TILE_SIZES[0]),
+                         read_datasets(problem, TILE_SIZES[1])) and passed
+
+    print("PASSED" if passed else "FAILED")
+
+    cleanup()
+
+    sys.exit(0 if passed else 3)
@@ -16,12 +16,16 @@
 
 #include <stack>
 #include <memory>
+#include <map>
+#include <vector>
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Component class includes
 //----------------------------------------------------------------------
 
 #include "memory_Memory.hpp"
+#include "memory_MemoryPool.hpp"
 
 #endif /* _MEMORY_HPP */
 
@@ -37,6 +37,7 @@ extern const char * parameter_type_name [];
 #include <string>
 #include <vector>
 #include <limits>
+#include <algorithm>
 
 //----------------------------------------------------------------------
 // Component class includes
@@ -44,6 +45,7 @@ extern const char * parameter_type_name [];
 
 #include "parse.h"
 #include "parameters_Config.hpp"
+#include "parameters_ParamExpr.hpp"
 #include "parameters_Param.hpp"
 #include "parameters_ParamNode.hpp"
 #include "parameters_Parameters.hpp"
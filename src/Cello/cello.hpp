@@ -28,6 +28,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <cstdint>
 #include <cstdlib>
 #include <map>
 #include <memory>
@@ -44,6 +45,7 @@
 
 #include "cello_defines.hpp"
 #include "cello_Sync.hpp"
+#include "cello_Philox.hpp"
 
 // #define DEBUG_CHECK
 
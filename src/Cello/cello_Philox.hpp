@@ -0,0 +1,86 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     cello_Philox.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Cello] Declaration of the Philox class
+///
+/// Counter-based random number generator Philox4x32-10 of Salmon et
+/// al. (2011), "Parallel Random Numbers: As Easy as 1, 2, 3".  Random
+/// numbers are a pure function of a key and a counter, so no state is
+/// shared between Blocks or threads, and draws are independent of the
+/// order in which Blocks are computed or where they are located.
+
+#ifndef CELLO_PHILOX_HPP
+#define CELLO_PHILOX_HPP
+
+class Philox {
+
+  /// @class    Philox
+  /// @ingroup  Cello
+  /// @brief    [\ref Cello] Counter-based random numbers for a Block
+  ///
+  /// The key holds the stream id and the cycle, and the counter holds
+  /// the raw bits of the Block's Index and a caller-chosen value
+  /// such as a cell index, so every (Block, cycle, cell, stream)
+  /// has its own random numbers.
+
+public: // interface
+
+  /// Create a generator for the given stream id, cycle, and Block
+  /// Index values (see Index::values())
+  Philox (int stream, int cycle, const int index3[3]) throw()
+    : key_{uint32_t(stream), uint32_t(cycle)},
+      index_{uint32_t(index3[0]), uint32_t(index3[1]), uint32_t(index3[2])}
+  { }
+
+  /// Return a random number uniformly distributed in [0,1) for
+  /// counter value i
+  double uniform (uint32_t i) const throw()
+  {
+    uint32_t r4[4];
+    generate (i, r4);
+    // 53 random bits from the first two words
+    const uint64_t bits = (uint64_t(r4[0]) << 21) ^ (r4[1] >> 11);
+    return bits * (1.0 / 9007199254740992.0);
+  }
+
+  /// Return four random 32-bit integers for counter value i
+  void generate (uint32_t i, uint32_t r4[4]) const throw()
+  {
+    const uint32_t c4[4] = { i, index_[0], index_[1], index_[2] };
+    philox4x32_10 (c4, key_, r4);
+  }
+
+  /// The Philox4x32-10 bijection from counter c4 and key k2 to r4
+  static void philox4x32_10
+  (const uint32_t c4[4], const uint32_t k2[2], uint32_t r4[4]) throw()
+  {
+    uint32_t c0 = c4[0], c1 = c4[1], c2 = c4[2], c3 = c4[3];
+    uint32_t k0 = k2[0], k1 = k2[1];
+    for (int round = 0; round < 10; round++) {
+      const uint64_t p0 = uint64_t(0xD2511F53u) * c0;
+      const uint64_t p1 = uint64_t(0xCD9E8D57u) * c2;
+      c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+      c1 = uint32_t(p1);
+      c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+      c3 = uint32_t(p0);
+      k0 += 0x9E3779B9u;
+      k1 += 0xBB67AE85u;
+    }
+    r4[0] = c0;
+    r4[1] = c1;
+    r4[2] = c2;
+    r4[3] = c3;
+  }
+
+private: // attributes
+
+  /// Stream id and cycle
+  uint32_t key_[2];
+
+  /// Raw bits of the Block's Index
+  uint32_t index_[3];
+
+};
+
+#endif /* CELLO_PHILOX_HPP */
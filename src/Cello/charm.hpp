@@ -23,4 +23,5 @@
 #include "charm_MsgOutput.hpp"
 #include "charm_MsgRefine.hpp"
 #include "charm_MsgRefresh.hpp"
+#include "charm_MsgRefreshAggregate.hpp"
 #include "charm_MsgState.hpp"
@@ -6,15 +6,21 @@
 /// @brief    Mapping of Charm++ array Index to processors
 
 #include "charm.hpp"
+#include "problem.hpp"
 
 //======================================================================
 
-MappingArray::MappingArray(int nx, int ny, int nz)
-  :  CkArrayMap()
+MappingArray::MappingArray(int nx, int ny, int nz, int mapping)
+  :  CkArrayMap(),
+     mapping_(mapping),
+     process_()
 {
   nx_ = nx;
   ny_ = ny;
   nz_ = nz;
+  if (mapping_ != mapping_linear) {
+    process_ = root_process(nx_,ny_,nz_,mapping_);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -33,8 +39,107 @@ int MappingArray::procNum(int, const CkArrayIndex &idx) {
   int ix,iy,iz;
   in.array    (&ix,&iy,&iz);
 
-  int index = ((long long) CkNumPes())*(ix + nx_*(iy + ny_*iz)) / (nx_*ny_*nz_);
-  
+  const int i = ix + nx_*(iy + ny_*iz);
+
+  int index = process_.empty() ?
+    ((long long) CkNumPes())*i / (nx_*ny_*nz_) : process_[i];
+
   return index;
 }
 
+//----------------------------------------------------------------------
+
+int MappingArray::mapping_type (std::string mapping)
+{
+  if (mapping == "linear")  return mapping_linear;
+  if (mapping == "morton")  return mapping_morton;
+  if (mapping == "hilbert") return mapping_hilbert;
+  return -1;
+}
+
+//----------------------------------------------------------------------
+
+std::vector<int> MappingArray::root_process
+(int nx, int ny, int nz, int mapping)
+{
+  const int n = nx*ny*nz;
+  const long long np = CkNumPes();
+
+  // position of each root block along the ordering
+
+  std::vector<int> position(n);
+
+  if (mapping == mapping_linear) {
+
+    for (int i=0; i<n; i++) position[i] = i;
+
+  } else {
+
+    ASSERT1 ("MappingArray::root_process()",
+             "Unknown mapping type %d",
+             mapping,
+             (mapping == mapping_morton || mapping == mapping_hilbert));
+
+    // curve over the smallest power-of-two cube containing the array
+
+    int bits = 0;
+    while ((1 << bits) < std::max(nx,std::max(ny,nz))) ++bits;
+
+    std::vector<long long> key(n);
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        for (int ix=0; ix<nx; ix++) {
+          key[ix+nx*(iy+ny*iz)] =
+            curve_key_(ix,iy,iz,nx,ny,nz,bits,mapping);
+        }
+      }
+    }
+    std::vector<int> order(n);
+    for (int i=0; i<n; i++) order[i] = i;
+    std::sort(order.begin(),order.end(),
+              [&key](int a, int b) { return key[a] < key[b]; });
+    for (int k=0; k<n; k++) position[order[k]] = k;
+  }
+
+  // split the ordering into contiguous segments, one per process.
+  // Since Charm++ numbers the processes within an SMP node
+  // consecutively, each node also receives a contiguous segment
+
+  std::vector<int> process(n);
+  for (int i=0; i<n; i++) {
+    process[i] = np*position[i] / n;
+  }
+  return process;
+}
+
+//======================================================================
+
+long long MappingArray::curve_key_
+(int ix, int iy, int iz, int nx, int ny, int nz, int bits, int mapping)
+{
+  // only axes with more than one root block contribute to the curve,
+  // so that e.g. a 3D problem with one root block along z is ordered
+  // with the 2D curve
+
+  int ia3[3];
+  int rank = 0;
+  if (nx > 1) ia3[rank++] = ix;
+  if (ny > 1) ia3[rank++] = iy;
+  if (nz > 1) ia3[rank++] = iz;
+
+  long long key = 0;
+  int state = 0;
+  for (int i=bits-1; i>=0; i--) {
+    int coord = 0;
+    for (int axis=0; axis<rank; axis++) {
+      coord |= ((ia3[axis] >> i) & 1) << axis;
+    }
+    if (mapping == mapping_hilbert) {
+      const int ind = MethodOrderHilbert::coord_to_hilbert_ind(rank,state,coord);
+      state = MethodOrderHilbert::coord_to_next_state(rank,state,coord);
+      coord = ind;
+    }
+    key = (key << rank) | coord;
+  }
+  return key;
+}
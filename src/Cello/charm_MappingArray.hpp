@@ -18,20 +18,41 @@ class MappingArray: public CkArrayMap {
   /// @brief    [\ref Parallel] Class for mapping Blocks to processors
   ///
   /// This class defines how to map a 3D array of Charm++ chares to
-  /// processes
+  /// processes.  Root blocks are ordered either by their row-major
+  /// position in the array, or along a Morton or Hilbert curve, and
+  /// the ordering is split into CkNumPes() contiguous segments.
+  /// Refined blocks map to the same process as their root block.
 
 public:
 
-  MappingArray(int nx, int ny, int nz);
+  /// Orderings of root blocks
+  enum mapping_enum {
+    mapping_linear,
+    mapping_morton,
+    mapping_hilbert
+  };
+
+  MappingArray(int nx, int ny, int nz, int mapping = mapping_linear);
 
   int procNum(int, const CkArrayIndex &idx);
 
   /// CHARM++ migration constructor for PUP::able
   MappingArray (CkMigrateMessage *m)
     : CkArrayMap(m),
-      nx_(0),ny_(0),nz_(0)
+      nx_(0),ny_(0),nz_(0),
+      mapping_(mapping_linear),
+      process_()
   { }
 
+  /// Return the mapping_enum value of the given Mesh:root_mapping
+  /// parameter value, or -1 if unknown
+  static int mapping_type (std::string mapping);
+
+  /// Return the process of each root block in an nx x ny x nz array,
+  /// indexed by ix + nx*(iy + ny*iz)
+  static std::vector<int> root_process
+  (int nx, int ny, int nz, int mapping);
+
   /// CHARM++ Pack / Unpack function
   inline void pup (PUP::er &p)
   {
@@ -41,12 +62,27 @@ public:
     p | nx_;
     p | ny_;
     p | nz_;
+    p | mapping_;
+    p | process_;
   }
 
+private:
+
+  /// Return the key of root block (ix,iy,iz) along the given curve,
+  /// using bits bits per axis
+  static long long curve_key_
+  (int ix, int iy, int iz, int nx, int ny, int nz, int bits, int mapping);
+
 private:
 
   int nx_, ny_, nz_;
 
+  /// Ordering of root blocks
+  int mapping_;
+
+  /// Process of each root block, or empty for mapping_linear
+  std::vector<int> process_;
+
 };
 
 #endif /* CHARM_MAPPING_ARRAY_HPP */
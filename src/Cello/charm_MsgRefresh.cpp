@@ -20,7 +20,9 @@ MsgRefresh::MsgRefresh()
       is_local_(true),
       id_refresh_(-1),
       data_msg_(nullptr),
-      buffer_(nullptr)
+      buffer_(nullptr),
+      buffer_copy_(nullptr),
+      size_copy_(0)
 {
   ++counter[cello::index_static()];
 }
@@ -34,6 +36,8 @@ MsgRefresh::~MsgRefresh()
   data_msg_ = nullptr;
   CkFreeMsg (buffer_);
   buffer_=nullptr;
+  delete [] buffer_copy_;
+  buffer_copy_ = nullptr;
 }
 
 //----------------------------------------------------------------------
@@ -54,10 +58,7 @@ void * MsgRefresh::pack (MsgRefresh * msg)
 {
   if (msg->buffer_ != nullptr) return msg->buffer_;
 
-  int size = 0;
-
-  SIZE_SCALAR_TYPE(size,int,msg->id_refresh_);
-  SIZE_OBJECT_PTR_TYPE(size,DataMsg,msg->data_msg_);
+  int size = msg->data_size();
 
   //--------------------------------------------------
   //  2. allocate buffer using CkAllocBuffer()
@@ -69,10 +70,7 @@ void * MsgRefresh::pack (MsgRefresh * msg)
   //  3. serialize message data into buffer 
   //--------------------------------------------------
 
-  char * pc = buffer;
-
-  SAVE_SCALAR_TYPE(pc,int,msg->id_refresh_);
-  SAVE_OBJECT_PTR_TYPE(pc,DataMsg,msg->data_msg_);
+  char * pc = msg->save_data(buffer);
 
   delete msg;
 
@@ -88,6 +86,105 @@ void * MsgRefresh::pack (MsgRefresh * msg)
 
 //----------------------------------------------------------------------
 
+int MsgRefresh::data_size () const
+{
+  // serialized copy is already packed
+  if (buffer_copy_ != nullptr) return size_copy_;
+
+  int size = 0;
+
+  SIZE_SCALAR_TYPE(size,int,id_refresh_);
+  SIZE_OBJECT_PTR_TYPE(size,DataMsg,data_msg_);
+
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgRefresh::save_data (char * buffer) const
+{
+  char * pc = buffer;
+
+  if (buffer_copy_ != nullptr) {
+
+    // data_msg_ references buffer_copy_, so copy it as-is
+
+    memcpy (pc,buffer_copy_,size_copy_);
+    pc += size_copy_;
+
+  } else {
+
+    SAVE_SCALAR_TYPE(pc,int,id_refresh_);
+    SAVE_OBJECT_PTR_TYPE(pc,DataMsg,data_msg_);
+
+  }
+
+  return pc;
+}
+
+//----------------------------------------------------------------------
+
+void MsgRefresh::load_copy (const char * buffer, int size)
+{
+  ASSERT("MsgRefresh::load_copy()",
+         "MsgRefresh is already initialized",
+         (data_msg_ == nullptr && buffer_copy_ == nullptr));
+
+  buffer_copy_ = new char [size];
+  size_copy_ = size;
+  memcpy (buffer_copy_,buffer,size);
+
+  load_buffer_copy_();
+}
+
+//----------------------------------------------------------------------
+
+void MsgRefresh::save_copy ()
+{
+  if (buffer_copy_ != nullptr) return;
+
+  const int size = data_size();
+  char * buffer = new char [size];
+  char * pc = save_data(buffer);
+
+  ASSERT2("MsgRefresh::save_copy()",
+	  "buffer size mismatch %ld saved %d allocated",
+	  (pc - buffer),size,
+	  (pc - buffer) == size);
+
+  // replace the DataMsg, which may reference the sender's field
+  // data, with one loaded from the copy
+
+  delete data_msg_;
+  data_msg_ = nullptr;
+
+  buffer_copy_ = buffer;
+  size_copy_ = size;
+
+  load_buffer_copy_();
+}
+
+//----------------------------------------------------------------------
+
+void MsgRefresh::load_buffer_copy_ ()
+{
+  const int size = size_copy_;
+
+  is_local_ = false;
+
+  char * pc = buffer_copy_;
+
+  LOAD_SCALAR_TYPE(pc,int,id_refresh_);
+  LOAD_OBJECT_PTR_TYPE(pc,DataMsg,data_msg_);
+
+  ASSERT2("MsgRefresh::load_buffer_copy_()",
+	  "buffer size mismatch %ld loaded %d copied",
+	  (pc - buffer_copy_),size,
+	  (pc - buffer_copy_) == size);
+}
+
+//----------------------------------------------------------------------
+
 MsgRefresh * MsgRefresh::unpack(void * buffer)
 {
 
@@ -126,6 +223,9 @@ void MsgRefresh::update (Data * data)
   if (!is_local_) {
       CkFreeMsg (buffer_);
       buffer_ = nullptr;
+      delete [] buffer_copy_;
+      buffer_copy_ = nullptr;
+      size_copy_ = 0;
   }
 }
 
@@ -144,4 +244,6 @@ void MsgRefresh::print (const char * message, FILE * fp_in)
   fprintf (fp,"%s MSG_REFRESH is_local_ %d\n",message,is_local_?1:0);
   fprintf (fp,"%s MSG_REFRESH id_refresh_ %d\n",message,id_refresh_);
   fprintf (fp,"%s MSG_REFRESH buffer_ %p\n",message,buffer_);
+  fprintf (fp,"%s MSG_REFRESH buffer_copy_ %p (%d bytes)\n",
+           message,(void*)buffer_copy_,size_copy_);
 }
@@ -48,6 +48,22 @@ public: // interface
   /// Update the Data with data stored in this message
   void update (Data * data);
 
+  /// Return the number of bytes required to serialize the message
+  int data_size () const;
+
+  /// Serialize the message into the provided buffer, returning the
+  /// next open position (used to pack MsgRefreshAggregate messages)
+  char * save_data (char * buffer) const;
+
+  /// Initialize the message from a copy of the given serialized
+  /// data, e.g. one of the messages in a MsgRefreshAggregate
+  void load_copy (const char * buffer, int size);
+
+  /// Serialize the message into its own buffer, so that it no longer
+  /// references the sending Block's data, e.g. while it is held for
+  /// a MsgRefreshAggregate
+  void save_copy ();
+
   void print(const char * message, FILE * fp=nullptr);
   
 public: // static methods
@@ -58,6 +74,11 @@ public: // static methods
   /// Unpack data to de-serialize
   static MsgRefresh * unpack(void *);
   
+protected: // functions
+
+  /// Load id_refresh_ and data_msg_ from buffer_copy_
+  void load_buffer_copy_ ();
+
 protected: // attributes
 
   /// Whether destination is local or remote
@@ -71,6 +92,13 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// Copy of serialized data if initialized using load_copy() or
+  /// save_copy()
+  char * buffer_copy_;
+
+  /// Size in bytes of buffer_copy_
+  int size_copy_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
@@ -0,0 +1,160 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MsgRefreshAggregate.cpp
+/// @date     2026-10-17
+/// @brief    [\ref Charm] Implementation of the MsgRefreshAggregate Charm++ message
+
+#include "data.hpp"
+#include "charm.hpp"
+#include "charm_simulation.hpp"
+
+//----------------------------------------------------------------------
+
+long MsgRefreshAggregate::counter[CONFIG_NODE_SIZE] = { };
+
+//----------------------------------------------------------------------
+
+MsgRefreshAggregate::MsgRefreshAggregate()
+    : CMessage_MsgRefreshAggregate(),
+      index_list_(),
+      msg_refresh_list_(),
+      buffer_(nullptr)
+{
+  ++counter[cello::index_static()];
+}
+
+//----------------------------------------------------------------------
+
+MsgRefreshAggregate::~MsgRefreshAggregate()
+{
+  --counter[cello::index_static()];
+  for (size_t i=0; i<msg_refresh_list_.size(); i++) {
+    delete msg_refresh_list_[i];
+    msg_refresh_list_[i] = nullptr;
+  }
+  msg_refresh_list_.clear();
+  index_list_.clear();
+  CkFreeMsg (buffer_);
+  buffer_=nullptr;
+}
+
+//----------------------------------------------------------------------
+
+void MsgRefreshAggregate::add_msg_refresh
+(Index index, MsgRefresh * msg_refresh)
+{
+  index_list_.push_back(index);
+  msg_refresh_list_.push_back(msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
+void * MsgRefreshAggregate::pack (MsgRefreshAggregate * msg)
+{
+  if (msg->buffer_ != nullptr) return msg->buffer_;
+
+  const int n = msg->msg_refresh_list_.size();
+
+  //--------------------------------------------------
+  //  1. determine buffer size (must be consistent with #3)
+  //--------------------------------------------------
+
+  std::vector<int> size_list(n);
+
+  int size = 0;
+
+  SIZE_SCALAR_TYPE(size,int,n);
+  for (int i=0; i<n; i++) {
+    size_list[i] = msg->msg_refresh_list_[i]->data_size();
+    size += msg->index_list_[i].data_size();
+    SIZE_SCALAR_TYPE(size,int,size_list[i]);
+    size += size_list[i];
+  }
+
+  //--------------------------------------------------
+  //  2. allocate buffer using CkAllocBuffer()
+  //--------------------------------------------------
+
+  char * buffer = (char *) CkAllocBuffer (msg,size);
+
+  //--------------------------------------------------
+  //  3. serialize message data into buffer
+  //--------------------------------------------------
+
+  char * pc = buffer;
+
+  SAVE_SCALAR_TYPE(pc,int,n);
+  for (int i=0; i<n; i++) {
+    pc = msg->index_list_[i].save_data(pc);
+    SAVE_SCALAR_TYPE(pc,int,size_list[i]);
+    pc = msg->msg_refresh_list_[i]->save_data(pc);
+  }
+
+  delete msg;
+
+  // Return the buffer
+
+  ASSERT2("MsgRefreshAggregate::pack()",
+	  "buffer size mismatch %ld allocated %d packed",
+	  (pc - (char*)buffer),size,
+	  (pc - (char*)buffer) == size);
+
+  return (void *) buffer;
+}
+
+//----------------------------------------------------------------------
+
+MsgRefreshAggregate * MsgRefreshAggregate::unpack(void * buffer)
+{
+
+  // 1. Allocate message using CkAllocBuffer.  NOTE do not use new.
+
+  MsgRefreshAggregate * msg =
+    (MsgRefreshAggregate *) CkAllocBuffer (buffer,sizeof(MsgRefreshAggregate));
+
+  msg = new ((void*)msg) MsgRefreshAggregate;
+
+  // 2. De-serialize message data from input buffer into the allocated
+  // message (must be consistent with pack())
+
+  char * pc = (char *) buffer;
+
+  int n;
+  LOAD_SCALAR_TYPE(pc,int,n);
+
+  msg->index_list_.resize(n);
+  msg->msg_refresh_list_.resize(n);
+
+  for (int i=0; i<n; i++) {
+    pc = msg->index_list_[i].load_data(pc);
+    int size;
+    LOAD_SCALAR_TYPE(pc,int,size);
+    // copy so each MsgRefresh can outlive this message, e.g. when
+    // queued by a Block that is not yet ready to receive it
+    MsgRefresh * msg_refresh = new MsgRefresh;
+    msg_refresh->load_copy(pc,size);
+    msg->msg_refresh_list_[i] = msg_refresh;
+    pc += size;
+  }
+
+  // 3. Save the input buffer for freeing later
+
+  msg->buffer_ = buffer;
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+void MsgRefreshAggregate::print (const char * message, FILE * fp_in)
+{
+  FILE * fp = fp_in ? fp_in : stdout;
+
+  fprintf (fp,"%s MSG_REFRESH_AGGREGATE %p\n",message,(void*)this);
+  fprintf (fp,"%s MSG_REFRESH_AGGREGATE num_msg_refresh %lu\n",
+           message,msg_refresh_list_.size());
+  for (size_t i=0; i<msg_refresh_list_.size(); i++) {
+    if (msg_refresh_list_[i]) msg_refresh_list_[i]->print(message,fp);
+  }
+  fprintf (fp,"%s MSG_REFRESH_AGGREGATE buffer_ %p\n",message,buffer_);
+}
@@ -0,0 +1,85 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MsgRefreshAggregate.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Charm] Declaration of the MsgRefreshAggregate Charm++ Message
+///
+/// A MsgRefreshAggregate packs the MsgRefresh messages that Blocks
+/// on one process send in a refresh phase to Blocks on the same
+/// remote process into a single Charm++ message.  It is sent to the
+/// Simulation group element on the destination process, which
+/// forwards the contained MsgRefresh messages to the local Blocks.
+
+#ifndef CHARM_MSG_REFRESH_AGGREGATE_HPP
+#define CHARM_MSG_REFRESH_AGGREGATE_HPP
+
+#include "cello.hpp"
+
+class MsgRefresh;
+
+class MsgRefreshAggregate : public CMessage_MsgRefreshAggregate {
+
+public: // interface
+
+  static long counter[CONFIG_NODE_SIZE];
+
+  MsgRefreshAggregate() ;
+
+  virtual ~MsgRefreshAggregate();
+
+  /// Copy constructor
+  MsgRefreshAggregate(const MsgRefreshAggregate & msg_aggregate) throw()
+  {
+    ++counter[cello::index_static()];
+  };
+
+  /// Assignment operator
+  MsgRefreshAggregate & operator= (const MsgRefreshAggregate & msg_aggregate) throw()
+  {
+    return *this;
+  }
+
+  /// Append a refresh message for the Block with the given Index.
+  /// The MsgRefresh is owned by this message until released
+  void add_msg_refresh (Index index, MsgRefresh * msg_refresh);
+
+  /// Return the number of refresh messages
+  int num_msg_refresh () const
+  { return msg_refresh_list_.size(); }
+
+  /// Return the Index of the destination Block of the i'th message
+  Index index (int i) const
+  { return index_list_[i]; }
+
+  /// Return the i'th refresh message, releasing ownership to the caller
+  MsgRefresh * release_msg_refresh (int i)
+  {
+    MsgRefresh * msg_refresh = msg_refresh_list_[i];
+    msg_refresh_list_[i] = nullptr;
+    return msg_refresh;
+  }
+
+  void print(const char * message, FILE * fp=nullptr);
+
+public: // static methods
+
+  /// Pack data to serialize
+  static void * pack (MsgRefreshAggregate*);
+
+  /// Unpack data to de-serialize
+  static MsgRefreshAggregate * unpack(void *);
+
+protected: // attributes
+
+  /// Indices of the destination Blocks
+  std::vector<Index> index_list_;
+
+  /// Refresh messages, one for each index in index_list_
+  std::vector<MsgRefresh *> msg_refresh_list_;
+
+  /// Saved Charm++ buffer for deleting after unpack()
+  void * buffer_;
+
+};
+
+#endif /* CHARM_MSG_REFRESH_AGGREGATE_HPP */
@@ -254,7 +254,9 @@ bool Block::do_adapt_()
 {
   int adapt_interval = cello::config()->adapt_interval;
 
-  return ((adapt_interval && ((cycle_ % adapt_interval) == 0)));
+  // When subcycling, only adapt after all levels have been stepped
+  return ((adapt_interval && ((cycle_ % adapt_interval) == 0))
+          && subcycle_synced_);
 }
 
 //----------------------------------------------------------------------
@@ -283,9 +285,19 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   Problem * problem = cello::problem();
   Refine * refine;
 
+  performance_start_(perf_adapt_compute);
+
   int index_refine = 0;
   while ((refine = problem->refine(index_refine++))) {
 
+    // Skip remaining criteria once the result can no longer change,
+    // unless they write an output field
+
+    const bool is_decided = (adapt == adapt_refine) ||
+      (adapt == adapt_same && level >= level_maximum);
+
+    if (is_decided && ! refine->has_output()) continue;
+
     Schedule * schedule = refine->schedule();
 
     if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
@@ -293,6 +305,8 @@ int Block::adapt_compute_desired_level_(int level_maximum)
     }
 
   }
+
+  performance_stop_(perf_adapt_compute);
   const int initial_cycle = cello::config()->initial_cycle;
   const bool is_first_cycle = (initial_cycle == cycle());
 
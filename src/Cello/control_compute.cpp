@@ -31,7 +31,26 @@ void Block::compute_enter_ ()
 void Block::compute_begin_ ()
 {
 
-  cello::simulation()->set_phase(phase_compute);
+  Simulation * simulation = cello::simulation();
+
+  simulation->set_phase(phase_compute);
+
+  const int sort_interval = cello::config()->particle_sort_interval;
+  if (sort_interval > 0 && (cycle_ % sort_interval) == 0 && is_leaf()) {
+    particle_sort_by_cell_();
+  }
+
+  if (cello::config()->stopping_subcycle) {
+
+    // Subcycled Methods are applied to the Block once every
+    // subcycle_ratio(level) cycles, or every cycle on levels as fine
+    // as the finest level.  All levels are stepped together on sync
+    // cycles
+
+    subcycle_synced_ = subcycle_sync_();
+    const int ratio = simulation->subcycle_ratio(level());
+    subcycle_step_ = subcycle_synced_ || (((cycle_ + 1) % ratio) == 0);
+  }
 
   index_method_ = 0;
   compute_next_();
@@ -87,6 +106,27 @@ void Block::compute_continue_ ()
     (schedule==NULL) ||
     (schedule->write_this_cycle(cycle_,time_));
 
+  if (is_scheduled && method->subcycle() &&
+      cello::config()->stopping_subcycle) {
+
+    if (subcycle_step_) {
+
+      // Advance from the start of the subcycled step over the time
+      // accumulated while the Method was skipped
+
+      subcycle_shifted_ = true;
+      subcycle_time_ = time_;
+      subcycle_dt_   = dt_;
+      set_time (time_ - dt_subcycle_);
+      set_dt   (dt_   + dt_subcycle_);
+
+    } else {
+
+      is_scheduled = false;
+
+    }
+  }
+
   if (is_scheduled) {
     TRACE2 ("Block::compute_continue() method = %d %p\n",
 	    index_method_,method); fflush(stdout);
@@ -119,6 +159,11 @@ void Block::compute_done ()
   if (cycle() >= CYCLE)
     CkPrintf ("%d %s DEBUG_COMPUTE Block::compute_done_()\n", CkMyPe(),name().c_str());
 #endif
+  if (subcycle_shifted_) {
+    subcycle_shifted_ = false;
+    set_time (subcycle_time_);
+    set_dt   (subcycle_dt_);
+  }
   index_method_++;
   compute_next_();
 }
@@ -140,8 +185,16 @@ void Block::compute_end_ ()
   // Push back fields if saving old ones
   data()->field().save_history(time_);
 
-  // delete fluxes
-  data()->flux_data()->deallocate();
+  // delete fluxes, unless accumulating finer-level fluxes until the
+  // Block's next subcycled step
+
+  if (subcycle_step_) {
+    data()->flux_data()->deallocate();
+  }
+
+  if (cello::config()->stopping_subcycle) {
+    dt_subcycle_ = subcycle_step_ ? 0.0 : dt_subcycle_ + dt_;
+  }
 
   // Update block cycle and time
   set_cycle (cycle_ + 1);
@@ -158,5 +211,103 @@ void Block::compute_end_ ()
 
 //----------------------------------------------------------------------
 
+bool Block::subcycle_sync_()
+{
+  Simulation * simulation = cello::simulation();
+  Problem * problem = simulation->problem();
+
+  // Sync when the hierarchy's levels changed or the coarsest level
+  // completes its step
+
+  if (cycle_ == simulation->subcycle_cycle_sync()) return true;
+
+  const int level_min = simulation->subcycle_level_min();
+  if (((cycle_ + 1) % simulation->subcycle_ratio(level_min)) == 0) return true;
+
+  // Sync before stopping, and before any output or scheduled Method
+  // that requires all Blocks at the same time
+
+  const int cycle_next = cycle_ + 1;
+  const double time_next = time_ + dt_;
+
+  if (stop_ || problem->stopping()->complete(cycle_next,time_next))
+    return true;
+
+  int index_output=0;
+  while (Output * output = problem->output(index_output++)) {
+    if (output->schedule()->write_this_cycle(cycle_next,time_next))
+      return true;
+  }
 
+  int index_method=0;
+  while (Method * method = problem->method(index_method++)) {
+    Schedule * schedule = method->schedule();
+    if (schedule && schedule->write_this_cycle(cycle_next,time_next))
+      return true;
+  }
 
+  return false;
+}
+
+//----------------------------------------------------------------------
+
+void Block::particle_sort_by_cell_()
+{
+  Particle particle (data()->particle());
+  Field field (data()->field());
+
+  const int rank = cello::rank();
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+  if (rank < 2) ny = 1;
+  if (rank < 3) nz = 1;
+
+  double xm,ym,zm;
+  double xp,yp,zp;
+  lower(&xm,&ym,&zm);
+  upper(&xp,&yp,&zp);
+
+  std::vector<int> key;
+  std::vector<double> xa,ya,za;
+
+  const int nt = particle.num_types();
+  for (int it=0; it<nt; it++) {
+
+    const int ia_x = particle.attribute_position(it,0);
+    const int np = particle.num_particles(it);
+    if (ia_x < 0 || np == 0) continue;
+
+    // positions are either absolute, or relative to the Block in
+    // [-1,1) if stored as integers
+    const bool is_float =
+      cello::type_is_float(particle.attribute_type(it,ia_x));
+
+    key.resize(np);
+
+    // compute the (active) cell index of each particle
+
+    int i = 0;
+    const int nb = particle.num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+      const int npb = particle.num_particles(it,ib);
+      if (xa.size() < size_t(npb)) {
+        xa.resize(npb,0.0);
+        ya.resize(npb,0.0);
+        za.resize(npb,0.0);
+      }
+      particle.position(it,ib,xa.data(),ya.data(),za.data());
+      for (int ip=0; ip<npb; ip++,i++) {
+        const double tx = is_float ? (xa[ip]-xm)/(xp-xm) : 0.5*(xa[ip]+1.0);
+        const double ty = is_float ? (ya[ip]-ym)/(yp-ym) : 0.5*(ya[ip]+1.0);
+        const double tz = is_float ? (za[ip]-zm)/(zp-zm) : 0.5*(za[ip]+1.0);
+        const int ix = std::max(0,std::min(nx-1,int(floor(nx*tx))));
+        const int iy = (rank >= 2) ? std::max(0,std::min(ny-1,int(floor(ny*ty)))) : 0;
+        const int iz = (rank >= 3) ? std::max(0,std::min(nz-1,int(floor(nz*tz)))) : 0;
+        key[i] = ix + nx*(iy + ny*iz);
+      }
+    }
+
+    particle.sort(it,key.data(),nx*ny*nz);
+  }
+}
@@ -226,6 +226,102 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
 
 //----------------------------------------------------------------------
 
+void Block::refresh_send_ (Index index, MsgRefresh * msg_refresh)
+{
+  if (cello::config()->refresh_aggregate) {
+
+    // hold messages to Blocks on other processes in this process's
+    // Simulation, which packs them into a single MsgRefreshAggregate
+    // per destination process
+
+    const int ip = thisProxy.ckLocMgr()->lastKnown(CkArrayIndexIndex(index));
+
+    if (ip != CkMyPe()) {
+      cello::simulation()->refresh_aggregate(ip,index,msg_refresh);
+      return;
+    }
+  }
+
+  thisProxy[index].p_refresh_recv (msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::refresh_aggregate
+(int ip, Index index, MsgRefresh * msg_refresh)
+{
+  // Schedule a flush when the first message is held.  The flush
+  // message is queued behind entry methods already pending on this
+  // process, so messages from all local Blocks entering the same
+  // refresh phase are sent together, while a Block that enters it
+  // later cannot delay messages that were already held
+
+  if (refresh_aggregate_.empty()) {
+    proxy_simulation[CkMyPe()].p_refresh_flush();
+  }
+
+  // Serialize the message now: its DataMsg references the sending
+  // Block's field data, which may be updated, migrated, or deleted
+  // before the flush runs
+
+  msg_refresh->save_copy();
+
+  MsgRefreshAggregate * & msg_aggregate = refresh_aggregate_[ip];
+  if (msg_aggregate == nullptr) {
+    msg_aggregate = new MsgRefreshAggregate;
+  }
+  msg_aggregate->add_msg_refresh(index,msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_refresh_flush ()
+{
+  CProxy_Block proxy_block = hierarchy_->block_array();
+
+  for (auto it = refresh_aggregate_.begin();
+       it != refresh_aggregate_.end(); it++) {
+
+    const int ip = it->first;
+    MsgRefreshAggregate * msg_aggregate = it->second;
+
+    if (msg_aggregate->num_msg_refresh() == 1) {
+
+      // nothing to aggregate: send the message directly
+
+      proxy_block[msg_aggregate->index(0)].p_refresh_recv
+        (msg_aggregate->release_msg_refresh(0));
+      delete msg_aggregate;
+
+    } else {
+
+      proxy_simulation[ip].p_refresh_recv_aggregate (msg_aggregate);
+
+    }
+  }
+  refresh_aggregate_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::p_refresh_recv_aggregate (MsgRefreshAggregate * msg)
+{
+  // Forward each refresh message to its Block.  Blocks that have
+  // migrated since the sender looked up their process are forwarded
+  // by Charm++ as usual
+
+  CProxy_Block proxy_block = hierarchy_->block_array();
+
+  const int n = msg->num_msg_refresh();
+  for (int i=0; i<n; i++) {
+    proxy_block[msg->index(i)].p_refresh_recv (msg->release_msg_refresh(i));
+  }
+
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
 void Block::refresh_exit (Refresh & refresh)
 {
   CHECK_ID(refresh.id());
@@ -332,10 +428,6 @@ void Block::refresh_load_field_face_
 ( Refresh & refresh,  int refresh_type,
   Index index_neighbor,  int if3[3], int ic3[3])
 {
-  // create refresh message
-
-  MsgRefresh * msg_refresh = new MsgRefresh;
-
   // create field face
   if (refresh_type == refresh_coarse) {
     index_.child(index_.level(),ic3,ic3+1,ic3+2);
@@ -344,6 +436,17 @@ void Block::refresh_load_field_face_
   FieldFace * field_face = create_face
     (if3, ic3, g3, refresh_type, &refresh,false);
 
+  // copy directly into the neighbor's ghost zones if it is resident
+
+  if (refresh_copy_local_(refresh,index_neighbor,field_face)) {
+    delete field_face;
+    return;
+  }
+
+  // create refresh message
+
+  MsgRefresh * msg_refresh = new MsgRefresh;
+
   // create data message
   DataMsg * data_msg = new DataMsg;
   // initialize data message
@@ -354,8 +457,40 @@ void Block::refresh_load_field_face_
   msg_refresh->set_refresh_id (refresh.id());
   msg_refresh->set_data_msg (data_msg);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  refresh_send_ (index_neighbor,msg_refresh);
+
+}
+
+//----------------------------------------------------------------------
+
+bool Block::refresh_copy_local_
+(Refresh & refresh, Index index_neighbor, FieldFace * field_face)
+{
+  if (! cello::config()->refresh_local_copy) return false;
+
+  // neighbor must be on this PE
+
+  Block * block = thisProxy[index_neighbor].ckLocal();
+
+  if (block == nullptr) return false;
+
+  // neighbor must be waiting for data, and must not be expecting
+  // this as its last message, since completing its refresh here
+  // would run its callback inside this Block's entry method
+
+  Sync * sync = block->sync_(refresh.id());
+
+  if (sync->state() != RefreshState::READY) return false;
+  if (sync->value() + 1 >= sync->stop()) return false;
+
+  Field field_src = data()->field();
+  Field field_dst = block->data()->field();
 
+  field_face->face_to_face (field_src, field_dst);
+
+  sync->advance();
+
+  return true;
 }
 
 //----------------------------------------------------------------------
@@ -745,7 +880,7 @@ void Block::refresh_coarse_send_
   msg_refresh->set_refresh_id (id_refresh);
   msg_refresh->set_data_msg (data_msg);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  refresh_send_ (index_neighbor,msg_refresh);
 }
 
 //----------------------------------------------------------------------
@@ -804,99 +939,132 @@ void Block::refresh_coarse_apply_ (Refresh * refresh)
           refresh->box_accumulate_adjust(&box_r,of3,g3);
           box_r.compute_region();
 
-          for (int i_f=0; i_f<nf; i_f++) {
+          // ... adjust send-ghost depth for accumulate
+          int i3_c[3], n3_c[3];
+          int i3_f[3], n3_f[3];
+          bool lpad;
+
+          box_r.get_start_size
+            (i3_f,n3_f,BlockType::receive,BlockType::receive,lpad=false);
+          box_r.get_start_size
+            (i3_c,n3_c,BlockType::receive,BlockType::receive_coarse,lpad=true);
+
+          int ip3_c[3],np3_c[3];
+          int ip3_f[3],np3_f[3];
+
+          Box box_p (rank,n3,g3);
+          box_p.set_block (BoxType_receive,+1, of3,ic3);
+          box_p.set_padding(pad);
+          box_p.set_recv_ghosts(g3); // reset recv ghosts to default
+          refresh->box_accumulate_adjust(&box_p,of3,g3);
+
+          box_p.compute_region();
 
-            // ... adjust send-ghost depth for accumulate
-            int i3_c[3], n3_c[3];
-            int i3_f[3], n3_f[3];
-            bool lpad;
+          box_p.get_start_size
+            (ip3_c,np3_c,BlockType::none,BlockType::receive_coarse,lpad=true);
+          box_p.get_start_size
+            (ip3_f,np3_f,BlockType::none,BlockType::receive,lpad=false);
 
-            box_r.get_start_size
-              (i3_f,n3_f,BlockType::receive,BlockType::receive,lpad=false);
-            box_r.get_start_size
-              (i3_c,n3_c,BlockType::receive,BlockType::receive_coarse,lpad=true);
-            const int index_field_src = field_list_src[i_f];
-            const int index_field_dst = field_list_dst[i_f];
+          prolong->array_sizes_valid (n3_f,n3_c);
+
+          for (int i_f=0; i_f<nf; ) {
+
+            // Fields with the same array sizes and accumulate flag
+            // are prolonged together, unless one is the source of a
+            // later field in the batch
 
             int m3_c[3];
             int m3_f[3];
             field.coarse_dimensions(i_f,m3_c,m3_c+1,m3_c+2);
-            field.dimensions(index_field_src,&m3_f[0],&m3_f[1],&m3_f[2]);
+            field.dimensions(field_list_src[i_f],&m3_f[0],&m3_f[1],&m3_f[2]);
+            const bool accumulate = refresh->accumulate(i_f);
+
+            int nb;
+            for (nb=1; i_f+nb<nf; nb++) {
+              const int j_f = i_f+nb;
+              int mn3_c[3];
+              int mn3_f[3];
+              field.coarse_dimensions(j_f,mn3_c,mn3_c+1,mn3_c+2);
+              field.dimensions(field_list_src[j_f],
+                               &mn3_f[0],&mn3_f[1],&mn3_f[2]);
+              bool same =
+                (refresh->accumulate(j_f) == accumulate) &&
+                std::equal(m3_c,m3_c+3,mn3_c) &&
+                std::equal(m3_f,m3_f+3,mn3_f);
+              for (int k_f=i_f; k_f<j_f; k_f++) {
+                if (field_list_dst[k_f] == field_list_src[j_f]) same = false;
+              }
+              if (! same) break;
+            }
+
+            std::vector<void *>       values_dst (nb);
+            std::vector<const void *> values_coarse (nb);
 
-            cello_float * field_values_src =
-              (cello_float *) field.values(index_field_src);
-            cello_float * field_values_dst =
-              (cello_float *) field.values(index_field_dst);
-            cello_float * coarse_field_src =
-              (cello_float *) field.coarse_values(index_field_src);
+            for (int k=0; k<nb; k++) {
 
-            const float r = n3_f[0] / n3_c[0];
-            const cello_float rr = (r == 1) ? 1.0 : 1.0/cello::num_children();
+              const int index_field_src = field_list_src[i_f+k];
+              const int index_field_dst = field_list_dst[i_f+k];
+
+              cello_float * field_values_src =
+                (cello_float *) field.values(index_field_src);
+              cello_float * field_values_dst =
+                (cello_float *) field.values(index_field_dst);
+              cello_float * coarse_field_src =
+                (cello_float *) field.coarse_values(index_field_src);
+
+              values_dst[k]    = field_values_dst;
+              values_coarse[k] = coarse_field_src;
+
+              const float r = n3_f[0] / n3_c[0];
+              const cello_float rr = (r == 1) ? 1.0 : 1.0/cello::num_children();
 
 #ifdef CHECK
-            ASSERT1 ("Block::refresh_coarse_apply",
-                     "Field-to-coarse array axis ratio r=%g is not 1.0 or 2.0",
-                     r, (r==1.0 || r==2.0));
+              ASSERT1 ("Block::refresh_coarse_apply",
+                       "Field-to-coarse array axis ratio r=%g is not 1.0 or 2.0",
+                       r, (r==1.0 || r==2.0));
 #endif
 
-            const int if0 = i3_f[0] + m3_f[0]*(i3_f[1] + m3_f[1]*i3_f[2]);
-            const int ic0 = i3_c[0] + m3_c[0]*(i3_c[1] + m3_c[1]*i3_c[2]);
-
-            // clear first to avoid double-counting overlapped subregions
-            for (int kz=0; kz<n3_f[2]; kz++) {
-              const int kzr=kz/r;
-              for (int ky=0; ky<n3_f[1]; ky++) {
-                const int kyr=ky/r;
-                for (int kx=0; kx<n3_f[0]; kx++) {
-                  const int kxr=kx/r;
-                  int kc = ic0 + kxr + m3_c[0]*(kyr + m3_c[1]*kzr);
-                  coarse_field_src[kc] = 0;
+              const int if0 = i3_f[0] + m3_f[0]*(i3_f[1] + m3_f[1]*i3_f[2]);
+              const int ic0 = i3_c[0] + m3_c[0]*(i3_c[1] + m3_c[1]*i3_c[2]);
+
+              // clear first to avoid double-counting overlapped subregions
+              for (int kz=0; kz<n3_f[2]; kz++) {
+                const int kzr=kz/r;
+                for (int ky=0; ky<n3_f[1]; ky++) {
+                  const int kyr=ky/r;
+                  for (int kx=0; kx<n3_f[0]; kx++) {
+                    const int kxr=kx/r;
+                    int kc = ic0 + kxr + m3_c[0]*(kyr + m3_c[1]*kzr);
+                    coarse_field_src[kc] = 0;
+                  }
                 }
               }
-            }
-            for (int kz=0; kz<n3_f[2]; kz++) {
-              const int kzr=kz/r;
-              for (int ky=0; ky<n3_f[1]; ky++) {
-                const int kyr=ky/r;
-                for (int kx=0; kx<n3_f[0]; kx++) {
-                  const int kxr=kx/r;
-                  int kc = ic0 + kxr + m3_c[0]*(kyr + m3_c[1]*kzr);
-                  int kf = if0 + kx + m3_f[0]*(ky + m3_f[1]*kz);
-                  coarse_field_src[kc] += rr*field_values_src[kf];
+              for (int kz=0; kz<n3_f[2]; kz++) {
+                const int kzr=kz/r;
+                for (int ky=0; ky<n3_f[1]; ky++) {
+                  const int kyr=ky/r;
+                  for (int kx=0; kx<n3_f[0]; kx++) {
+                    const int kxr=kx/r;
+                    int kc = ic0 + kxr + m3_c[0]*(kyr + m3_c[1]*kzr);
+                    int kf = if0 + kx + m3_f[0]*(ky + m3_f[1]*kz);
+                    coarse_field_src[kc] += rr*field_values_src[kf];
+                  }
                 }
               }
             }
 
-            int ip3_c[3],np3_c[3];
-            int ip3_f[3],np3_f[3];
-
-            Box box_p (rank,n3,g3);
-            int ic3[3];
-            index_.child(level,ic3,ic3+1,ic3+2);
-            box_p.set_block (BoxType_receive,+1, of3,ic3);
-            box_p.set_padding(pad);
-            box_p.set_recv_ghosts(g3); // reset recv ghosts to default
-            refresh->box_accumulate_adjust(&box_p,of3,g3);
-
-            box_p.compute_region();
-
-            box_p.get_start_size
-              (ip3_c,np3_c,BlockType::none,BlockType::receive_coarse,lpad=true);
-            box_p.get_start_size
-              (ip3_f,np3_f,BlockType::none,BlockType::receive,lpad=false);
-
-            prolong->array_sizes_valid (n3_f,n3_c);
-            const bool accumulate = refresh->accumulate(i_f);
             TRACE_PROLONG("coarse_apply",prolong, m3_f,ip3_f,np3_f, m3_c,ip3_c,np3_c);
-            prolong->apply(default_precision,
-                           field_values_dst, m3_f, ip3_f, np3_f,
-                           coarse_field_src, m3_c, ip3_c, np3_c,
-                           accumulate);
+            prolong->apply_list(default_precision, nb,
+                                values_dst.data(),    m3_f, ip3_f, np3_f,
+                                values_coarse.data(), m3_c, ip3_c, np3_c,
+                                accumulate);
 
             if (accumulate) {
               DEBUG_PRINT_ARRAY0("refresh_coarse_apply coarse_field",coarse_field,m3_c,np3_c,ip3_c);
-              DEBUG_PRINT_ARRAY0("refresh_field_apply field_values",field_values_dst,m3_f,np3_f,ip3_f);
+              DEBUG_PRINT_ARRAY0("refresh_field_apply field_values",values_dst[0],m3_f,np3_f,ip3_f);
             }
+
+            i_f += nb;
           }
         }
       }
@@ -968,7 +1136,7 @@ void Block::particle_send_
       msg_refresh->set_data_msg (data_msg);
       msg_refresh->set_refresh_id (id_refresh);
 
-      thisProxy[index].p_refresh_recv (msg_refresh);
+      refresh_send_ (index,msg_refresh);
 
     } else if (p_data) {
 
@@ -976,7 +1144,7 @@ void Block::particle_send_
       msg_refresh->set_data_msg (nullptr);
       msg_refresh->set_refresh_id (id_refresh);
 
-      thisProxy[index].p_refresh_recv (msg_refresh);
+      refresh_send_ (index,msg_refresh);
 
       // assert ParticleData object exits but has no particles
       delete p_data;
@@ -1255,6 +1423,20 @@ void Block::particle_scatter_neighbors_
  Particle particle,
  const bool copy)
 {
+  const int in = cello::index_static();
+
+  // mask and index arrays are reused for all batches, growing as needed
+  std::unique_ptr<bool[]> mask;
+  std::vector<int> index;
+  int mask_size = 0;
+  auto mask_resize = [&mask,&mask_size] (int np)
+    {
+      if (mask_size < np) {
+        mask.reset(new bool[np]);
+        mask_size = np;
+      }
+    };
+
   if (copy){
 
     // Loop over particle types
@@ -1286,17 +1468,14 @@ void Block::particle_scatter_neighbors_
         is_copy = (int64_t *) particle.attribute_array(it, ia_copy, ib);
 
         // ...initialize mask used for copying
-        bool * mask = new bool[np];
-        // Index array not needed for copying
-        int * index = nullptr;
+        mask_resize(np);
 
         // Loop over particles in this batch and fill in the mask
         for (int ip=0; ip<np; ip++) mask[ip] = !is_copy[ip*d_copy];
 
         // ...scatter particles to particle array
-        particle.scatter  (it,ib,np,mask,index,npa,particle_array, copy);
+        particle.scatter  (it,ib,np,mask.get(),nullptr,npa,particle_array, copy);
 
-        delete [] mask;
       } // Loop over batches
     } // Loop over particle types
   } // if (copy)
@@ -1318,6 +1497,19 @@ void Block::particle_scatter_neighbors_
     const double yl = yp-ym;
     const double zl = zp-zm;
 
+    // convert an absolute coordinate along the axis to block-relative
+    // coordinates, in which the block spans [1,3)
+    auto block_coordinate = [x0,y0,z0,xl,yl,zl] (int axis, double a)
+      {
+        const double c = (axis==0) ? x0 : ((axis==1) ? y0 : z0);
+        const double w = (axis==0) ? xl : ((axis==1) ? yl : zl);
+        return 2.0*(a-c)/w + 2.0;
+      };
+
+    std::vector<double> xa;
+    std::vector<double> ya;
+    std::vector<double> za;
+
     int count = 0;
     // ...for each particle type to be moved
     for (auto it_type=type_list.begin(); it_type!=type_list.end(); it_type++) {
@@ -1331,9 +1523,6 @@ void Block::particle_scatter_neighbors_
       const bool is_float =
 	(cello::type_is_float(particle.attribute_type(it,ia_x)));
 
-      // (...stride may be != 1 if particle attributes are interleaved)
-      const int d  = particle.stride(it,ia_x);
-
       // ...for each batch of particles
 
       const int nb = particle.num_batches(it);
@@ -1344,38 +1533,83 @@ void Block::particle_scatter_neighbors_
 
 	if (np == 0) continue;
 
-	// ...extract particle position arrays
+	// ...skip the batch without reading its positions if the
+	// extent recorded when they were last updated (e.g. by the
+	// particle drift) is inside the block
+
+	double lower3[3],upper3[3];
+	if (is_float && particle.position_extent(it,ib,lower3,upper3)) {
+	  bool inside = true;
+	  for (int axis=0; axis<rank; axis++) {
+	    inside = inside &&
+	      (1.0 <= block_coordinate(axis,lower3[axis])) &&
+	      (block_coordinate(axis,upper3[axis]) < 3.0);
+	  }
+	  if (inside) continue;
+	}
 
-	std::vector<double> xa(np,0.0);
-	std::vector<double> ya(np,0.0);
-	std::vector<double> za(np,0.0);
+	// ...extract particle position arrays (contiguous, regardless
+	// of whether attributes are interleaved)
+
+	if (xa.size() < size_t(np)) {
+	  xa.resize(np,0.0);
+	  ya.resize(np,0.0);
+	  za.resize(np,0.0);
+	}
 
 	particle.position(it,ib,xa.data(),ya.data(),za.data());
 
+	// ...convert to block-relative coordinates, in which the
+	// block spans [1,3) along each axis, and find their extent
+
+	double lower_bound = 1.0;
+	double upper_bound = 1.0;
+	for (int axis=0; axis<rank; axis++) {
+	  double * a = (axis==0) ? xa.data() : ((axis==1) ? ya.data() : za.data());
+	  double amin = std::numeric_limits<double>::max();
+	  double amax = std::numeric_limits<double>::lowest();
+	  if (is_float) {
+	    for (int ip=0; ip<np; ip++) {
+	      a[ip] = block_coordinate(axis,a[ip]);
+	      amin = std::min(amin,a[ip]);
+	      amax = std::max(amax,a[ip]);
+	    }
+	  } else {
+	    for (int ip=0; ip<np; ip++) {
+	      a[ip] = a[ip] + 2.0;
+	      amin = std::min(amin,a[ip]);
+	      amax = std::max(amax,a[ip]);
+	    }
+	  }
+	  lower_bound = std::min(lower_bound,amin);
+	  upper_bound = std::max(upper_bound,amax);
+	}
+
+	ParticleData::counter_scanned[in] += np;
+
+	// ...skip the batch if no particle left the block
+
+	if (1.0 <= lower_bound && upper_bound < 3.0) continue;
+
 	// ...initialize mask used for scatter and delete
 	// ...and corresponding particle indices
 
-	bool * mask = new bool[np];
-	int * index = new int[np];
+	mask_resize(np);
+	if (index.size() < size_t(np)) index.resize(np);
 
 	for (int ip=0; ip<np; ip++) {
 
-	  // look at block scatter children for help?
-	  double x = is_float ? 2.0*(xa[ip*d]-x0)/xl : xa[ip*d];
-	  double y = is_float ? 2.0*(ya[ip*d]-y0)/yl : ya[ip*d];
-	  double z = is_float ? 2.0*(za[ip*d]-z0)/zl : za[ip*d];
-
-	  int ix = (rank >= 1) ? (x + 2) : 0;
-	  int iy = (rank >= 2) ? (y + 2) : 0;
-	  int iz = (rank >= 3) ? (z + 2) : 0;
+	  int ix = (rank >= 1) ? xa[ip] : 0;
+	  int iy = (rank >= 2) ? ya[ip] : 0;
+	  int iz = (rank >= 3) ? za[ip] : 0;
 
 	  if (! (0 <= ix && ix < 4) ||
 	      ! (0 <= iy && iy < 4) ||
 	      ! (0 <= iz && iz < 4)) {
 
 	    CkPrintf ("%d ix iy iz %d %d %d\n",CkMyPe(),ix,iy,iz);
-	    CkPrintf ("%d x y z %f %f %f\n",CkMyPe(),x,y,z);
-	    CkPrintf ("%d xa ya za %f %f %f\n",CkMyPe(),xa[ip*d],ya[ip*d],za[ip*d]);
+	    CkPrintf ("%d x y z %f %f %f\n",CkMyPe(),
+		      xa[ip]-2.0,ya[ip]-2.0,za[ip]-2.0);
 	    CkPrintf ("%d xm ym zm %f %f %f\n",CkMyPe(),xm,ym,zm);
 	    CkPrintf ("%d xp yp zp %f %f %f\n",CkMyPe(),xp,yp,zp);
 	    ERROR3 ("Block::particle_scatter_neighbors_",
@@ -1393,13 +1627,13 @@ void Block::particle_scatter_neighbors_
 	}
 
 	// ...scatter particles to particle array
-	particle.scatter  (it,ib,np,mask,index,npa,particle_array, copy);
+	particle.scatter  (it,ib,np,mask.get(),index.data(),npa,particle_array, copy);
 
 	// ... delete scattered particles if moved
-	count += particle.delete_particles (it,ib,mask);
+	const int num_moved = particle.delete_particles (it,ib,mask.get());
+	ParticleData::counter_migrated[in] += num_moved;
+	count += num_moved;
 
-	delete [] mask;
-	delete [] index;
       } // Loop over batches
     } // Loop over particle types
 
@@ -1475,8 +1709,10 @@ void Block::refresh_load_flux_face_
   FluxData * flux_data = data()->flux_data();
 
   const bool is_new = true;
-  if (refresh_type == refresh_coarse) {
-    // neighbor is coarser
+  if (refresh_type == refresh_coarse && subcycle_step_) {
+    // neighbor is coarser.  When subcycling, a Block that was not
+    // stepped this cycle still holds the fluxes of its last step, which
+    // the coarse neighbor has already summed, so none are sent
     const int nf = flux_data->num_fields();
     data_msg -> set_num_face_fluxes(nf);
     for (int i=0; i<nf; i++) {
@@ -1501,6 +1737,6 @@ void Block::refresh_load_flux_face_
   msg_refresh->set_data_msg (data_msg);
   msg_refresh->set_refresh_id (id_refresh);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  refresh_send_ (index_neighbor,msg_refresh);
 
 }
@@ -60,12 +60,31 @@ void Block::stopping_begin_()
     // Compute local dt
 
     Problem * problem = simulation->problem();
+    const Config * config = cello::config();
+
+    // When subcycling, subcycled Methods contribute the timestep of
+    // leaf Blocks to their level's entry following [dt, stop]
+
+    const bool subcycle = config->stopping_subcycle;
+    const int level_min = config->mesh_min_level;
+    const int num_levels = subcycle ?
+      (config->mesh_max_level - level_min + 1) : 0;
+
+    std::vector<double> min_reduce
+      (2 + num_levels, std::numeric_limits<double>::max());
 
     int index = 0;
     Method * method;
     double dt_block = std::numeric_limits<double>::max();
     while ((method = problem->method(index++))) {
-      dt_block = std::min(dt_block,method->timestep(this));
+      if (subcycle && method->subcycle()) {
+        if (is_leaf()) {
+          double & dt_level = min_reduce[2 + level() - level_min];
+          dt_level = std::min(dt_level,method->timestep(this));
+        }
+      } else {
+        dt_block = std::min(dt_block,method->timestep(this));
+      }
     }
 
     // Reduce timestep to coincide with scheduled output if needed
@@ -91,8 +110,6 @@ void Block::stopping_begin_()
 
     // Reduce to find Block array minimum dt and stopping criteria
 
-    double min_reduce[2];
-
     min_reduce[0] = dt_block;
     min_reduce[1] = stop_block ? 1.0 : 0.0;
 
@@ -103,7 +120,8 @@ void Block::stopping_begin_()
     CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
 	      name().c_str(),__FILE__,__LINE__); fflush(stdout);
 #endif    
-    contribute(2*sizeof(double), min_reduce, CkReduction::min_double, callback);
+    contribute(min_reduce.size()*sizeof(double), min_reduce.data(),
+               CkReduction::min_double, callback);
 
   } else {
 
@@ -124,14 +142,42 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
   ++age_;
 
   double * min_reduce = (double * )msg->getData();
+  const int num_reduce = msg->getSize() / sizeof(double);
 
   dt_   = min_reduce[0];
   stop_ = min_reduce[1] == 1.0 ? true : false;
 
-  delete msg;
-
   Simulation * simulation = cello::simulation();
 
+  if (num_reduce > 2) {
+
+    // Subcycling: coarser levels step 2^(level_max - level) times
+    // less often (up to Stopping:subcycle_max_levels), so the cycle
+    // timestep is the minimum over levels of dt_level / ratio
+
+    const int level_min = cello::config()->mesh_min_level;
+    const double dt_max = std::numeric_limits<double>::max();
+    int level_coarse = std::numeric_limits<int>::max();
+    int level_fine   = std::numeric_limits<int>::min();
+    for (int i=2; i<num_reduce; i++) {
+      if (min_reduce[i] < dt_max) {
+        level_coarse = std::min(level_coarse, level_min + i - 2);
+        level_fine   = std::max(level_fine,   level_min + i - 2);
+      }
+    }
+    if (level_fine >= level_coarse) {
+      simulation->set_subcycle_levels (level_coarse,level_fine,cycle_);
+      for (int level=level_coarse; level<=level_fine; level++) {
+        const double dt_level = min_reduce[2 + level - level_min];
+        if (dt_level < dt_max) {
+          dt_ = std::min(dt_, dt_level / simulation->subcycle_ratio(level));
+        }
+      }
+    }
+  }
+
+  delete msg;
+
   dt_ *= Method::courant_global;
   
   set_dt   (dt_);
@@ -286,6 +332,10 @@ void Block::exit_()
       CkPrintf ("%d Block::exit_() MsgRefresh::counter = %ld != 0\n",
 		CkMyPe(),MsgRefresh::counter[in]);
     }
+    if (MsgRefreshAggregate::counter[in] != 0) {
+      CkPrintf ("%d Block::exit_() MsgRefreshAggregate::counter = %ld != 0\n",
+		CkMyPe(),MsgRefreshAggregate::counter[in]);
+    }
   }
   if (index_.is_root()) {
     proxy_main.p_exit(1);
@@ -146,10 +146,14 @@ void Data::allocate () throw()
   scalar_data_sync_       .allocate(cello::scalar_descr_sync());
   scalar_data_void_       .allocate(cello::scalar_descr_void());
   scalar_data_index_      .allocate(cello::scalar_descr_index());
-  // allocate Block Field storage
+  // allocate Block Field storage.  Arrays reused from the MemoryPool
+  // are not cleared, and new Blocks may read fields before writing
+  // them, e.g. ghost zones of fields that are not refreshed, so clear
+  // them here
   for (size_t i=0; i<field_data_.size(); i++) {
     field_data_[i]->set_history_(cello::field_descr());
     field_data_[i]->allocate_permanent(cello::field_descr(),true);
+    field_data_[i]->clear(cello::field_descr(),0.0);
   }
   // initialize Flux field list
 }
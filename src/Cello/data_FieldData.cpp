@@ -364,9 +364,10 @@ void FieldData::allocate_permanent
 
   array_size += alignment - 1;
 
-  // Allocate the array
+  // Allocate the array, reusing a freed array of the same size if
+  // available
 
-  array_permanent_.resize(array_size);
+  MemoryPool::instance()->allocate(array_permanent_,array_size);
 
   // Initialize field_begin
 
@@ -575,7 +576,7 @@ void FieldData::deallocate_permanent () throw()
 
     deallocate_coarse();
 
-    array_permanent_.clear();
+    MemoryPool::instance()->deallocate(array_permanent_);
     offsets_.clear();
   }
 }
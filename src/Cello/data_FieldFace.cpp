@@ -236,7 +236,11 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
 
-  for (size_t i_f=0; i_f < field_list_src.size(); i_f++) {
+  for (size_t i_f=0; i_f < field_list_src.size(); ) {
+
+    // fields with the same geometry are restricted together
+
+    const int nb = batch_size_(field,field_list_src,i_f);
 
     const size_t index_field = field_list_src[i_f];
     
@@ -244,10 +248,6 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 
     precision_type precision = field.precision(index_field);
 
-    void * field_face = field.values(index_field);
-
-    char * array_face  = &array[index_array];
-
     int m3[3],g3[3],c3[3];
 
     field.dimensions (index_field,m3,m3+1,m3+2);
@@ -278,43 +278,64 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 #endif
 
     // scale by density if needed to convert to conservative form
-    mul_by_density_(field,index_field,i3,n3,m3);
+    for (int k=0; k<nb; k++) {
+      mul_by_density_(field,field_list_src[i_f+k],i3,n3,m3);
+    }
 
     if (refresh_type_ == refresh_coarse) {
 
-      // Restrict field to array
+      // Restrict fields to array
 
       int nc3[3] = { (n3[0]+1)/2, (n3[1]+1)/2,(n3[2]+1)/2 };
 
       int i3_array[3] = {0,0,0};
 
-      index_array += restrict()->apply
-	(precision, 
-	 array_face,nc3,i3_array,nc3, 
-	 field_face,m3,i3, n3);
+      const size_t bytes = cello::sizeof_precision(precision)*
+        nc3[0]*nc3[1]*nc3[2];
+
+      std::vector<void *> array_face (nb);
+      std::vector<const void *> field_face (nb);
+      for (int k=0; k<nb; k++) {
+        array_face[k] = &array[index_array + k*bytes];
+        field_face[k] = field.values(field_list_src[i_f+k]);
+      }
+
+      index_array += restrict()->apply_list
+	(precision, nb,
+	 array_face.data(),nc3,i3_array,nc3, 
+	 field_face.data(),m3,i3, n3);
 
     } else {
 
-      union { float * a4; double * a8; long double * a16; };
-      union { float * f4; double * f8;long double * f16;  };
-      a4 = (float *) array_face;
-      f4 = (float *) field_face;
+      for (int k=0; k<nb; k++) {
+
+        char * array_face  = &array[index_array];
+
+        union { float * a4; double * a8; long double * a16; };
+        union { float * f4; double * f8;long double * f16;  };
+        a4 = (float *) array_face;
+        f4 = (float *) field.values(field_list_src[i_f+k]);
       
-      // Copy field to array
+        // Copy field to array
       
-      if (precision == precision_single) {
-	index_array += load_ ( a4,  f4,  m3,n3,i3, accumulate);
-      } else if (precision == precision_double) {
-	index_array += load_ ( a8,  f8,  m3,n3,i3, accumulate);
-      } else if (precision == precision_quadruple) {
-	index_array += load_ ( a16, f16, m3,n3,i3, accumulate);
-      } else {
-	ERROR("FieldFace::face_to_array", "Unsupported precision");
+        if (precision == precision_single) {
+          index_array += load_ ( a4,  f4,  m3,n3,i3, accumulate);
+        } else if (precision == precision_double) {
+          index_array += load_ ( a8,  f8,  m3,n3,i3, accumulate);
+        } else if (precision == precision_quadruple) {
+          index_array += load_ ( a16, f16, m3,n3,i3, accumulate);
+        } else {
+          ERROR("FieldFace::face_to_array", "Unsupported precision");
+        }
       }
     }
 
     // unscale by density if needed to convert back from conservative form
-    div_by_density_(field,index_field,i3,n3,m3);
+    for (int k=0; k<nb; k++) {
+      div_by_density_(field,field_list_src[i_f+k],i3,n3,m3);
+    }
+
+    i_f += nb;
   }
 
 }
@@ -328,7 +349,11 @@ void FieldFace::array_to_face (char * array, Field field) throw()
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
 
-  for (size_t i_f=0; i_f < field_list_dst.size(); i_f++) {
+  for (size_t i_f=0; i_f < field_list_dst.size(); ) {
+
+    // fields with the same geometry are prolonged together
+
+    const int nb = batch_size_(field,field_list_dst,i_f);
 
     size_t index_field = field_list_dst[i_f];
 
@@ -336,10 +361,6 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     
     precision_type precision = field.precision(index_field);
 
-    char * field_ghost = field.values(index_field);
-    
-    char * array_ghost  = array + index_array;
-
     int m3[3],g3[3],c3[3];
 
     field.dimensions (index_field,m3,m3+1,m3+2);
@@ -375,7 +396,7 @@ void FieldFace::array_to_face (char * array, Field field) throw()
     
     if (refresh_type_ == refresh_fine) {
 
-      // Prolong array to field
+      // Prolong array to fields
 
       ASSERT ("FieldFace::array_to_face()",
               "No prolongation operator",
@@ -391,47 +412,64 @@ void FieldFace::array_to_face (char * array, Field field) throw()
       ic3[1] = 0;
       ic3[2] = 0;
 
+      const size_t bytes = cello::sizeof_precision(precision)*
+        nc3[0]*nc3[1]*nc3[2];
+
+      std::vector<void *> field_ghost (nb);
+      std::vector<const void *> array_ghost (nb);
+      for (int k=0; k<nb; k++) {
+        field_ghost[k] = field.values(field_list_dst[i_f+k]);
+        array_ghost[k] = array + index_array + k*bytes;
+      }
+
       // adjust for full-block interpolation to child
       TRACE_PROLONG("array_to_face",prolong(),m3,i3,n3,mc3,ic3,nc3);
-      prolong()->apply
-        (precision,
-         field_ghost,m3, i3,  n3,
-         array_ghost,mc3,ic3, nc3,
+      prolong()->apply_list
+        (precision, nb,
+         field_ghost.data(),m3, i3,  n3,
+         array_ghost.data(),mc3,ic3, nc3,
          accumulate);
 
 #ifdef DEBUG_ARRAY            
       CkPrintf ("field %lu\n",  i_f);
 #endif      
-      DEBUG_PRINT_ARRAY0("array_to_face array_ghost",((cello_float *)array_ghost),nc3,nc3,ic3);
-      DEBUG_PRINT_ARRAY0("array_to_face field_ghost",((cello_float *)field_ghost),m3,n3,i3);
+      DEBUG_PRINT_ARRAY0("array_to_face array_ghost",((cello_float *)array_ghost[0]),nc3,nc3,ic3);
+      DEBUG_PRINT_ARRAY0("array_to_face field_ghost",((cello_float *)field_ghost[0]),m3,n3,i3);
 
-      index_array += cello::sizeof_precision(precision)*
-        nc3[0]*nc3[1]*nc3[2];
+      index_array += nb*bytes;
 
     } else {
 
-      // Copy array to field
-      union { float * as4; double * as8; long double * as16; };
-      union { float * fd4; double * fd8; long double * fd16; };
-      as4 = (float *) array_ghost;
-      fd4 = (float *) field_ghost;
+      for (int k=0; k<nb; k++) {
+
+        char * array_ghost  = array + index_array;
+
+        // Copy array to field
+        union { float * as4; double * as8; long double * as16; };
+        union { float * fd4; double * fd8; long double * fd16; };
+        as4 = (float *) array_ghost;
+        fd4 = (float *) field.values(field_list_dst[i_f+k]);
       
-      // Copy field to array
-
-      if (precision == precision_single) {
-	index_array += store_ ( fd4,  as4,  m3,n3,i3, accumulate);
-      } else if (precision == precision_double) {
-	index_array += store_ ( fd8,  as8,  m3,n3,i3, accumulate);
-      } else if (precision == precision_quadruple) {
-	index_array += store_ ( fd16, as16, m3,n3,i3, accumulate);
-      } else {
-	ERROR("FieldFace::array_to_face()", "Unsupported precision");
+        // Copy field to array
+
+        if (precision == precision_single) {
+          index_array += store_ ( fd4,  as4,  m3,n3,i3, accumulate);
+        } else if (precision == precision_double) {
+          index_array += store_ ( fd8,  as8,  m3,n3,i3, accumulate);
+        } else if (precision == precision_quadruple) {
+          index_array += store_ ( fd16, as16, m3,n3,i3, accumulate);
+        } else {
+          ERROR("FieldFace::array_to_face()", "Unsupported precision");
+        }
       }
     }
 
     // unscale by density if needed to convert back from conservative form
-    div_by_density_(field,index_field,i3,n3,m3);
+    for (int k=0; k<nb; k++) {
+      div_by_density_(field,field_list_dst[i_f+k],i3,n3,m3);
+    }
 
+    i_f += nb;
   }
 }
 
@@ -446,10 +484,13 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
   CmiLock(field_face_node_lock);
 #endif  
     
-  for (size_t i_f=0; i_f < field_list_src.size(); i_f++) {
+  for (size_t i_f=0; i_f < field_list_src.size(); ) {
+
+    // fields with the same geometry are interpolated together
+
+    const int nb = batch_size_(field_src,field_list_src,i_f);
 
     size_t index_src = field_list_src[i_f];
-    size_t index_dst = field_list_dst[i_f];
     CHECK_COARSE(field_src,index_src);
 
     int m3[3],n3[3],g3[3],c3[3];
@@ -488,15 +529,21 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
 
     precision_type precision = field_src.precision(index_src);
     
-    char * values_src = field_src.values(index_src);
-    char * values_dst = field_dst.values(index_dst);
+    std::vector<void *> values_src (nb);
+    std::vector<void *> values_dst (nb);
+    for (int k=0; k<nb; k++) {
+      values_src[k] = field_src.values(field_list_src[i_f+k]);
+      values_dst[k] = field_dst.values(field_list_dst[i_f+k]);
+    }
 
     // scale by density if needed to convert to conservative form
-    mul_by_density_(field_src,index_src,is3,ns3,m3);
+    for (int k=0; k<nb; k++) {
+      mul_by_density_(field_src,field_list_src[i_f+k],is3,ns3,m3);
+    }
     
     if (refresh_type_ == refresh_fine) {
 
-      // Prolong field
+      // Prolong fields
 
       bool need_padding = (g3[0]%2==1) || (g3[1]%2==1) || (g3[2]%2==1);
 
@@ -511,51 +558,60 @@ void FieldFace::face_to_face (Field field_src, Field field_dst)
 
       // adjust for full-block interpolation to child
       TRACE_PROLONG("face_to_face",prolong(),m3,id3,nd3,m3,is3,ns3);
-      prolong()->apply (precision,
-                        values_dst,m3,id3, nd3,
-                        values_src,m3,is3, ns3,
-                        accumulate);
+      prolong()->apply_list (precision, nb,
+                             values_dst.data(),m3,id3, nd3,
+                             (const void * const *)values_src.data(),
+                             m3,is3, ns3,
+                             accumulate);
 
 #ifdef DEBUG_ARRAY            
       CkPrintf ("field %lu\n",  i_f);
 #endif      
-      DEBUG_PRINT_ARRAY0("face_to_face values_src",((cello_float *)values_src),m3,ns3,is3);
-      DEBUG_PRINT_ARRAY0("face_to_face values_dst",((cello_float *)values_dst),m3,nd3,id3);
+      DEBUG_PRINT_ARRAY0("face_to_face values_src",((cello_float *)values_src[0]),m3,ns3,is3);
+      DEBUG_PRINT_ARRAY0("face_to_face values_dst",((cello_float *)values_dst[0]),m3,nd3,id3);
 
 
     } else if (refresh_type_ == refresh_coarse) {
 
-      // Restrict field
+      // Restrict fields
 
-      restrict()->apply (precision,
-                         values_dst,m3,id3, nd3,
-                         values_src,m3,is3, ns3,
-                         accumulate);
+      restrict()->apply_list (precision, nb,
+                              values_dst.data(),m3,id3, nd3,
+                              (const void * const *)values_src.data(),
+                              m3,is3, ns3,
+                              accumulate);
 
     } else {
 
       // Copy faces to ghosts
 
-      union { float * fs4; double * fs8; long double * fs16; };
-      union { float * fd4; double * fd8; long double * fd16; };
-      fs4 = (float *) values_src;
-      fd4 = (float *) values_dst;
+      for (int k=0; k<nb; k++) {
+
+        union { float * fs4; double * fs8; long double * fs16; };
+        union { float * fd4; double * fd8; long double * fd16; };
+        fs4 = (float *) values_src[k];
+        fd4 = (float *) values_dst[k];
       
-      // Copy field to array
-
-      if (precision == precision_single) {
-	copy_ ( fd4, m3,nd3,id3,fs4, m3, ns3,is3,accumulate);
-      } else if (precision == precision_double) {
-	copy_ ( fd8, m3,nd3,id3,fs8, m3, ns3,is3,accumulate);
-      } else if (precision == precision_quadruple) {
-	copy_ ( fd16,m3,nd3,id3,fs16,m3,ns3,is3,accumulate);
-      } else {
-	ERROR("FieldFace::face_to_face()", "Unsupported precision");
+        // Copy field to array
+
+        if (precision == precision_single) {
+          copy_ ( fd4, m3,nd3,id3,fs4, m3, ns3,is3,accumulate);
+        } else if (precision == precision_double) {
+          copy_ ( fd8, m3,nd3,id3,fs8, m3, ns3,is3,accumulate);
+        } else if (precision == precision_quadruple) {
+          copy_ ( fd16,m3,nd3,id3,fs16,m3,ns3,is3,accumulate);
+        } else {
+          ERROR("FieldFace::face_to_face()", "Unsupported precision");
+        }
       }
     }
     // unscale by density if needed to convert back from conservative form
-    div_by_density_(field_src,index_src,is3,ns3,m3);
-    div_by_density_(field_dst,index_dst,id3,nd3,m3);
+    for (int k=0; k<nb; k++) {
+      div_by_density_(field_src,field_list_src[i_f+k],is3,ns3,m3);
+      div_by_density_(field_dst,field_list_dst[i_f+k],id3,nd3,m3);
+    }
+
+    i_f += nb;
   }
 #ifdef CONFIG_SMP_MODE
   CmiUnlock(field_face_node_lock);
@@ -1016,3 +1072,35 @@ void FieldFace::box_adjust_accumulate_ (Box * box, int accumulate, int g3[3])
   box->compute_block_start(BoxType_receive);
   box->compute_region();
 }
+
+//----------------------------------------------------------------------
+
+int FieldFace::batch_size_
+(Field field, const std::vector<int> & field_list, size_t i_f) const
+{
+  const int index_field = field_list[i_f];
+
+  const precision_type precision = field.precision(index_field);
+  const bool accumulate = refresh_->accumulate(i_f);
+  int m3[3],g3[3],c3[3];
+  field.dimensions (index_field,m3,m3+1,m3+2);
+  field.ghost_depth(index_field,g3,g3+1,g3+2);
+  field.centering  (index_field,c3,c3+1,c3+2);
+
+  size_t j_f;
+  for (j_f=i_f+1; j_f<field_list.size(); j_f++) {
+    const int index_next = field_list[j_f];
+    int mn3[3],gn3[3],cn3[3];
+    field.dimensions (index_next,mn3,mn3+1,mn3+2);
+    field.ghost_depth(index_next,gn3,gn3+1,gn3+2);
+    field.centering  (index_next,cn3,cn3+1,cn3+2);
+    const bool same =
+      (field.precision(index_next) == precision) &&
+      (refresh_->accumulate(j_f) == accumulate) &&
+      std::equal(m3,m3+3,mn3) &&
+      std::equal(g3,g3+3,gn3) &&
+      std::equal(c3,c3+3,cn3);
+    if (! same) break;
+  }
+  return j_f - i_f;
+}
@@ -190,6 +190,13 @@ private: // functions
   /// Adjust box for accumulating values instead of assigning them
   void box_adjust_accumulate_ (Box * box, int accumulate, int g3[3]);
 
+  /// Return the number of consecutive fields in field_list starting
+  /// at i_f with the same precision, dimensions, ghost depth,
+  /// centering, and accumulate flag, which can be interpolated with a
+  /// single Prolong::apply_list() or Restrict::apply_list() call
+  int batch_size_
+  (Field field, const std::vector<int> & field_list, size_t i_f) const;
+
 private: // attributes
 
   /// Rank of the problem
@@ -19,6 +19,18 @@ void FluxData::allocate
   std::vector<int> * cy_list,
   std::vector<int> * cz_list)
 {
+  if (is_allocated()) {
+    if (field_list == field_list_) {
+      // Already allocated (subcycling): clear the Block's own fluxes
+      // but keep neighbor fluxes accumulated over finer time steps
+      for (FaceFluxes * face_fluxes : block_fluxes_) {
+        face_fluxes->clear();
+      }
+      return;
+    }
+    deallocate();
+  }
+
   field_list_ = field_list;
   unsigned nf = field_list.size();
   block_fluxes_.resize(6*nf,nullptr);
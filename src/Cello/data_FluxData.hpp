@@ -97,6 +97,10 @@ public: // interface
   /// Deallocate all face fluxes for all faces and all fields
   void deallocate();
 
+  /// Return whether face fluxes are currently allocated
+  inline bool is_allocated () const
+  { return ! block_fluxes_.empty(); }
+
   /// Return the number of field indices
   inline unsigned num_fields () const
   { return field_list_.size(); }
@@ -350,6 +350,13 @@ public: // interface
   void compress (int it)
   { particle_data_->compress(particle_descr_,it); }
 
+  /// Reorder all particles of the given type by key, with key[i] in
+  /// [0,num_keys) given for each particle in the current order.
+  /// Batches are compressed, so that particle i is at index(i)
+
+  void sort (int it, const int * key, int num_keys)
+  { particle_data_->sort(particle_descr_,it,key,num_keys); }
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -390,6 +397,18 @@ public: // interface
   bool velocity (int it, int ib, double * vx, double * vy, double * vz)
   { return particle_data_->velocity(particle_descr_,it,ib,vx,vy,vz); }
 
+  /// Record the extent of the positions in a batch, e.g. as found
+  /// while updating them.  Used to skip batches with no particles
+  /// leaving the Block when refreshing particles
+  void set_position_extent (int it, int ib,
+			    const double lower[3], const double upper[3])
+  { particle_data_->set_position_extent(it,ib,lower,upper); }
+
+  /// Return whether a batch has a recorded position extent, and if so
+  /// return it
+  bool position_extent (int it, int ib, double lower[3], double upper[3]) const
+  { return particle_data_->position_extent(it,ib,lower,upper); }
+
   //--------------------------------------------------
   /// Return the number of bytes required to serialize the data object
   int data_size () const
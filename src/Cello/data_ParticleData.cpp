@@ -7,18 +7,22 @@
 
 #include "data.hpp"
 #include <algorithm>
+#include <limits>
 
 // #define DEBUG_PARTICLES
 
 int64_t ParticleData::counter[CONFIG_NODE_SIZE] = {0};
 int64_t ParticleData::id_counter[CONFIG_NODE_SIZE] = {0};
+int64_t ParticleData::counter_scanned[CONFIG_NODE_SIZE] = {0};
+int64_t ParticleData::counter_migrated[CONFIG_NODE_SIZE] = {0};
 
 //----------------------------------------------------------------------
 
 ParticleData::ParticleData()
   : attribute_array_(),
     attribute_align_(),
-    particle_count_()
+    particle_count_(),
+    position_extent_()
 {
   ++counter[cello::index_static()];
 }
@@ -53,6 +57,24 @@ ParticleData::~ParticleData()
 char * ParticleData::attribute_array (ParticleDescr * particle_descr,
 				      int it,int ia,int ib)
 {
+  char * array = attribute_array_at_(particle_descr,it,ia,ib);
+
+  // the caller may move the particles, so forget the batch's extent
+
+  if (array && ((int)position_extent_.size() > it) &&
+      (ia == particle_descr->attribute_position(it,0) ||
+       ia == particle_descr->attribute_position(it,1) ||
+       ia == particle_descr->attribute_position(it,2))) {
+    clear_position_extent_(it,ib);
+  }
+  return array;
+}
+
+//----------------------------------------------------------------------
+
+char * ParticleData::attribute_array_at_ (ParticleDescr * particle_descr,
+					  int it,int ia,int ib)
+{
 
   bool in_range =        (0 <= it && it < particle_descr->num_types());
   in_range = in_range && (0 <= ia && ia < particle_descr->num_attributes(it));
@@ -584,6 +606,75 @@ void ParticleData::compress (ParticleDescr * particle_descr, int it)
   // deallocate empty batches?
 }
 
+//----------------------------------------------------------------------
+
+void ParticleData::sort
+(ParticleDescr * particle_descr, int it, const int * key, int num_keys)
+{
+  const int np = num_particles(particle_descr,it);
+  const int mb = particle_descr->batch_size();
+  const int na = particle_descr->num_attributes(it);
+
+  const bool interleaved = particle_descr->interleaved(it);
+
+  // count particles with each key, and compute the destination
+  // offset of the first particle with each key
+
+  std::vector<int> offset(num_keys+1,0);
+  for (int i=0; i<np; i++) {
+    ASSERT3("ParticleData::sort()",
+	    "Particle %d key %d out of range [0,%d)",
+	    i,key[i],num_keys,
+	    (0 <= key[i] && key[i] < num_keys));
+    ++offset[key[i]+1];
+  }
+  for (int k=0; k<num_keys; k++) {
+    offset[k+1] += offset[k];
+  }
+
+  // move existing batches aside and allocate compressed batches
+
+  std::vector< std::vector<char> > array_src;
+  std::vector< char > align_src;
+  std::swap(array_src,attribute_array_[it]);
+  std::swap(align_src,attribute_align_[it]);
+  const std::vector<int> count_src = particle_count_[it];
+
+  const int nb_dst = (np + mb - 1) / mb;
+  attribute_array_[it].resize(nb_dst);
+  attribute_align_[it].resize(nb_dst);
+  particle_count_ [it].resize(nb_dst);
+  for (int ib=0; ib<nb_dst; ib++) {
+    resize_attribute_array_(particle_descr,it,ib,std::min(mb,np-ib*mb));
+  }
+
+  // copy each particle's attributes to its sorted position, keeping
+  // particles with equal keys in their original order
+
+  std::vector<int> next(offset.begin(),offset.end()-1);
+
+  int mp = particle_descr->particle_bytes(it);
+  int i = 0;
+  for (size_t ib_src=0; ib_src<count_src.size(); ib_src++) {
+    char * batch_src = array_src[ib_src].data() + align_src[ib_src];
+    for (int ip_src=0; ip_src<count_src[ib_src]; ip_src++,i++) {
+      const int i_dst = next[key[i]]++;
+      const int ib_dst = i_dst / mb;
+      const int ip_dst = i_dst % mb;
+      for (int ia=0; ia<na; ia++) {
+	if (!interleaved) {
+	  mp = particle_descr->attribute_bytes(it,ia);
+	}
+	const int ny = particle_descr->attribute_bytes(it,ia);
+	const char * a_src =
+	  batch_src + particle_descr->attribute_offset(it,ia);
+	char * a_dst = attribute_array(particle_descr,it,ia,ib_dst);
+	std::copy_n(a_src + mp*ip_src, ny, a_dst + mp*ip_dst);
+      }
+    }
+  }
+}
+
 
 //----------------------------------------------------------------------
 
@@ -758,13 +849,66 @@ void ParticleData::position_update
 
 //----------------------------------------------------------------------
 
+void ParticleData::set_position_extent
+(int it, int ib, const double lower[3], const double upper[3])
+{
+  if ((int)position_extent_.size() <= it) {
+    position_extent_.resize(it+1);
+  }
+  std::vector<double> & extent = position_extent_[it];
+  if ((int)extent.size() < 6*(ib+1)) {
+    // other new batches have no extent
+    size_t i = extent.size();
+    extent.resize(6*(ib+1));
+    for (; i<extent.size(); i+=2) {
+      extent[i]   = std::numeric_limits<double>::max();
+      extent[i+1] = std::numeric_limits<double>::lowest();
+    }
+  }
+  for (int axis=0; axis<3; axis++) {
+    extent[6*ib + 2*axis]     = lower[axis];
+    extent[6*ib + 2*axis + 1] = upper[axis];
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool ParticleData::position_extent
+(int it, int ib, double lower[3], double upper[3]) const
+{
+  if ((int)position_extent_.size() <= it) return false;
+  const std::vector<double> & extent = position_extent_[it];
+  if ((int)extent.size() < 6*(ib+1)) return false;
+  for (int axis=0; axis<3; axis++) {
+    lower[axis] = extent[6*ib + 2*axis];
+    upper[axis] = extent[6*ib + 2*axis + 1];
+    if (lower[axis] > upper[axis]) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::clear_position_extent_ (int it, int ib)
+{
+  if ((int)position_extent_.size() <= it) return;
+  std::vector<double> & extent = position_extent_[it];
+  if ((int)extent.size() < 6*(ib+1)) return;
+  for (int axis=0; axis<3; axis++) {
+    extent[6*ib + 2*axis]     = std::numeric_limits<double>::max();
+    extent[6*ib + 2*axis + 1] = std::numeric_limits<double>::lowest();
+  }
+}
+
+//----------------------------------------------------------------------
+
 void ParticleData::copy_attribute_float_
 (ParticleDescr * particle_descr,
  int type, int it, int ib, int ia, double * coord)
 {
 
   const int dx = particle_descr->stride(it,ia);
-  const char * array = attribute_array(particle_descr,it,ia,ib);
+  const char * array = attribute_array_at_(particle_descr,it,ia,ib);
   const int np = num_particles(particle_descr,it,ib);
   if (type == type_float) {
     const float * array_f = (float *) array;
@@ -813,7 +957,7 @@ void ParticleData::copy_position_int_
  int type, int it, int ib, int ia, double * coord)
 {
   const int dx = particle_descr->stride(it,ia);
-  const char * array = attribute_array(particle_descr,it,ia,ib);
+  const char * array = attribute_array_at_(particle_descr,it,ia,ib);
   const int np = num_particles(particle_descr,it,ib);
   if (type == type_int8) {
     const int8_t * array_8 = (int8_t *) array;
@@ -1012,6 +1156,7 @@ char * ParticleData::load_data (ParticleDescr * particle_descr,
   attribute_array_.resize(nt);
   attribute_align_.resize(nt);
   particle_count_.resize(nt);
+  position_extent_.clear();
 
   for (int it=0; it<nt; it++) {
 
@@ -1169,6 +1314,8 @@ void ParticleData::resize_attribute_array_
   // store number of particles allocated
   particle_count_[it][ib] = np;
 
+  clear_position_extent_(it,ib);
+
   const int mp = particle_descr->particle_bytes(it);
 
   if (!particle_descr->interleaved(it)) {
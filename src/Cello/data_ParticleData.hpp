@@ -21,6 +21,11 @@ public: // interface
   static int64_t counter[CONFIG_NODE_SIZE];
   static int64_t id_counter[CONFIG_NODE_SIZE];
 
+  /// Number of particles checked, and moved to neighbors, when
+  /// refreshing particles (see Block::particle_scatter_neighbors_())
+  static int64_t counter_scanned[CONFIG_NODE_SIZE];
+  static int64_t counter_migrated[CONFIG_NODE_SIZE];
+
   /// Constructor
   ParticleData();
 
@@ -46,12 +51,14 @@ public: // interface
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
 
-  /// Return the attribute array for the given particle type and batch
+  /// Return the attribute array for the given particle type and
+  /// batch.  Requesting a writable position attribute discards the
+  /// batch's position extent (see set_position_extent())
   char * attribute_array (ParticleDescr *pd, int it, int ia, int ib);
   const char * attribute_array (ParticleDescr *pd, int it, int ia, int ib) const
   {
     return (const char *)
-      ((ParticleData*)this) -> attribute_array (pd,it,ia,ib);
+      ((ParticleData*)this) -> attribute_array_at_ (pd,it,ia,ib);
   }
 
   /// Return the number of batches of particles for the given type.
@@ -106,6 +113,14 @@ public: // interface
   void compress (ParticleDescr *);
   void compress (ParticleDescr *, int it);
 
+  /// Reorder all particles of the given type by key using a stable
+  /// counting sort, permuting all attributes together.  key[i] in
+  /// [0,num_keys) is given for each particle in the current batch
+  /// order.  Batches are compressed, so that particle i is at
+  /// ParticleDescr::index(i).
+
+  void sort (ParticleDescr *, int it, const int * key, int num_keys);
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -158,6 +173,18 @@ public: // interface
 		 int it, int ib,
 		 double * vx, double * vy = 0, double * vz = 0);
 
+  /// Record the extent of the (floating-point) positions in the given
+  /// batch, e.g. as found while updating them.  The extent is kept
+  /// until the batch is resized or its position attributes are
+  /// requested for writing
+  void set_position_extent (int it, int ib,
+			    const double lower[3], const double upper[3]);
+
+  /// Return whether the given batch has a recorded position extent,
+  /// and if so return it in lower[] and upper[]
+  bool position_extent (int it, int ib,
+			double lower[3], double upper[3]) const;
+
   //--------------------------------------------------
 
   /// Return the number of bytes required to serialize the data object
@@ -184,6 +211,12 @@ private: /// functions
 
   /// long long assign_id_ ()
 
+  /// Return the attribute array without discarding the position extent
+  char * attribute_array_at_ (ParticleDescr *, int it, int ia, int ib);
+
+  /// Discard the position extent of the given batch, if any
+  void clear_position_extent_ (int it, int ib);
+
   /// Allocate attribute_array_ block, aligned at 16 byte boundary
   /// with updated attribute_align_
   void resize_attribute_array_ (ParticleDescr *, int it, int ib, int np);
@@ -237,6 +270,10 @@ private: /// attributes
   /// Number of particles in the batch particle_count_[it][ib];
   std::vector < std::vector < int > > particle_count_;
 
+  /// Position extents position_extent_[it][6*ib + 2*axis + (0|1)] of
+  /// batches, with lower > upper if none.  Not copied or packed
+  std::vector < std::vector < double > > position_extent_;
+
 };
 
 #endif /* DATA_PARTICLE_DATA_HPP */
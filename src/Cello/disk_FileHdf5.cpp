@@ -384,6 +384,21 @@ void FileHdf5::data_close() throw()
 
 //----------------------------------------------------------------------
 
+bool FileHdf5::file_meta_exists (std::string name) throw()
+{
+  std::string file_name = path_ + "/" + name_;
+
+  // error check file open
+
+  ASSERT1("FileHdf5::file_meta_exists",
+	  "Trying to query metadata from the unopened file %s",
+	  file_name.c_str(), is_file_open_);
+
+  return (H5Aexists(file_id_, name.c_str()) > 0);
+}
+
+//----------------------------------------------------------------------
+
 void FileHdf5::file_read_scalar
 ( void * buffer, std::string name,  int * type) throw()
 {
@@ -85,6 +85,9 @@ public: // virtual functions
     int n1=1, int n2=0, int n3=0, int n4=0) throw()
   { write_meta_ ( file_id_, buffer, name, type, n1,n2,n3,n4); }
 
+  /// Return whether the file has the given metadata item
+  bool file_meta_exists (std::string name) throw();
+
   // Datasets
 
 /// Create a new dataset for writing (and open it)
@@ -61,6 +61,12 @@ void Main::p_exit(int count)
   }
 }
 
+void Main::p_exit_continue()
+{
+  DEBUG("Main::p_exit_continue");
+  exit_();
+}
+
 void Main::exit_()
 {
 
@@ -68,6 +74,10 @@ void Main::exit_()
 
   EnzoSimulation * simulation = enzo::simulation();
 
+  // don't exit until an asynchronous checkpoint has closed its files
+
+  if (simulation && simulation->check_exit_defer()) return;
+
   const int in = cello::index_static();
   if (EnzoMsgCheck::counter[in] != 0) {
     CkPrintf ("%d Main::exit_() EnzoMsgCheck::counter = %ld != 0\n",
@@ -90,6 +90,10 @@ public:
   /// Exit the program
   void p_exit(int count);
 
+  /// Exit the program after exiting was deferred, e.g. until an
+  /// asynchronous checkpoint has finished writing
+  void p_exit_continue();
+
   void p_checkpoint_output (int count, std::string dir_name);
 
   void p_initial_exit();
@@ -11,6 +11,7 @@
      entry Main(CkArgMsg *m);
 
      entry void p_exit (int count_blocks);
+     entry void p_exit_continue ();
 
      entry void p_checkpoint_output(int count, std::string dir);
 
@@ -0,0 +1,75 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_MemoryPool.cpp
+/// @date     2026-10-17
+/// @brief    [\ref Memory] Implementation of the MemoryPool class
+
+#include "cello.hpp"
+
+#include "memory.hpp"
+
+MemoryPool MemoryPool::instance_[CONFIG_NODE_SIZE];
+
+//======================================================================
+
+void MemoryPool::allocate (std::vector<char> & array, size_t size)
+{
+  if (bytes_limit_ > 0) {
+
+    auto it = free_list_.find(size);
+
+    if (it != free_list_.end() && it->second.size() > 0) {
+
+      // reuse the most recently freed array of this size
+
+      array.swap(it->second.back());
+      it->second.pop_back();
+      bytes_ -= size;
+      ++num_hit_;
+
+      // not cleared: see MemoryPool::allocate()
+
+      return;
+    }
+
+    ++num_miss_;
+  }
+
+  array.resize(size);
+}
+
+//----------------------------------------------------------------------
+
+void MemoryPool::deallocate (std::vector<char> & array)
+{
+  const size_t size = array.size();
+
+  if (size > 0 && (bytes_ + int64_t(size) <= bytes_limit_)) {
+
+    std::vector< std::vector<char> > & list = free_list_[size];
+    list.resize(list.size()+1);
+    list.back().swap(array);
+    bytes_ += size;
+
+  } else {
+
+    array.clear();
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void MemoryPool::set_bytes_limit (int64_t bytes_limit)
+{
+  bytes_limit_ = bytes_limit;
+  if (bytes_ > bytes_limit_) clear();
+}
+
+//----------------------------------------------------------------------
+
+void MemoryPool::clear ()
+{
+  free_list_.clear();
+  bytes_ = 0;
+}
@@ -0,0 +1,91 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_MemoryPool.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Memory] Declaration of the MemoryPool class
+
+#ifndef MEMORY_MEMORY_POOL_HPP
+#define MEMORY_MEMORY_POOL_HPP
+
+class MemoryPool {
+
+  /// @class    MemoryPool
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Per-PE free lists of field arrays
+  ///
+  /// Arrays released by deallocate() are kept in free lists keyed by
+  /// their size, and handed back out by allocate() instead of going
+  /// through the system allocator.  Since Blocks at a given level
+  /// all have the same field layout, arrays freed when Blocks are
+  /// coarsened or refined away can be reused directly by newly
+  /// created Blocks.
+
+public: // interface
+
+  /// Get the MemoryPool object for this PE
+  static MemoryPool * instance()
+  { return & instance_[cello::index_static()]; }
+
+  /// Create an inactive MemoryPool object
+  MemoryPool()
+    : bytes_limit_(0),
+      bytes_(0),
+      num_hit_(0),
+      num_miss_(0),
+      free_list_()
+  { }
+
+  /// Allocate an array of the given size, reusing a free array if one
+  /// is available.  Reused arrays are not cleared, so callers that need
+  /// zeroed values must clear the array themselves
+  void allocate (std::vector<char> & array, size_t size);
+
+  /// Release the array, keeping it for reuse if the pool has room
+  void deallocate (std::vector<char> & array);
+
+  /// Set the maximum number of bytes held in free lists; 0 disables
+  /// the pool
+  void set_bytes_limit (int64_t bytes_limit);
+
+  /// Return the maximum number of bytes held in free lists
+  int64_t bytes_limit () const
+  { return bytes_limit_; }
+
+  /// Return the number of bytes currently held in free lists
+  int64_t bytes () const
+  { return bytes_; }
+
+  /// Return the number of allocations satisfied from free lists
+  int64_t num_hit () const
+  { return num_hit_; }
+
+  /// Return the number of allocations not satisfied from free lists
+  int64_t num_miss () const
+  { return num_miss_; }
+
+  /// Release all arrays held in free lists
+  void clear ();
+
+private: // attributes
+
+  /// Single MemoryPool object per PE
+  static MemoryPool instance_[CONFIG_NODE_SIZE];
+
+  /// Maximum bytes held in free lists
+  int64_t bytes_limit_;
+
+  /// Current bytes held in free lists
+  int64_t bytes_;
+
+  /// Number of allocations reusing a free array
+  int64_t num_hit_;
+
+  /// Number of allocations requiring a new array
+  int64_t num_miss_;
+
+  /// Free arrays indexed by size
+  std::map<size_t, std::vector< std::vector<char> > > free_list_;
+
+};
+
+#endif /* MEMORY_MEMORY_POOL_HPP */
@@ -45,6 +45,12 @@ Block::Block ( process_type ip_source, MsgType msg_type )
     time_(0.0),
     dt_(0.0),
     stop_(false),
+    dt_subcycle_(0.0),
+    subcycle_step_(true),
+    subcycle_synced_(true),
+    subcycle_shifted_(false),
+    subcycle_time_(0.0),
+    subcycle_dt_(0.0),
     index_initial_(0),
     children_(),
     sync_coarsen_(),
@@ -308,6 +314,12 @@ void Block::pup(PUP::er &p)
   p | time_;
   p | dt_;
   p | stop_;
+  p | dt_subcycle_;
+  p | subcycle_step_;
+  p | subcycle_synced_;
+  p | subcycle_shifted_;
+  p | subcycle_time_;
+  p | subcycle_dt_;
   p | index_initial_;
   p | children_;
   p | sync_coarsen_;
@@ -658,6 +670,12 @@ Block::Block ()
     time_(0.0),
     dt_(0.0),
     stop_(false),
+    dt_subcycle_(0.0),
+    subcycle_step_(true),
+    subcycle_synced_(true),
+    subcycle_shifted_(false),
+    subcycle_time_(0.0),
+    subcycle_dt_(0.0),
     index_initial_(0),
     children_(),
     sync_coarsen_(),
@@ -1098,6 +1116,9 @@ void Block::copy_(const Block & block) throw()
   time_       = block.time_;
   dt_         = block.dt_;
   stop_       = block.stop_;
+  dt_subcycle_ = block.dt_subcycle_;
+  subcycle_step_ = block.subcycle_step_;
+  subcycle_synced_ = block.subcycle_synced_;
   adapt_step_ = block.adapt_step_;
   adapt_ready_ = block.adapt_ready_;
   adapt_balanced_ = block.adapt_balanced_;
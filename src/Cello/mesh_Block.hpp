@@ -11,6 +11,7 @@
 
 class Data;
 class MsgRefresh;
+class MsgRefreshAggregate;
 class MsgRefine;
 class MsgCoarsen;
 class FieldFace;
@@ -124,6 +125,11 @@ public: // interface
   bool stop() const throw()
   { return stop_; };
 
+  /// Return whether subcycled Methods are applied to the Block this
+  /// cycle (always true unless Stopping:subcycle is enabled)
+  bool subcycle_step() const throw()
+  { return subcycle_step_; };
+
   /// Return whether this Block is a leaf in the octree array
   bool is_leaf() const
   { return is_leaf_; }
@@ -371,6 +377,10 @@ protected: // methods
   void compute_continue_();
   /// Cleanup after all Methods have been applied
   void compute_end_();
+  /// Return whether all levels must be stepped this cycle
+  bool subcycle_sync_();
+  /// Sort particles of each type by the active cell containing them
+  void particle_sort_by_cell_();
   /// Exit control compute phase
   void compute_exit_();
 
@@ -611,13 +621,13 @@ public:
 
   void r_method_order_morton_continue(CkReductionMsg * msg);
   void r_method_order_morton_complete(CkReductionMsg * msg);
-  void p_method_order_morton_weight(int ic3[3], int weight, Index index);
-  void p_method_order_morton_index(int index, int count);
+  void p_method_order_morton_weight(int ic3[3], int weight, double cost, Index index);
+  void p_method_order_morton_index(int index, int count, double cost_index, double cost_total);
 
   void r_method_order_hilbert_continue(CkReductionMsg * msg);
   void r_method_order_hilbert_complete(CkReductionMsg * msg);
-  void p_method_order_hilbert_weight(int ic3[3], int weight, Index index);
-  void p_method_order_hilbert_index(int index, int count);
+  void p_method_order_hilbert_weight(int ic3[3], int weight, double cost, Index index);
+  void p_method_order_hilbert_index(int index, int count, double cost_index, double cost_total);
 
   void p_method_output_next (MsgOutput * msg);
   void p_method_output_write (MsgOutput * msg);
@@ -653,6 +663,16 @@ protected:
   /// Apply prolongation operations on Block
   void refresh_coarse_apply_(Refresh * refresh);
 
+  /// Send a refresh message to the given neighbor, or hold it for
+  /// aggregation with other messages to the same process if
+  /// Refresh:aggregate is true
+  void refresh_send_ (Index index, MsgRefresh * msg_refresh);
+
+  /// Copy field face data directly into a neighbor Block on this PE
+  /// if possible, returning false if a message must be sent instead
+  bool refresh_copy_local_
+  (Refresh & refresh, Index index_neighbor, FieldFace * field_face);
+
   /// Scatter particles in ghost zones to neighbors
   int refresh_load_particle_faces_ (Refresh * refresh);
 
@@ -965,6 +985,23 @@ protected: // attributes
 
   /// Current stopping criteria
   bool stop_;
+
+  /// Time accumulated over cycles in which subcycled Methods were
+  /// not applied to the Block
+  double dt_subcycle_;
+
+  /// Whether subcycled Methods are applied to the Block this cycle
+  bool subcycle_step_;
+
+  /// Whether all levels were stepped in the last compute phase
+  bool subcycle_synced_;
+
+  /// Whether time_ and dt_ are shifted to span the subcycled step
+  bool subcycle_shifted_;
+
+  /// Unshifted time_ and dt_ while applying a subcycled Method
+  double subcycle_time_;
+  double subcycle_dt_;
   
   //--------------------------------------------------
 
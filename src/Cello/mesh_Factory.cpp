@@ -66,7 +66,10 @@ CProxy_Block Factory::new_block_proxy
 
   CProxy_Block proxy_block;
 
-  CProxy_MappingArray array_map  = CProxy_MappingArray::ckNew(nbx,nby,nbz);
+  const int mapping =
+    MappingArray::mapping_type(cello::config()->mesh_root_mapping);
+  CProxy_MappingArray array_map  =
+    CProxy_MappingArray::ckNew(nbx,nby,nbz,mapping);
 
   CkArrayOptions opts;
   opts.setMap(array_map);
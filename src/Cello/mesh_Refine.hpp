@@ -64,6 +64,11 @@ public: // interface
   /// Clear the output field to the default coarsen (-1)
   void * initialize_output_(FieldData * field_data);
 
+  /// Whether the criteria writes to an output field, and so must be
+  /// evaluated even if the Block's adapt result is already known
+  bool has_output() const
+  { return output_ != ""; }
+
   /// Return the Schedule object pointer
   Schedule * schedule() throw() 
   { return schedule_; }
@@ -79,15 +79,20 @@ int RefineDensity::apply_
   int gx, int gy, int gz ) const throw ()
 {
 
+  // Reduce the maximum density row by row, stopping once refining is
+  // certain
+
   bool any_refine  = false;
   bool all_coarsen = true;
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
+  for (int iz=gz; iz<mz-gz && ! any_refine; iz++) {
+    for (int iy=gy; iy<my-gy && ! any_refine; iy++) {
+      const T * row = array + mx*(iy + my*iz);
+      T value_max = row[gx];
       for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] > max_coarsen_) all_coarsen = false;
+	value_max = std::max(value_max,row[ix]);
       }
+      if (value_max > min_refine_)  any_refine  = true;
+      if (value_max > max_coarsen_) all_coarsen = false;
     }
   }
   return 
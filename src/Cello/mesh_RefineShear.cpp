@@ -126,8 +126,12 @@ void RefineShear::evaluate_block_(const T * u,
   T min_shear = std::numeric_limits<T>::max();
   T max_shear = -std::numeric_limits<T>::max();
 #endif
+  // Reduce the maximum shear row by row; without an output field,
+  // stop once refining is certain
+
   for (int iz=gz; iz<nz+gz; iz++) {
     for (int iy=gy; iy<ny+gy; iy++) {
+      T shear_max = 0;
       for (int ix=gx; ix<nx+gx; ix++) {
 	int i = ix + ndx*(iy + ndy*iz);
 	if (rank >= 2) {
@@ -145,13 +149,17 @@ void RefineShear::evaluate_block_(const T * u,
 	min_shear = std::min(min_shear,shear);
 	max_shear = std::max(max_shear,shear);
 #endif
-	if (shear > min_refine_)  *any_refine  = true;
-	if (shear > max_coarsen_) *all_coarsen = false;
+	shear_max = std::max(shear_max,shear);
 	if (output) {
 	  if (shear > max_coarsen_) output[i] =  0;
 	  if (shear > min_refine_)  output[i] = +1;
 	}
       }
+      if (shear_max > min_refine_)  *any_refine  = true;
+      if (shear_max > max_coarsen_) *all_coarsen = false;
+#ifndef TRACE_REFINE_SHEAR
+      if (*any_refine && ! output) return;
+#endif
     }
   }
 #ifdef TRACE_REFINE_SHEAR
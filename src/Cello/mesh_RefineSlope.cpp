@@ -56,6 +56,9 @@ int RefineSlope::apply ( Block * block ) throw ()
 
   for (size_t k=0; k<field_id_list_.size(); k++) {
 
+    // refinement is already certain
+    if (any_refine && ! output) break;
+
     int id_field = field_id_list_[k];
 
     int gx,gy,gz;
@@ -123,27 +126,35 @@ void RefineSlope::evaluate_block_(T * array, T * output ,
 				  int rank, 
 				  double * h3 )
 {
-  T slope;
+  // Single pass over rows of cells, applying all axes to each row
+  // while it is in cache.  Only the maximum slope is needed to decide
+  // refine / coarsen, so the inner loops are branch-free reductions,
+  // and without an output field the sweep stops once refining is
+  // certain.
+
   const int d3[3] = {1,mx,mx*my};
-  T tiny = 1e-10;
-  int count=0;
-  for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
+  const T tiny = 1e-10;
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      const int i0 = mx*(iy + my*iz);
+      T slope_max = 0;
+      for (int axis=0; axis<rank; axis++) {
+	const int id = d3[axis];
+	const double h2 = 2.0*h3[axis];
 	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
-	  slope = fabs( (array[i+id] - array[i-id]) / a);
-	  count++;
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
+	  const int i = i0 + ix;
+	  const T a = std::max(T(h2*fabs(array[i])),tiny);
+	  const T slope = fabs( (array[i+id] - array[i-id]) / a);
+	  slope_max = std::max(slope_max,slope);
 	  if (output) {
 	    if (slope > max_coarsen_) output[i] =  0;
 	    if (slope > min_refine_)  output[i] = +1;
 	  }
 	}
       }
+      if (slope_max > min_refine_)  *any_refine  = true;
+      if (slope_max > max_coarsen_) *all_coarsen = false;
+      if (*any_refine && ! output) return;
     }
   }
 }
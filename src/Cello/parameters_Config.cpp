@@ -99,11 +99,13 @@ void Config::pup (PUP::er &p)
   p | memory_active;
   p | memory_warning_mb;
   p | memory_limit_gb;
+  p | memory_pool_mb;
 
   // Mesh
 
   PUParray(p,mesh_root_blocks,3);
   p | mesh_root_rank;
+  p | mesh_root_mapping;
   PUParray(p,mesh_root_size,3);
   p | mesh_min_level;
   p | mesh_max_level;
@@ -118,6 +120,7 @@ void Config::pup (PUP::er &p)
   p | method_list;
   p | method_schedule_index;
   p | method_courant;
+  p | method_subcycle;
   p | method_type;
 
   // Monitor
@@ -180,6 +183,7 @@ void Config::pup (PUP::er &p)
   PUParray (p,particle_attribute_position,3);
   PUParray (p,particle_attribute_velocity,3);
   p | particle_batch_size;
+  p | particle_sort_interval;
   p | particle_group_list;
 
   // Performance
@@ -195,6 +199,11 @@ void Config::pup (PUP::er &p)
   p | num_physics;
   p | physics_list;
 
+  // Refresh
+
+  p | refresh_aggregate;
+  p | refresh_local_copy;
+
   // Solvers
   
   p | num_solvers;
@@ -219,6 +228,8 @@ void Config::pup (PUP::er &p)
   p | stopping_time;
   p | stopping_seconds;
   p | stopping_interval;
+  p | stopping_subcycle;
+  p | stopping_subcycle_max_levels;
 
   // Testing
 
@@ -248,6 +259,7 @@ void Config::read(Parameters * p) throw()
   read_particle_(p);
   read_performance_(p);
   read_physics_(p);
+  read_refresh_(p);
   read_stopping_(p);
   read_testing_(p);
   read_units_(p);
@@ -644,6 +656,7 @@ void Config::read_memory_ (Parameters * p) throw()
   memory_active = p->value_logical("Memory:active",true);
   memory_warning_mb =  p->value_float("Memory:warning_mb",0.0);
   memory_limit_gb =    p->value_float("Memory:limit_gb",0.0);
+  memory_pool_mb =     p->value_float("Memory:pool_mb",0.0);
 }
 
 //----------------------------------------------------------------------
@@ -690,6 +703,15 @@ void Config::read_mesh_ (Parameters * p) throw()
 	    mx,my,mz,CkNumPes());
   }
 
+  mesh_root_mapping = p->value_string("Mesh:root_mapping","linear");
+
+  ASSERT1 ("Config::read_mesh_()",
+           "Mesh:root_mapping %s must be \"linear\", \"morton\", or \"hilbert\"",
+           mesh_root_mapping.c_str(),
+           (mesh_root_mapping == "linear" ||
+            mesh_root_mapping == "morton" ||
+            mesh_root_mapping == "hilbert"));
+
   //--------------------------------------------------
 
   mesh_root_size[0] = p->list_value_integer(0,"Mesh:root_size",1);
@@ -834,6 +856,7 @@ void Config::read_method_ (Parameters * p) throw()
 
   method_list.   resize(num_method);
   method_courant.resize(num_method);
+  method_subcycle.resize(num_method);
   method_schedule_index.resize(num_method);
   method_type.resize(num_method);
   
@@ -866,6 +889,11 @@ void Config::read_method_ (Parameters * p) throw()
     // Read courant condition if any
     method_courant[index_method] = p->value_float  (full_name + ":courant",1.0);
 
+    // Read whether the method advances with its own level's time
+    // step when Stopping:subcycle is enabled
+    method_subcycle[index_method] = p->value_logical
+      (full_name + ":subcycle",false);
+
     method_type[index_method] = p->value_string
       (full_name + ":type", name);
   }
@@ -1138,6 +1166,7 @@ void Config::read_particle_ (Parameters * p) throw()
   //--------------------------------------------------
 
   particle_batch_size = p->value_integer("Particle:batch_size",1024);
+  particle_sort_interval = p->value_integer("Particle:sort_interval",0);
 
   num_particles = p->list_length("Particle:list"); 
 
@@ -1406,6 +1435,18 @@ void Config::read_physics_ (Parameters * p) throw()
 
 //----------------------------------------------------------------------
 
+void Config::read_refresh_ (Parameters * p) throw()
+{
+  //--------------------------------------------------
+  // Refresh
+  //--------------------------------------------------
+
+  refresh_aggregate = p->value_logical("Refresh:aggregate",false);
+  refresh_local_copy = p->value_logical("Refresh:local_copy",false);
+}
+
+//----------------------------------------------------------------------
+
 void Config::read_solver_ (Parameters * p) throw()
 {
   //--------------------------------------------------
@@ -1505,6 +1546,30 @@ void Config::read_stopping_ (Parameters * p) throw()
   }
 
   stopping_interval = p->value_integer ( "Stopping:interval" , 1);
+
+  // Level-based time stepping: subcycled methods on coarser levels
+  // advance with up to 2^subcycle_max_levels times the finest time step
+
+  stopping_subcycle = p->value_logical ( "Stopping:subcycle" , false);
+  stopping_subcycle_max_levels = p->value_integer
+    ( "Stopping:subcycle_max_levels" , 4);
+
+  ASSERT1 ("Config::read_stopping_",
+           "Stopping:subcycle_max_levels = %d must be between 0 and 16",
+           stopping_subcycle_max_levels,
+           (0 <= stopping_subcycle_max_levels &&
+            stopping_subcycle_max_levels <= 16));
+
+  // Finer Blocks use the coarse values from the last coarse step in
+  // their ghost zones, so subcycling is first-order in time at level
+  // jumps
+
+  if (stopping_subcycle) {
+    WARNING ("Config::read_stopping_",
+             "Stopping:subcycle is enabled: coarse ghost zones are not "
+             "interpolated in time, so the solution is only first-order "
+             "accurate in time at level jumps");
+  }
 }
 
 void Config::read_units_ (Parameters * p) throw()
@@ -72,7 +72,9 @@ public: // interface
     memory_active(false),
     memory_warning_mb(0.0),
     memory_limit_gb(0.0),
+    memory_pool_mb(0.0),
     mesh_root_rank(0),
+    mesh_root_mapping(),
     mesh_min_level(0),
     mesh_max_level(0),
     mesh_max_initial_level(0),
@@ -83,6 +85,7 @@ public: // interface
     method_list(),
     method_schedule_index(),
     method_courant(),
+    method_subcycle(),
     method_type(),
     monitor_debug(false),
     monitor_verbose(false),
@@ -132,6 +135,7 @@ public: // interface
     particle_attribute_name(),
     particle_attribute_type(),
     particle_batch_size(0),
+    particle_sort_interval(0),
     particle_group_list(),
     performance_papi_counters(),
     performance_projections_on_at_start(true),
@@ -140,6 +144,8 @@ public: // interface
     performance_off_schedule_index(-1),
     num_physics(0),
     physics_list(),
+    refresh_aggregate(false),
+    refresh_local_copy(false),
     num_solvers(),
     solver_list(),
     solver_index(),
@@ -159,6 +165,8 @@ public: // interface
     stopping_time(0.0),
     stopping_seconds(0.0),
     stopping_interval(0),
+    stopping_subcycle(false),
+    stopping_subcycle_max_levels(0),
     units_mass(1.0),
     units_density(1.0),
     units_length(1.0),
@@ -224,7 +232,9 @@ public: // interface
       memory_active(false),
       memory_warning_mb(0.0),
       memory_limit_gb(0.0),
+      memory_pool_mb(0.0),
       mesh_root_rank(0),
+      mesh_root_mapping(),
       mesh_min_level(0),
       mesh_max_level(0),
       mesh_max_initial_level(0),
@@ -235,6 +245,7 @@ public: // interface
       method_list(),
       method_schedule_index(),
       method_courant(),
+      method_subcycle(),
       method_type(),
       monitor_debug(false),
       monitor_verbose(false),
@@ -284,6 +295,7 @@ public: // interface
       particle_attribute_name(),
       particle_attribute_type(),
       particle_batch_size(0),
+      particle_sort_interval(0),
       particle_group_list(),
       performance_papi_counters(),
       performance_projections_on_at_start(true),
@@ -292,6 +304,8 @@ public: // interface
       performance_off_schedule_index(-1),
       num_physics(0),
       physics_list(),
+      refresh_aggregate(false),
+      refresh_local_copy(false),
       num_solvers(),
       solver_list(),
       solver_index(),
@@ -311,6 +325,8 @@ public: // interface
       stopping_time(0.0),
       stopping_seconds(0.0),
       stopping_interval(0),
+      stopping_subcycle(false),
+      stopping_subcycle_max_levels(0),
       // Units
       units_mass(1.0),
       units_density(1.0),
@@ -418,11 +434,13 @@ public: // attributes
   bool                       memory_active;
   double                     memory_warning_mb;
   double                     memory_limit_gb;
+  double                     memory_pool_mb;
 
   // Mesh
 
   int                        mesh_root_blocks[3];
   int                        mesh_root_rank;
+  std::string                mesh_root_mapping;
   int                        mesh_root_size[3];
   int                        mesh_min_level;
   int                        mesh_max_level;
@@ -437,6 +455,7 @@ public: // attributes
   std::vector<std::string>   method_list;
   std::vector<int>           method_schedule_index;
   std::vector<double>        method_courant;
+  std::vector<char>          method_subcycle;
   std::vector<std::string>   method_type;
 
 
@@ -503,6 +522,7 @@ public: // attributes
   std::vector <int>          particle_attribute_velocity[3];
 
   int                        particle_batch_size;
+  int                        particle_sort_interval;
   std::vector< std::vector<std::string> >  particle_group_list;
 
   // Performance
@@ -518,6 +538,11 @@ public: // attributes
   int                        num_physics;  // number of physics objects
   std::vector<std::string>   physics_list;
 
+  // Refresh
+
+  bool                       refresh_aggregate;
+  bool                       refresh_local_copy;
+
   // Solvers
 
   int                        num_solvers;
@@ -542,6 +567,8 @@ public: // attributes
   double                     stopping_time;
   double                     stopping_seconds;
   int                        stopping_interval;
+  bool                       stopping_subcycle;
+  int                        stopping_subcycle_max_levels;
 
   /// Units
 
@@ -572,6 +599,7 @@ protected: // functions
   void read_particle_    ( Parameters * ) throw();
   void read_performance_ ( Parameters * ) throw();
   void read_physics_     ( Parameters * ) throw();
+  void read_refresh_     ( Parameters * ) throw();
   void read_solver_      ( Parameters * ) throw();
   void read_stopping_    ( Parameters * ) throw();
   void read_testing_     ( Parameters * ) throw();
@@ -90,10 +90,10 @@ void Param::pup (PUP::er &p)
 	p | *(*value_list_)[i];
       }
     }
-  } else if (type_ == parameter_logical_expr) {
-    pup_expr_(p,&value_expr_);
-  } else if (type_ == parameter_float_expr) {
+  } else if (type_ == parameter_logical_expr ||
+             type_ == parameter_float_expr) {
     pup_expr_(p,&value_expr_);
+    if (up) compile_expr_();
   } else if (type_ == parameter_unknown) {
     WARNING("Param::pup","parameter type is unknown");
   }
@@ -217,6 +217,8 @@ void Param::dealloc_()
   case parameter_logical_expr:
   case parameter_float_expr:
     dealloc_node_expr_(value_expr_);
+    delete value_program_;
+    value_program_ = NULL;
     break;
   case parameter_unknown:
   case parameter_integer:
@@ -321,9 +323,7 @@ void Param::evaluate_float
  double *           x, 
  double *           y, 
  double *           z, 
- double             t,
- struct node_expr * node)
-/// @param node Head node of the tree defining the floating-point expression
+ double             t)
 /// @param n Length of the result buffer
 /// @param result Array in which to store the expression evaluations
 /// @param x Array of X spatial values
@@ -331,89 +331,8 @@ void Param::evaluate_float
 /// @param z Array of Z spatial values
 /// @param t time value
 {
-  if (node == 0) node = value_expr_;
-
-  double * left  = NULL;
-  double * right = NULL;
-
   value_accessed_ = true;
-
-  if (node->left) {
-    left = new double [n];
-    evaluate_float(n,left,x,y,z,t,node->left);
-  }
-  if (node->right) {
-    right = new double [n];
-    evaluate_float(n,right,x,y,z,t,node->right);
-  }
-  
-  int i;
-  switch (node->type) {
-  case enum_node_operation:
-    ASSERT("Param::evaluate_float()",
-           "node is NULL",
-           (node != NULL));
-    ASSERT3("Param::evaluate_float()",
-	    "Error in operation %d: left %p right %p",
-	    node ? node->op_value:-1,left,right,
-	    ((left != NULL) && (right != NULL)));
-    switch (node->op_value) {
-    case enum_op_add: for (i=0; i<n; i++) result[i] = left[i] + right[i]; break;
-    case enum_op_sub: for (i=0; i<n; i++) result[i] = left[i] - right[i]; break;
-    case enum_op_mul: for (i=0; i<n; i++) result[i] = left[i] * right[i]; break;
-    case enum_op_div: for (i=0; i<n; i++) result[i] = left[i] / right[i]; break;
-    case enum_op_pow: for (i=0; i<n; i++) result[i] = pow(left[i], right[i]); break;
-    default:
-    case enum_op_le:
-    case enum_op_lt:
-    case enum_op_ge:
-    case enum_op_gt:
-    case enum_op_eq:
-    case enum_op_ne:
-    case enum_op_and:
-    case enum_op_or:
-      ERROR1("Param::evaluate_float",
-	     "logical operator %d in floating-point expression",
-	     node->op_value);
-      break;
-    }
-    break;
-  case enum_node_float:
-    for (i=0; i<n; i++) result[i] = node->float_value;
-    break;
-  case enum_node_integer:
-    for (i=0; i<n; i++) result[i] = double(node->integer_value);
-    break;
-  case enum_node_variable:
-    switch (node->var_value) {
-    case 'x': if (x) for (i=0; i<n; i++) result[i] = x[i]; break;
-    case 'y': if (y) for (i=0; i<n; i++) result[i] = y[i]; break;
-    case 'z': if (z) for (i=0; i<n; i++) result[i] = z[i]; break;
-    case 't': for (i=0; i<n; i++) result[i] = t;    break;
-    default:
-      ERROR1("Param::evaluate_float",
-	     "unknown variable %c in floating-point expression",
-	     node->var_value);
-      break;
-    }
-    break;
-  case enum_node_function:
-    ASSERT2("Param::evaluate_float()",
-	    "Error in function %p: left %p",
-	    node?node->fun_value : NULL, left,
-	    left != NULL);
-    for (i=0; i<n; i++) result[i] = (*(node->fun_value))(left[i]);
-    break;
-  case enum_node_unknown:
-  default:
-    ERROR1("Param::evaluate_float",
-	   "unknown expression type %d",
-	   node->type);
-    break;
-  }
-
-  delete [] left;
-  delete [] right;
+  value_program_->evaluate_float(n,result,x,y,z,t);
 }
 
 //----------------------------------------------------------------------
@@ -424,119 +343,16 @@ void Param::evaluate_logical
  double *           x, 
  double *           y, 
  double *           z, 
- double             t,
- struct node_expr * node)
-/// @param node Head node of the tree defining the floating-point expression
+ double             t)
 /// @param n Length of the result buffer
 /// @param result Array in which to store the expression evaluations
 /// @param x Array of X spatial values
 /// @param y Array of Y spatial values
 /// @param z Array of Z spatial values
-/// @param t Array of time values
+/// @param t time value
 {
-  if (node == 0) node = value_expr_;
-
-  double * left_float  = NULL;
-  double * right_float = NULL;
-  bool * left_logical  = NULL;
-  bool * right_logical = NULL;
-
   value_accessed_ = true;
-
-  // Recurse on left subtree
-
-  if (node->left && (node->left->type == enum_node_operation)) {
-    // left node is an operation
-    if ((node->op_value == enum_op_and) || 
-	(node->op_value == enum_op_or)) {
-      // left node is a logical operation
-      left_logical = new bool [n];
-      evaluate_logical(n,left_logical,x,y,z,t,node->left);
-    } else {
-      // left node is a floating-point operation
-      left_float = new double [n];
-      evaluate_float(n,left_float,x,y,z,t,node->left);
-    }
-  } else {
-    // left node is a floating-point operation
-    left_float = new double [n];
-    evaluate_float(n,left_float,x,y,z,t,node->left);
-  }
-
-  // Recurse on left subtree
-
-  if (node->right && (node->right->type == enum_node_operation)) {
-    // right node exists
-    // right node is an operation
-    if ((node->op_value == enum_op_and) || 
-	(node->op_value == enum_op_or)) {
-      // right node is a logical operation
-      right_logical = new bool [n];
-      evaluate_logical(n,right_logical,x,y,z,t,node->right);
-    } else {
-      // right node is a floating-point operation
-      right_float = new double [n];
-      evaluate_float(n,right_float,x,y,z,t,node->right);
-    }
-  } else {
-    // right node is a floating-point operation
-    right_float = new double [n];
-    evaluate_float(n,right_float,x,y,z,t,node->right);
-  }
-      
-  int i;
-  if (node->type == enum_node_operation) {
-    int op = node->op_value;
-    ASSERT3("Param::evaluate_logical()",
-	    "Error in operation %d: left_float %p right_float %p",
-	    op,left_float,right_float,
-	    (op==enum_op_and || op==enum_op_or) ||
-	    (left_float != NULL && right_float != NULL));
-    ASSERT3("Param::evaluate_logical()",
-	    "Error in operation %d: left_logical %p right_logical %p",
-	    op,left_logical,right_logical,
-	    (op!=enum_op_and && op!=enum_op_or) ||
-	    (left_logical != NULL && right_logical != NULL));
-	    
-    switch (op) {
-    case enum_op_le:
-      for (i=0; i<n; i++) result[i] = left_float[i] <= right_float[i];
-      break;
-    case enum_op_lt:
-      for (i=0; i<n; i++) result[i] = left_float[i] <  right_float[i];
-      break;
-    case enum_op_ge:
-      for (i=0; i<n; i++) result[i] = left_float[i] >= right_float[i];
-      break;
-    case enum_op_gt:
-      for (i=0; i<n; i++) result[i] = left_float[i] >  right_float[i];
-      break;
-    case enum_op_eq:
-      // warning: comparing equality of doubles
-      for (i=0; i<n; i++) result[i] = left_float[i] == right_float[i];
-      break;
-    case enum_op_ne:
-      // warning: comparing inequality of doubles
-      for (i=0; i<n; i++) result[i] = left_float[i] != right_float[i];
-      break;
-    case enum_op_and:
-      for (i=0; i<n; i++) result[i] = left_logical[i] && right_logical[i];
-      break;
-    case enum_op_or:
-      for (i=0; i<n; i++) result[i] = left_logical[i] || right_logical[i];
-      break;
-    default:
-      ERROR1("Param::evaluate_logical",
-	     "unknown expression type %d",
-	     node->type);
-      break;
-    }
-  }
-
-  delete [] left_float;
-  delete [] right_float;
-  delete [] left_logical;
-  delete [] right_logical;
+  value_program_->evaluate_logical(n,result,x,y,z,t);
 }
 
 //----------------------------------------------------------------------
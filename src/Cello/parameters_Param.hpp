@@ -59,7 +59,8 @@ public: // interface
   /// Initialize a Param object
   Param () 
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      value_program_(NULL)
   {};
 
   /// Delete a Param object
@@ -69,7 +70,8 @@ public: // interface
   /// Copy constructor
   Param(const Param & param) throw()
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      value_program_(NULL)
   { INCOMPLETE("Param::Param"); };
 
   /// Assignment operator
@@ -87,8 +89,7 @@ public: // interface
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0 );
+    double             t);
 
   /// Evaluate a logical expression given vectos x,y,z,t
   void evaluate_logical  
@@ -97,8 +98,7 @@ public: // interface
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0);
+    double             t);
 
   /// Set the parameter type and value
   void set(struct param_struct * param);
@@ -195,6 +195,7 @@ private: // functions
   { 
     type_ = parameter_float_expr;
     value_expr_     = value; 
+    compile_expr_();
   };
 
   /// Set a logical expression parameter
@@ -202,8 +203,18 @@ private: // functions
   { 
     type_ = parameter_logical_expr;
     value_expr_     = value; 
+    compile_expr_();
   };
 
+  /// Compile the expression, so that evaluation only reads the
+  /// compiled program
+  void compile_expr_ ()
+  {
+    delete value_program_;
+    value_program_ = new ParamExpr
+      (value_expr_, type_ == parameter_logical_expr);
+  }
+
   /// Deallocate the parameter
   void dealloc_();
 
@@ -242,6 +253,11 @@ private: // attributes
     struct node_expr * value_expr_;
   };
 
+  /// Compiled expression for parameter_float_expr and
+  /// parameter_logical_expr types (not pup'ed: recompiled when
+  /// unpacked)
+  ParamExpr * value_program_;
+
 };
 
 //----------------------------------------------------------------------
@@ -0,0 +1,316 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ParamExpr.cpp
+/// @date     2026-10-17
+/// @brief    Implementation of the ParamExpr class
+
+#include "cello.hpp"
+
+#include "parameters.hpp"
+
+//----------------------------------------------------------------------
+
+std::vector<double> ParamExpr::scratch_list_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+ParamExpr::ParamExpr (struct node_expr * node, bool is_logical)
+  : code_(),
+    result_(),
+    num_registers_(0),
+    free_registers_()
+{
+  result_ = is_logical ? compile_logical_(node) : compile_float_(node);
+  free_registers_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void ParamExpr::evaluate_float
+(int n, double * result, double * x, double * y, double * z,
+ double t) const
+{
+  if (is_constant()) {
+    for (int i=0; i<n; i++) result[i] = result_.value;
+    return;
+  }
+  double * reg = scratch_();
+  for (int i0=0; i0<n; i0+=tile_size) {
+    const int m = std::min(int(tile_size),n-i0);
+    execute_(reg,i0,m,x,y,z,t);
+    const double * r = reg + result_.reg*tile_size;
+    for (int i=0; i<m; i++) result[i0+i] = r[i];
+  }
+}
+
+//----------------------------------------------------------------------
+
+void ParamExpr::evaluate_logical
+(int n, bool * result, double * x, double * y, double * z,
+ double t) const
+{
+  if (is_constant()) {
+    for (int i=0; i<n; i++) result[i] = (result_.value != 0.0);
+    return;
+  }
+  double * reg = scratch_();
+  for (int i0=0; i0<n; i0+=tile_size) {
+    const int m = std::min(int(tile_size),n-i0);
+    execute_(reg,i0,m,x,y,z,t);
+    const double * r = reg + result_.reg*tile_size;
+    for (int i=0; i<m; i++) result[i0+i] = (r[i] != 0.0);
+  }
+}
+
+//======================================================================
+
+ParamExpr::Operand ParamExpr::compile_float_ (struct node_expr * node)
+{
+  ASSERT("ParamExpr::compile_float_()",
+         "node is NULL", (node != NULL));
+
+  Operand operand = { -1, 0.0 };
+
+  switch (node->type) {
+  case enum_node_operation:
+    {
+      int op = -1;
+      switch (node->op_value) {
+      case enum_op_add: op = op_add; break;
+      case enum_op_sub: op = op_sub; break;
+      case enum_op_mul: op = op_mul; break;
+      case enum_op_div: op = op_div; break;
+      case enum_op_pow: op = op_pow; break;
+      default:
+        ERROR1("ParamExpr::compile_float_",
+               "logical operator %d in floating-point expression",
+               node->op_value);
+        break;
+      }
+      ASSERT3("ParamExpr::compile_float_()",
+              "Error in operation %d: left %p right %p",
+              node->op_value,node->left,node->right,
+              ((node->left != NULL) && (node->right != NULL)));
+      Operand left  = compile_float_(node->left);
+      Operand right = compile_float_(node->right);
+      operand = emit_binary_(op,left,right);
+    }
+    break;
+  case enum_node_float:
+    operand.value = node->float_value;
+    break;
+  case enum_node_integer:
+    operand.value = double(node->integer_value);
+    break;
+  case enum_node_variable:
+    switch (node->var_value) {
+    case 'x': operand = emit_load_(op_x); break;
+    case 'y': operand = emit_load_(op_y); break;
+    case 'z': operand = emit_load_(op_z); break;
+    case 't': operand = emit_load_(op_t); break;
+    default:
+      ERROR1("ParamExpr::compile_float_",
+             "unknown variable %c in floating-point expression",
+             node->var_value);
+      break;
+    }
+    break;
+  case enum_node_function:
+    {
+      ASSERT2("ParamExpr::compile_float_()",
+              "Error in function %p: left %p",
+              node->fun_value, node->left,
+              node->left != NULL);
+      Operand arg = compile_float_(node->left);
+      if (arg.reg < 0) {
+        operand.value = (*(node->fun_value))(arg.value);
+      } else {
+        register_free_(arg.reg);
+        Instruction instr = { op_fun, register_alloc_(), arg.reg, -1,
+                              0.0, node->fun_value };
+        code_.push_back(instr);
+        operand.reg = instr.dst;
+      }
+    }
+    break;
+  case enum_node_unknown:
+  default:
+    ERROR1("ParamExpr::compile_float_",
+           "unknown expression type %d",
+           node->type);
+    break;
+  }
+  return operand;
+}
+
+//----------------------------------------------------------------------
+
+ParamExpr::Operand ParamExpr::compile_logical_ (struct node_expr * node)
+{
+  ASSERT("ParamExpr::compile_logical_()",
+         "node is NULL", (node != NULL));
+  ASSERT1("ParamExpr::compile_logical_()",
+          "expression type %d is not an operation",
+          node->type, (node->type == enum_node_operation));
+  ASSERT3("ParamExpr::compile_logical_()",
+          "Error in operation %d: left %p right %p",
+          node->op_value,node->left,node->right,
+          ((node->left != NULL) && (node->right != NULL)));
+
+  Operand left, right;
+  int op = -1;
+  switch (node->op_value) {
+  case enum_op_and:
+  case enum_op_or:
+    op = (node->op_value == enum_op_and) ? op_and : op_or;
+    left  = compile_logical_(node->left);
+    right = compile_logical_(node->right);
+    break;
+  case enum_op_le:
+  case enum_op_lt:
+  case enum_op_ge:
+  case enum_op_gt:
+  case enum_op_eq:
+  case enum_op_ne:
+    op = op_le + (node->op_value - enum_op_le);
+    left  = compile_float_(node->left);
+    right = compile_float_(node->right);
+    break;
+  default:
+    ERROR1("ParamExpr::compile_logical_",
+           "floating-point operator %d in logical expression",
+           node->op_value);
+    break;
+  }
+  return emit_binary_(op,left,right);
+}
+
+//----------------------------------------------------------------------
+
+ParamExpr::Operand ParamExpr::emit_binary_
+(int op, Operand left, Operand right)
+{
+  Operand operand = { -1, 0.0 };
+  if (left.reg < 0 && right.reg < 0) {
+    operand.value = apply_(op,left.value,right.value);
+  } else {
+    const int a = materialize_(left);
+    const int b = materialize_(right);
+    register_free_(a);
+    register_free_(b);
+    Instruction instr = { op, register_alloc_(), a, b, 0.0, NULL };
+    code_.push_back(instr);
+    operand.reg = instr.dst;
+  }
+  return operand;
+}
+
+//----------------------------------------------------------------------
+
+ParamExpr::Operand ParamExpr::emit_load_ (int op)
+{
+  Instruction instr = { op, register_alloc_(), -1, -1, 0.0, NULL };
+  code_.push_back(instr);
+  Operand operand = { instr.dst, 0.0 };
+  return operand;
+}
+
+//----------------------------------------------------------------------
+
+int ParamExpr::materialize_ (Operand operand)
+{
+  if (operand.reg >= 0) return operand.reg;
+  Instruction instr = { op_const, register_alloc_(), -1, -1,
+                        operand.value, NULL };
+  code_.push_back(instr);
+  return instr.dst;
+}
+
+//----------------------------------------------------------------------
+
+int ParamExpr::register_alloc_ ()
+{
+  if (free_registers_.empty()) return num_registers_++;
+  const int reg = free_registers_.back();
+  free_registers_.pop_back();
+  return reg;
+}
+
+//----------------------------------------------------------------------
+
+void ParamExpr::register_free_ (int reg)
+{
+  free_registers_.push_back(reg);
+}
+
+//----------------------------------------------------------------------
+
+double ParamExpr::apply_ (int op, double a, double b)
+{
+  switch (op) {
+  case op_add: return a + b;
+  case op_sub: return a - b;
+  case op_mul: return a * b;
+  case op_div: return a / b;
+  case op_pow: return pow(a,b);
+  case op_le:  return a <= b;
+  case op_lt:  return a <  b;
+  case op_ge:  return a >= b;
+  case op_gt:  return a >  b;
+  case op_eq:  return a == b;
+  case op_ne:  return a != b;
+  case op_and: return (a != 0.0) && (b != 0.0);
+  case op_or:  return (a != 0.0) || (b != 0.0);
+  }
+  ERROR1("ParamExpr::apply_", "unknown operation %d", op);
+  return 0.0;
+}
+
+//----------------------------------------------------------------------
+
+double * ParamExpr::scratch_ () const
+{
+  std::vector<double> & scratch = scratch_list_[cello::index_static()];
+  const size_t size = size_t(num_registers_)*tile_size;
+  if (scratch.size() < size) scratch.resize(size);
+  return scratch.data();
+}
+
+//----------------------------------------------------------------------
+
+void ParamExpr::execute_
+(double * reg, int i0, int m, double * x, double * y, double * z,
+ double t) const
+{
+  for (const Instruction & instr : code_) {
+    double * r = reg + instr.dst*tile_size;
+    const double * a = (instr.a >= 0) ? reg + instr.a*tile_size : NULL;
+    const double * b = (instr.b >= 0) ? reg + instr.b*tile_size : NULL;
+    int i;
+    switch (instr.op) {
+    case op_const: for (i=0; i<m; i++) r[i] = instr.value; break;
+    case op_x: if (x) for (i=0; i<m; i++) r[i] = x[i0+i]; break;
+    case op_y: if (y) for (i=0; i<m; i++) r[i] = y[i0+i]; break;
+    case op_z: if (z) for (i=0; i<m; i++) r[i] = z[i0+i]; break;
+    case op_t: for (i=0; i<m; i++) r[i] = t; break;
+    case op_add: for (i=0; i<m; i++) r[i] = a[i] + b[i]; break;
+    case op_sub: for (i=0; i<m; i++) r[i] = a[i] - b[i]; break;
+    case op_mul: for (i=0; i<m; i++) r[i] = a[i] * b[i]; break;
+    case op_div: for (i=0; i<m; i++) r[i] = a[i] / b[i]; break;
+    case op_pow: for (i=0; i<m; i++) r[i] = pow(a[i],b[i]); break;
+    case op_fun: for (i=0; i<m; i++) r[i] = (*instr.fun)(a[i]); break;
+    case op_le:  for (i=0; i<m; i++) r[i] = (a[i] <= b[i]); break;
+    case op_lt:  for (i=0; i<m; i++) r[i] = (a[i] <  b[i]); break;
+    case op_ge:  for (i=0; i<m; i++) r[i] = (a[i] >= b[i]); break;
+    case op_gt:  for (i=0; i<m; i++) r[i] = (a[i] >  b[i]); break;
+    case op_eq:  for (i=0; i<m; i++) r[i] = (a[i] == b[i]); break;
+    case op_ne:  for (i=0; i<m; i++) r[i] = (a[i] != b[i]); break;
+    case op_and:
+      for (i=0; i<m; i++) r[i] = (a[i] != 0.0) && (b[i] != 0.0);
+      break;
+    case op_or:
+      for (i=0; i<m; i++) r[i] = (a[i] != 0.0) || (b[i] != 0.0);
+      break;
+    }
+  }
+}
@@ -0,0 +1,140 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     parameters_ParamExpr.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Parameters] Declaration of the ParamExpr class
+
+#ifndef PARAMETERS_PARAM_EXPR_HPP
+#define PARAMETERS_PARAM_EXPR_HPP
+
+class ParamExpr {
+
+  /// @class    ParamExpr
+  /// @ingroup  Parameters
+  /// @brief    [\ref Parameters] Flat "bytecode" form of a parameter
+  /// expression tree
+  ///
+  /// The node_expr tree is compiled once into a linear list of
+  /// register instructions, with constant subexpressions folded.
+  /// Evaluation processes the input arrays in tiles of tile_size
+  /// values, so that each instruction is a simple unit-stride loop
+  /// over a small scratch register that stays in cache, and no
+  /// temporaries are allocated per tree node.
+  ///
+  /// Evaluation does not modify the ParamExpr: registers are held in
+  /// per-PE scratch storage, so PEs sharing the global Parameters in
+  /// SMP builds can evaluate the same expression concurrently.
+
+public: // interface
+
+  /// Number of values evaluated per instruction pass
+  enum { tile_size = 256 };
+
+  /// Compile a floating-point (is_logical false) or logical
+  /// expression tree
+  ParamExpr (struct node_expr * node, bool is_logical);
+
+  // No copy constructor or copy assignment:
+  ParamExpr(const ParamExpr&) = delete;
+  ParamExpr & operator= (const ParamExpr &) = delete;
+
+  /// Evaluate a floating-point expression given vectors x,y,z and time t
+  void evaluate_float
+  (int n, double * result, double * x, double * y, double * z,
+   double t) const;
+
+  /// Evaluate a logical expression given vectors x,y,z and time t
+  void evaluate_logical
+  (int n, bool * result, double * x, double * y, double * z,
+   double t) const;
+
+  /// Number of instructions in the compiled program
+  int num_instructions() const { return code_.size(); }
+
+  /// Number of scratch registers required
+  int num_registers() const { return num_registers_; }
+
+  /// Whether the expression folded to a constant
+  bool is_constant() const { return result_.reg < 0; }
+
+private: // types
+
+  enum {
+    op_const,
+    op_x, op_y, op_z, op_t,
+    op_add, op_sub, op_mul, op_div, op_pow,
+    op_fun,
+    op_le, op_lt, op_ge, op_gt, op_eq, op_ne,
+    op_and, op_or
+  };
+
+  /// Single instruction: reg[dst] = op (reg[a], reg[b])
+  struct Instruction {
+    int op;
+    int dst, a, b;
+    double value;
+    double (*fun)(double);
+  };
+
+  /// Result of compiling a subtree: either a constant value (reg < 0)
+  /// or the register holding its values
+  struct Operand {
+    int reg;
+    double value;
+  };
+
+private: // functions
+
+  /// Compile a floating-point subexpression
+  Operand compile_float_ (struct node_expr * node);
+
+  /// Compile a logical subexpression
+  Operand compile_logical_ (struct node_expr * node);
+
+  /// Emit a binary operation, folding it if both operands are constant
+  Operand emit_binary_ (int op, Operand left, Operand right);
+
+  /// Emit a unary instruction with no inputs (load)
+  Operand emit_load_ (int op);
+
+  /// Move a constant operand into a register
+  int materialize_ (Operand operand);
+
+  /// Allocate a scratch register
+  int register_alloc_ ();
+
+  /// Release a scratch register for reuse
+  void register_free_ (int reg);
+
+  /// Apply a binary operation to scalar values
+  static double apply_ (int op, double a, double b);
+
+  /// Return this PE's scratch storage for the program's registers
+  double * scratch_ () const;
+
+  /// Run the program on values [i0,i0+m) leaving the result in a register
+  void execute_
+  (double * reg, int i0, int m, double * x, double * y, double * z,
+   double t) const;
+
+private: // attributes
+
+  /// Compiled instructions
+  std::vector<Instruction> code_;
+
+  /// Result of the program
+  Operand result_;
+
+  /// Number of registers used
+  int num_registers_;
+
+  /// Registers available for reuse during compilation
+  std::vector<int> free_registers_;
+
+  /// Scratch storage for registers on each PE, reused between
+  /// evaluations of all expressions
+  static std::vector<double> scratch_list_[CONFIG_NODE_SIZE];
+
+};
+
+#endif /* PARAMETERS_PARAM_EXPR_HPP */
@@ -105,6 +105,14 @@ Performance::new_counter ( int type, std::string  counter_name )
   counter_values_.push_back(0);
   counter_values_reduced_.push_back(0);
 
+  // Counters may be added after begin() (e.g. by Methods), so extend
+  // the regions' counters as well
+  for (size_t i=0; i<region_counters_.size(); i++) {
+    if (! region_counters_[i].empty()) {
+      region_counters_[i].resize(counter_name_.size());
+    }
+  }
+
 #ifdef CONFIG_USE_PAPI  
   if (type == counter_type_papi) {
     papi_.add_event(counter_name);
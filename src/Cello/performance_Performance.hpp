@@ -40,6 +40,7 @@ enum perf_region {
   perf_initial,
   perf_adapt_apply,
   perf_adapt_apply_sync,
+  perf_adapt_compute,
   perf_adapt_update,
   perf_adapt_update_sync,
   perf_adapt_notify,
@@ -14,6 +14,7 @@ double Method::courant_global = 1.0;
 Method::Method (double courant) throw()
   : schedule_(NULL),
     courant_(courant),
+    subcycle_(false),
     neighbor_type_(neighbor_leaf)
 {
   ir_post_ = add_refresh_();
@@ -35,6 +36,7 @@ void Method::pup (PUP::er &p)
 
   p | schedule_; // pupable
   p | courant_;
+  p | subcycle_;
   p | ir_post_;
   p | neighbor_type_;
 
@@ -32,6 +32,7 @@ public: // interface
     : PUP::able(m),
     schedule_(NULL),
     courant_(1.0),
+    subcycle_(false),
     ir_post_(-1),
     neighbor_type_(neighbor_leaf)
 
@@ -93,6 +94,14 @@ public: // virtual functions
   void set_courant(double courant) throw ()
   { courant_ = courant; }
 
+  /// Whether the method advances each level with its own time step
+  /// when Stopping:subcycle is enabled
+  bool subcycle() const throw ()
+  { return subcycle_; }
+
+  void set_subcycle(bool subcycle) throw ()
+  { subcycle_ = subcycle; }
+
 protected: // functions
 
   /// Perform vector copy X <- Y
@@ -118,6 +127,9 @@ protected: // attributes
   /// Courant condition for the Method
   double courant_;
 
+  /// Whether the Method is subcycled (see Block::subcycle_step_())
+  bool subcycle_;
+
   /// Index for main refresh after Method is called
   int ir_post_;
 
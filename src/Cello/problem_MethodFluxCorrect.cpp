@@ -114,6 +114,26 @@ MethodFluxCorrect::MethodFluxCorrect
 
 void MethodFluxCorrect::compute ( Block * block) throw()
 {
+  FluxData * flux_data = block->data()->flux_data();
+
+  if (cello::config()->stopping_subcycle && ! flux_data->is_allocated()) {
+
+    // Subcycling: the Block may not have computed fluxes this cycle,
+    // but still accumulates fluxes from finer neighbors until its
+    // next step
+
+    Field field = block->data()->field();
+    Grouping * groups = cello::field_groups();
+    const int nf = groups->size(group_);
+    std::vector<int> field_list(nf);
+    for (int i_f=0; i_f<nf; i_f++) {
+      field_list[i_f] = field.field_id(groups->item(group_,i_f));
+    }
+    int nx,ny,nz;
+    field.size(&nx,&ny,&nz);
+    flux_data->allocate(nx,ny,nz,field_list,true);
+  }
+
   cello::refresh(ir_pre_)->set_active(block->is_leaf());
 
   block->refresh_start
@@ -135,7 +155,11 @@ void MethodFluxCorrect::compute_continue_refresh( Block * block ) throw()
 {
   // accumulate local sums of conserved fields for global sum reduction
 
-  flux_correct_ (block);
+  // When subcycling, fluxes are corrected only when the Block is
+  // stepped, using fine fluxes accumulated since its last step
+  if (block->subcycle_step()) {
+    flux_correct_ (block);
+  }
 
   Field field = block->data()->field();
   int mx,my,mz;
@@ -262,7 +286,9 @@ void MethodFluxCorrect::compute_continue_sum_fields
     }
   }
 
-  block->data()->flux_data()->deallocate();
+  if (block->subcycle_step()) {
+    block->data()->flux_data()->deallocate();
+  }
 
   block->compute_done();
 }
@@ -22,12 +22,19 @@
 
 //----------------------------------------------------------------------
 
-MethodOrderHilbert::MethodOrderHilbert(int min_level) throw ()
+MethodOrderHilbert::MethodOrderHilbert
+(int min_level, double weight_particle) throw ()
   : Method(),
     is_index_(-1),
     is_weight_(-1),
     is_weight_child_(-1),
-    min_level_(min_level)
+    is_cost_(-1),
+    is_cost_block_(-1),
+    is_cost_child_(-1),
+    is_cost_index_(-1),
+    is_cost_total_(-1),
+    min_level_(min_level),
+    weight_particle_(weight_particle)
 {
   Refresh * refresh = cello::refresh(ir_post_);
   cello::simulation()->refresh_set_name(ir_post_,name());
@@ -42,6 +49,13 @@ MethodOrderHilbert::MethodOrderHilbert(int min_level) throw ()
   is_weight_child_ = cello::scalar_descr_long_long()->new_value(name() + ":weight_child",n);
   is_sync_index_   = cello::scalar_descr_sync()->new_value(name() + ":sync_index");
   is_sync_weight_  = cello::scalar_descr_sync()->new_value(name() + ":sync_weight");
+
+  /// Create Scalar data for cost-weighted ordering
+  is_cost_         = cello::scalar_descr_double()->new_value(name() + ":cost");
+  is_cost_block_   = cello::scalar_descr_double()->new_value(name() + ":cost_block");
+  is_cost_child_   = cello::scalar_descr_double()->new_value(name() + ":cost_child",n);
+  is_cost_index_   = cello::scalar_descr_double()->new_value(name() + ":cost_index");
+  is_cost_total_   = cello::scalar_descr_double()->new_value(name() + ":cost_total");
 }
 
 //======================================================================
@@ -60,6 +74,16 @@ void MethodOrderHilbert::compute (Block * block) throw()
   for (int i=0; i<cello::num_children(); i++) {
     *pweight_child_(block,i) = 0;
   }
+  // Block cost is 1 plus weighted number of particles
+  const double cost_block = 1.0 +
+    weight_particle_*block->data()->particle().num_particles();
+  *pcost_block_(block) = cost_block;
+  *pcost_(block) = cost_block;
+  *pcost_index_(block) = 0.0;
+  *pcost_total_(block) = 0.0;
+  for (int i=0; i<cello::num_children(); i++) {
+    *pcost_child_(block,i) = 0.0;
+  }
   sync_index->reset();
   sync_weight->reset();
   sync_index->set_stop(1 + 1);
@@ -86,18 +110,20 @@ void Block::r_method_order_hilbert_continue(CkReductionMsg * msg)
 void MethodOrderHilbert::compute_continue(Block * block)
 {
   TRACE_ORDER_BLOCK("continue",block);
-  send_weight(block, 0, true);
+  send_weight(block, 0, 0.0, true);
 }
 
 //======================================================================
-void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
+void MethodOrderHilbert::send_weight
+(Block * block, int weight_child, double cost_child, bool self)
 {
   // update own weight
   // if not at finest level, send weight to parent
   int weight = *pweight_(block);
+  double cost = *pcost_(block);
   int ic3[3] = {0,0,0};
   if (self) {
-    recv_weight(block,ic3,0,true);
+    recv_weight(block,ic3,0,0.0,true);
   }
   const int level = block->level();
   if ((!self || block->is_leaf()) && level > min_level_)  {
@@ -105,8 +131,8 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
     block->index().child(level,ic3,ic3+1,ic3+2,min_level_);
     TRACE_ORDER_BLOCK("send_weight",block);
     cello::block_array()[index_parent].p_method_order_hilbert_weight
-      (ic3,weight,block->index());
-    send_index(block, 0, 0, self);
+      (ic3,weight,cost,block->index());
+    send_index(block, 0, 0, 0.0, 0.0, self);
   } else if (level == min_level_) {
 
     const int rank = cello::rank();
@@ -118,8 +144,9 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
     *pindex_(block) = 0;
     *pcount_(block) = 0;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = 0.0;
 
-    send_index(block, 0, weight, self);
+    send_index(block, 0, weight, 0.0, cost, self);
     if (!self) {
       CkCallback callback
         (CkIndex_Block::r_method_order_hilbert_complete (nullptr),
@@ -131,16 +158,17 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
 
 //----------------------------------------------------------------------
 
-void Block::p_method_order_hilbert_weight(int ic3[3], int weight, Index index_child)
+void Block::p_method_order_hilbert_weight
+(int ic3[3], int weight, double cost, Index index_child)
 {
   static_cast<MethodOrderHilbert*>
-    (this->method())->recv_weight(this, ic3,weight,false);
+    (this->method())->recv_weight(this, ic3,weight,cost,false);
 }
 
 //----------------------------------------------------------------------
 
 void MethodOrderHilbert::recv_weight
-(Block * block, int ic3[3], int weight, bool self)
+(Block * block, int ic3[3], int weight, double cost, bool self)
 {
   TRACE_ORDER_BLOCK("recv_weight",block);
   // Update children weight if needed
@@ -148,21 +176,26 @@ void MethodOrderHilbert::recv_weight
     *pweight_(block) += weight;
     int i = ic3[0] + 2*(ic3[1]+2*ic3[2]);
     *pweight_child_(block,i) = weight;
+    *pcost_(block) += cost;
+    *pcost_child_(block,i) = cost;
   }
   if ((!block->is_leaf()) && psync_weight_(block)->next()) {
     // Forward weight to parent when computed
     int ic3[3] = {0,0,0};
     block->index().child(block->level(),ic3,ic3+1,ic3+2,min_level_);
-    send_weight(block,*pweight_(block),false);
+    send_weight(block,*pweight_(block),*pcost_(block),false);
   }
 }
 
 void MethodOrderHilbert::send_index
-(Block * block, int index_parent, int count, bool self)
+(Block * block, int index_parent, int count,
+ double cost_index_parent, double cost_total, bool self)
 {
   *pcount_(block) = count;
+  *pcost_total_(block) = cost_total;
   if (!block->is_leaf()) {
     int index = *pindex_(block) + 1;
+    double cost_index = *pcost_index_(block) + *pcost_block_(block);
 
     int children[cello::num_children()];
     hilbert_children(block, children);
@@ -173,21 +206,26 @@ void MethodOrderHilbert::send_index
       ic3[1] = (children[i] >> 1) & 1;
       ic3[2] = (children[i] >> 2) & 1;
       Index index_child = block->index().index_child(ic3,min_level_);
-      cello::block_array()[index_child].p_method_order_hilbert_index(index,count);
+      cello::block_array()[index_child].p_method_order_hilbert_index
+        (index,count,cost_index,cost_total);
 
       index += *pweight_child_(block, children[i]);
+      cost_index += *pcost_child_(block, children[i]);
     }
   }
 }
 
-void Block::p_method_order_hilbert_index(int index, int count)
+void Block::p_method_order_hilbert_index
+(int index, int count, double cost_index, double cost_total)
 {
   static_cast<MethodOrderHilbert*>
-    (this->method())->recv_index(this, index, count, false);
+    (this->method())->recv_index
+    (this, index, count, cost_index, cost_total, false);
 }
 
 void MethodOrderHilbert::recv_index
-(Block * block, int index, int count, bool self)
+(Block * block, int index, int count,
+ double cost_index, double cost_total, bool self)
 {
   {
     char buffer[80];
@@ -203,6 +241,8 @@ void MethodOrderHilbert::recv_index
     *pindex_(block) = index;
     *pcount_(block) = count;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = cost_index;
+    *pcost_total_(block) = cost_total;
   }
   if (psync_index_(block)->next()) {
     {
@@ -210,7 +250,7 @@ void MethodOrderHilbert::recv_index
       sprintf (buffer,"complete %d %d\n",index,count);
       TRACE_ORDER_BLOCK(buffer,block);
     } 
-    send_index(block,index, count, false);
+    send_index(block,index, count, cost_index, cost_total, false);
     CkCallback callback (CkIndex_Block::r_method_order_hilbert_complete(nullptr),
                        block->proxy_array());
     block->contribute (callback);
@@ -416,9 +456,8 @@ bool MethodOrderHilbert::is_last_child(int T, int coord) {
     return coord_to_hilbert_ind(T, coord) == last_ind;
 }
 
-int MethodOrderHilbert::coord_to_hilbert_ind(int state, int coord) {
-    int rank = cello::rank();
-    int hilbert_ind;
+int MethodOrderHilbert::coord_to_hilbert_ind(int rank, int state, int coord) {
+    int hilbert_ind = 0;
 
     if (rank == 3) {
         hilbert_ind = PHM[state][coord & 7];
@@ -431,9 +470,8 @@ int MethodOrderHilbert::coord_to_hilbert_ind(int state, int coord) {
     return hilbert_ind;
 }
 
-int MethodOrderHilbert::coord_to_next_state(int state, int coord) {
-    int rank = cello::rank();
-    int next_state;
+int MethodOrderHilbert::coord_to_next_state(int rank, int state, int coord) {
+    int next_state = 0;
 
     if (rank == 3) {
         next_state = PNM[state][coord & 7];
@@ -553,4 +591,49 @@ int MethodOrderHilbert::CSM[4][4] = {
     {1, 0, 3, 0},
     {0, 2, 1, 1},
     {2, 1, 2, 3},
-    {3, 3, 0, 2}};
\ No newline at end of file
+    {3, 3, 0, 2}};
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_block_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_block_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_child_(Block * block, int i)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_child_)+i;
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_index_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_index_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_total_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_total_);
+}
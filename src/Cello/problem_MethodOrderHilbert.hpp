@@ -28,7 +28,7 @@ class MethodOrderHilbert : public Method {
 public: // interface
 
   /// Constructor
-  MethodOrderHilbert(int min_level) throw();
+  MethodOrderHilbert(int min_level, double weight_particle) throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(MethodOrderHilbert);
@@ -49,15 +49,24 @@ public: // interface
     p | is_weight_child_;
     p | is_sync_index_;
     p | is_sync_weight_;
+    p | is_cost_;
+    p | is_cost_block_;
+    p | is_cost_child_;
+    p | is_cost_index_;
+    p | is_cost_total_;
     p | min_level_;
+    p | weight_particle_;
   }
 
   void compute_continue( Block * block);
   void compute_complete( Block * block);
-  void send_weight(Block * block, int weight, bool self);
-  void recv_weight(Block * block, int ic3[3], int weight, bool self);
-  void send_index(Block * block, int index, int count, bool self);
-  void recv_index(Block * block, int index, int count, bool self);
+  void send_weight(Block * block, int weight, double cost, bool self);
+  void recv_weight(Block * block, int ic3[3], int weight, double cost,
+                   bool self);
+  void send_index(Block * block, int index, int count,
+                  double cost_index, double cost_total, bool self);
+  void recv_index(Block * block, int index, int count,
+                  double cost_index, double cost_total, bool self);
 
 public: // virtual methods
   
@@ -67,6 +76,15 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "order_hilbert"; }
 
+  /// Convert a zyx coordinate to the corresponding hilbert index for
+  /// a given rank and state, e.g. for ordering root blocks in
+  /// MappingArray
+  static int coord_to_hilbert_ind(int rank, int state, int coord);
+
+  /// Convert a zyx coordinate to the next state for a given rank and
+  /// state
+  static int coord_to_next_state(int rank, int state, int coord);
+
 private: // methods
 
   /// Return the pointer to the Block's Hilbert ordering index 
@@ -90,6 +108,21 @@ private: // methods
   /// Return the pointer to the Block's weight (including self)
   Sync * psync_weight_(Block * block);
 
+  /// Return the pointer to the Block's cost (including descendents)
+  double * pcost_(Block * block);
+
+  /// Return the pointer to the Block's own cost
+  double * pcost_block_(Block * block);
+
+  /// Return the pointer to the given Block's child cost
+  double * pcost_child_(Block * block, int index);
+
+  /// Return the pointer to the total cost of Blocks preceding this one
+  double * pcost_index_(Block * block);
+
+  /// Return the pointer to the total cost of all Blocks
+  double * pcost_total_(Block * block);
+
   /// Write child blocks of the given block to the children array in the hilbert order.
   void hilbert_children(Block * block, int* children);
 
@@ -103,10 +136,12 @@ private: // methods
   bool is_last_child(int T, int coord);
 
   /// Convert a zyx coordinate to the corresponding hilbert index for a given state.
-  int coord_to_hilbert_ind(int state, int coord);
+  int coord_to_hilbert_ind(int state, int coord)
+  { return coord_to_hilbert_ind(cello::rank(),state,coord); }
 
   /// Convert a zyx coordinate to the next state for a given state.
-  int coord_to_next_state(int state, int coord);
+  int coord_to_next_state(int state, int coord)
+  { return coord_to_next_state(cello::rank(),state,coord); }
 
   /// Convert a hilbert index to the corresponding zyx coordinate for a given state.
   int hilbert_ind_to_coord(int state, int hilbert_ind);
@@ -133,9 +168,23 @@ private: // attributes
   /// Block Scalar<sync> sync counter for weight (fine->coarse)
   int is_sync_weight_;
 
+  /// Block Scalar<double> cost (block cost of decendents + self)
+  int is_cost_;
+  /// Block Scalar<double> cost of self
+  int is_cost_block_;
+  /// Block Scalar<double> child cost (array of size cello::num_children())
+  int is_cost_child_;
+  /// Block Scalar<double> sum of costs of preceding blocks
+  int is_cost_index_;
+  /// Block Scalar<double> sum of costs of all blocks
+  int is_cost_total_;
+
   /// Minimum refinement level for ordering; may be < 0
   int min_level_;
 
+  /// Cost of each particle relative to the cost of a Block
+  double weight_particle_;
+
   /// Look up tables for encoding/decoding Hilbert indices
   static int HPM[12][8];
   static int HNM[12][8];
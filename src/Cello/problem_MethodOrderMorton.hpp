@@ -18,7 +18,7 @@ class MethodOrderMorton : public Method {
 public: // interface
 
   /// Constructor
-  MethodOrderMorton(int min_level) throw();
+  MethodOrderMorton(int min_level, double weight_particle) throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(MethodOrderMorton);
@@ -39,15 +39,24 @@ public: // interface
     p | is_weight_child_;
     p | is_sync_index_;
     p | is_sync_weight_;
+    p | is_cost_;
+    p | is_cost_block_;
+    p | is_cost_child_;
+    p | is_cost_index_;
+    p | is_cost_total_;
     p | min_level_;
+    p | weight_particle_;
   }
 
   void compute_continue( Block * block);
   void compute_complete( Block * block);
-  void send_weight(Block * block, int weight, bool self);
-  void recv_weight(Block * block, int ic3[3], int weight, bool self);
-  void send_index(Block * block, int index, int count, bool self);
-  void recv_index(Block * block, int index, int count, bool self);
+  void send_weight(Block * block, int weight, double cost, bool self);
+  void recv_weight(Block * block, int ic3[3], int weight, double cost,
+                   bool self);
+  void send_index(Block * block, int index, int count,
+                  double cost_index, double cost_total, bool self);
+  void recv_index(Block * block, int index, int count,
+                  double cost_index, double cost_total, bool self);
 
 public: // virtual methods
   
@@ -80,6 +89,21 @@ private: // methods
   /// Return the pointer to the Block's weight (including self)
   Sync * psync_weight_(Block * block);
 
+  /// Return the pointer to the Block's cost (including descendents)
+  double * pcost_(Block * block);
+
+  /// Return the pointer to the Block's own cost
+  double * pcost_block_(Block * block);
+
+  /// Return the pointer to the given Block's child cost
+  double * pcost_child_(Block * block, int index);
+
+  /// Return the pointer to the total cost of Blocks preceding this one
+  double * pcost_index_(Block * block);
+
+  /// Return the pointer to the total cost of all Blocks
+  double * pcost_total_(Block * block);
+
 private: // functions
 
 
@@ -102,8 +126,22 @@ private: // attributes
   /// Block Scalar<sync> sync counter for weight (fine->coarse)
   int is_sync_weight_;
 
+  /// Block Scalar<double> cost (block cost of decendents + self)
+  int is_cost_;
+  /// Block Scalar<double> cost of self
+  int is_cost_block_;
+  /// Block Scalar<double> child cost (array of size cello::num_children())
+  int is_cost_child_;
+  /// Block Scalar<double> sum of costs of preceding blocks
+  int is_cost_index_;
+  /// Block Scalar<double> sum of costs of all blocks
+  int is_cost_total_;
+
   /// Minimum refinement level for ordering; may be < 0
   int min_level_;
+
+  /// Cost of each particle relative to the cost of a Block
+  double weight_particle_;
 };
 
 #endif /* PROBLEM_METHOD_ORDER_MORTON_HPP */
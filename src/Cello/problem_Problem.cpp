@@ -498,6 +498,8 @@ void Problem::initialize_method
 
       method_list_.push_back(method); 
 
+      method->set_subcycle(config->method_subcycle[index_method]);
+
       int index_schedule = config->method_schedule_index[index_method];
 
       if (index_schedule != -1) {
@@ -929,11 +931,13 @@ Method * Problem::create_method_
     // TODO: refactor to use a factory method/default constructor
     //   - can we look up mesh_min_level from an existing object? Like Adapt or
     //     Hierarchy?
-    method = new MethodOrderMorton(config->mesh_min_level);
+    method = new MethodOrderMorton
+      (config->mesh_min_level, p_group.value_float("weight_particle",0.0));
 
   } else if (name == "order_hilbert") {
 
-    method = new MethodOrderHilbert(config->mesh_min_level);
+    method = new MethodOrderHilbert
+      (config->mesh_min_level, p_group.value_float("weight_particle",0.0));
 
   } else if (name == "refresh") {
     method = new MethodRefresh(p_group);
@@ -14,5 +14,21 @@ Prolong::Prolong() throw ()
   TRACE("Prolong::Prolong");
 }
 
+//----------------------------------------------------------------------
+
+void Prolong::apply_list
+( precision_type precision, int num_fields,
+  void *       const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+  const void * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+  bool accumulate)
+{
+  for (int i_f=0; i_f<num_fields; i_f++) {
+    apply (precision,
+           values_f[i_f], nd3_f, im3_f, n3_f,
+           values_c[i_f], nd3_c, im3_c, n3_c,
+           accumulate);
+  }
+}
+
 //======================================================================
 
@@ -47,6 +47,16 @@ public: // virtual methods
     const void * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false) = 0;
 
+  /// Prolong a list of fields that share the same precision, array
+  /// dimensions, and loop limits.  The default calls apply() for each
+  /// field; subclasses may override it to reuse index tables and
+  /// work arrays across fields
+  virtual void apply_list
+  ( precision_type precision, int num_fields,
+    void *       const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const void * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    bool accumulate = false);
+
   /// Return the name identifying the prolongation operator
   virtual std::string name () const = 0;
 
@@ -27,6 +27,20 @@ void ProlongLinear::apply
   void *       values_f, int mf3[3], int of3[3], int nf3[3],
   const void * values_c, int mc3[3], int oc3[3], int nc3[3],
   bool accumulate)
+{
+  apply_list (precision, 1,
+              &values_f, mf3, of3, nf3,
+              &values_c, mc3, oc3, nc3,
+              accumulate);
+}
+
+//----------------------------------------------------------------------
+
+void ProlongLinear::apply_list
+( precision_type precision, int num_fields,
+  void *       const * values_f, int mf3[3], int of3[3], int nf3[3],
+  const void * const * values_c, int mc3[3], int oc3[3], int nc3[3],
+  bool accumulate)
 {
   TRACE6("ProlongLinear fine   %d:%d %d:%d %d:%d",
          of3[0],nf3[0]+of3[0],
@@ -40,6 +54,7 @@ void ProlongLinear::apply
 
 #ifdef TRACE_PROLONG
   CkPrintf("TRACE_PROLONG accum %d\n",accumulate?1:0);
+  CkPrintf("TRACE_PROLONG num_fields %d\n",num_fields);
   CkPrintf("TRACE_PROLONG nf %d %d %d\n", nf3[0],nf3[1],nf3[2]);
   CkPrintf("TRACE_PROLONG mf %d %d %d\n", mf3[0],mf3[1],mf3[2]);
   CkPrintf("TRACE_PROLONG of %d %d %d\n", of3[0],of3[1],of3[2]);
@@ -53,23 +68,25 @@ void ProlongLinear::apply
 
   case precision_single:
 
-    apply_((float *)       values_f, mf3, of3, nf3,
-           (const float *) values_c, mc3, oc3, nc3,
+    apply_(num_fields,
+           (float *       const *) values_f, mf3, of3, nf3,
+           (const float * const *) values_c, mc3, oc3, nc3,
            accumulate);
 
     break;
 
   case precision_double:
 
-    apply_((double *)       values_f, mf3, of3, nf3,
-           (const double *) values_c, mc3, oc3, nc3,
+    apply_(num_fields,
+           (double *       const *) values_f, mf3, of3, nf3,
+           (const double * const *) values_c, mc3, oc3, nc3,
            accumulate);
 
     break;
 
   default:
 
-    ERROR1 ("ProlongLinear::apply()",
+    ERROR1 ("ProlongLinear::apply_list()",
             "Unknown precision %d",
             precision);
   }
@@ -77,10 +94,43 @@ void ProlongLinear::apply
 
 //----------------------------------------------------------------------
 
+template <class T>
+void ProlongLinear::weights_
+(int nf, int oc, int gc, std::vector<int> & ic,
+ std::vector<T> & w0, std::vector<T> & w1)
+{
+  ic.resize(nf);
+  w0.resize(nf);
+  w1.resize(nf);
+
+  for (int i_f = 0; i_f<nf; i_f++) {
+
+    int i_c = ((i_f+1) >> 1) - gc;
+
+    // Default weighting factor
+    int w[2] = { 1, 3 };
+
+    // Update weights if no ghosts and on edges
+    if (i_f==0)    { i_c += gc; }
+    if (i_f==nf-1) { i_c -= gc; }
+    if (i_f==0 || i_f==nf-1) {
+      w[0] += 4*gc;
+      w[1] -= 4*gc;
+    }
+
+    ic[i_f] = oc + i_c;
+    w0[i_f] = 0.25*w[ i_f&1];
+    w1[i_f] = 0.25*w[~i_f&1];
+  }
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void ProlongLinear::apply_
-(  T * values_f, int mf3[3], int of3[3], int nf3[3],
-   const T * values_c, int mc3[3], int oc3[3], int nc3[3],
+(  int num_fields,
+   T * const * values_f, int mf3[3], int of3[3], int nf3[3],
+   const T * const * values_c, int mc3[3], int oc3[3], int nc3[3],
    bool accumulate)
 {
   const int dcx = 1;
@@ -111,259 +161,170 @@ void ProlongLinear::apply_
   int gcy = (nf3[1]==2*nc3[1]) ? 1 : 0;
   int gcz = (nf3[2]==2*nc3[2]) ? 1 : 0;
 
-#ifdef TRACE_SUMS
-  T cmin=1e30,cmax=-1e30,cavg=0.0,ccount=0;
-  T fmin=1e30,fmax=-1e30,favg=0.0,fcount=0;
-#endif
-
-  const int mf = mf3[0]*mf3[1]*mf3[2];
-  
-  T * temp_f = (accumulate) ? (new T [mf]) : values_f;
-
-  if (rank == 1) {
-
-    const int ofx = of3[0];
-    const int ocx = oc3[0];
-    const int nfx = nf3[0];
-
-    for (int ifx = 0; ifx<nfx; ifx++) {
-
-      int icx = ((ifx+1) >> 1) - gcx;
-
-      // Default weighting factor
-      int wx[2] = { 1, 3 };
-
-      // Update weights if no ghosts and on edges
-      if (ifx==0)     { icx += gcx; }
-      if (ifx==nfx-1) { icx -= gcx; }
-      if (ifx==0 || ifx==nfx-1) {
-        wx[0] += 4*gcx;
-        wx[1] -= 4*gcx;
-      }
-
-      T wx0 = 0.25*wx[ ifx&1];
-      T wx1 = 0.25*wx[~ifx&1];
+  // Coarse indices and weights along each axis are the same for all
+  // fields, so are computed once
 
-      int i_c = (ocx+icx) ;
-      int i_f = (ofx+ifx) ;
+  std::vector<int> icx, icy, icz;
+  std::vector<T> wx0, wx1, wy0, wy1, wz0, wz1;
 
-      temp_f[i_f] = wx0*values_c[i_c]
-        +             wx1*values_c[i_c + dcx ];
-    }
+  weights_ (nf3[0],oc3[0],gcx, icx, wx0, wx1);
+  if (rank >= 2) weights_ (nf3[1],oc3[1],gcy, icy, wy0, wy1);
+  if (rank >= 3) weights_ (nf3[2],oc3[2],gcz, icz, wz0, wz1);
 
-  } else if (rank == 2) {
+  const int mf = mf3[0]*mf3[1]*mf3[2];
 
-    const int ofy = of3[1];
-    const int ocy = oc3[1];
-    const int nfy = nf3[1];
-    
-    for (int ify = 0; ify<nfy; ify++) {
+  // Work array for accumulating, shared by all fields
+  std::vector<T> temp;
+  if (accumulate) temp.resize(mf);
 
-      int icy = ((ify+1) >> 1) - gcy;
+  const int ofx = of3[0];
+  const int ofy = of3[1];
+  const int ofz = of3[2];
+  const int nfx = nf3[0];
+  const int nfy = nf3[1];
+  const int nfz = nf3[2];
+  const int mcx = mc3[0];
+  const int mcy = mc3[1];
+  const int mfx = mf3[0];
+  const int mfy = mf3[1];
 
-      // Default weighting factor
-      int wy[2] = { 1, 3 };
+  for (int i_field=0; i_field<num_fields; i_field++) {
 
-      // Update weights if no ghosts and on edges
-      if (ify==0)     { icy += gcy; }
-      if (ify==nfy-1) { icy -= gcy; }
-      if (ify==0 || ify==nfy-1) {
-        wy[0] += 4*gcy;
-        wy[1] -= 4*gcy;
-      }
+    T * vf = values_f[i_field];
+    const T * vc = values_c[i_field];
 
-      T wy0 = 0.25*wy[ ify&1];
-      T wy1 = 0.25*wy[~ify&1];
+#ifdef TRACE_SUMS
+    T cmin=1e30,cmax=-1e30,cavg=0.0,ccount=0;
+    T fmin=1e30,fmax=-1e30,favg=0.0,fcount=0;
+#endif
 
-      const int ofx = of3[0];
-      const int ocx = oc3[0];
-      const int nfx = nf3[0];
+    T * temp_f = (accumulate) ? temp.data() : vf;
 
-      const int mcx = mc3[0];
-      const int mfx = mf3[0];
+    if (rank == 1) {
 
       for (int ifx = 0; ifx<nfx; ifx++) {
 
-        int icx = ((ifx+1) >> 1) - gcx;
-
-        // Default weighting factor
-        int wx[2] = { 1, 3 };
-
-        // Update weights if no ghosts and on edges
-        if (ifx==0)     { icx += gcx; }
-        if (ifx==nfx-1) { icx -= gcx; }
-        if (ifx==0 || ifx==nfx-1) {
-          wx[0] += 4*gcx;
-          wx[1] -= 4*gcx;
-        }
-
-        T wx0 = 0.25*wx[ ifx&1];
-        T wx1 = 0.25*wx[~ifx&1];
-
-        int i_c = (ocx+icx) + mcx * ( (ocy+icy) );
-        int i_f = (ofx+ifx) + mfx * ( (ofy+ify) );
+        int i_c = icx[ifx];
+        int i_f = (ofx+ifx) ;
 
-        temp_f[i_f] = wx0*wy0*values_c[i_c]
-          +             wx1*wy0*values_c[i_c + dcx ]
-          +             wx0*wy1*values_c[i_c       + dcy ]
-          +             wx1*wy1*values_c[i_c + dcx + dcy ];
+        temp_f[i_f] = wx0[ifx]*vc[i_c]
+          +           wx1[ifx]*vc[i_c + dcx ];
       }
-    }
 
+    } else if (rank == 2) {
 
-  } else { // rank == 3
+      for (int ify = 0; ify<nfy; ify++) {
 
-    const int ofz = of3[2];
-    const int ocz = oc3[2];
-    const int nfz = nf3[2];
+        const T wy0f = wy0[ify];
+        const T wy1f = wy1[ify];
 
-    for (int ifz = 0; ifz<nfz; ifz++) {
+        for (int ifx = 0; ifx<nfx; ifx++) {
 
-      int icz = ((ifz+1) >> 1) - gcz;
+          const T wx0f = wx0[ifx];
+          const T wx1f = wx1[ifx];
 
-      // Default weighting factor
-      int wz[2] = { 1, 3 };
+          int i_c = icx[ifx] + mcx * ( icy[ify] );
+          int i_f = (ofx+ifx) + mfx * ( (ofy+ify) );
 
-      // Update weights if no ghosts and on edges
-      if (ifz==0)     { icz += gcz; }
-      if (ifz==nfz-1) { icz -= gcz; }
-      if (ifz==0 || ifz==nfz-1) {
-        wz[0] += 4*gcz;
-        wz[1] -= 4*gcz;
+          temp_f[i_f] = wx0f*wy0f*vc[i_c]
+            +           wx1f*wy0f*vc[i_c + dcx ]
+            +           wx0f*wy1f*vc[i_c       + dcy ]
+            +           wx1f*wy1f*vc[i_c + dcx + dcy ];
+        }
       }
 
-      T wz0 = 0.25*wz[ ifz&1];
-      T wz1 = 0.25*wz[~ifz&1];
-
-      const int ofy = of3[1];
-      const int ocy = oc3[1];
-      const int nfy = nf3[1];
-
-      for (int ify = 0; ify<nfy; ify++) {
-
-        int icy = ((ify+1) >> 1) - gcy;
+    } else { // rank == 3
 
-        // Default weighting factor
-        int wy[2] = { 1, 3 };
-
-        // Update weights if no ghosts and on edges
-        if (ify==0)     { icy += gcy; }
-        if (ify==nfy-1) { icy -= gcy; }
-        if (ify==0 || ify==nfy-1) {
-          wy[0] += 4*gcy;
-          wy[1] -= 4*gcy;
-        }
+      for (int ifz = 0; ifz<nfz; ifz++) {
 
-        T wy0 = 0.25*wy[ ify&1];
-        T wy1 = 0.25*wy[~ify&1];
+        const T wz0f = wz0[ifz];
+        const T wz1f = wz1[ifz];
 
-        const int ofx = of3[0];
-        const int ocx = oc3[0];
-        const int nfx = nf3[0];
+        for (int ify = 0; ify<nfy; ify++) {
 
-        const int mcx = mc3[0];
-        const int mfx = mf3[0];
-        const int mcy = mc3[1];
-        const int myf = mf3[1];
+          const T wy0f = wy0[ify];
+          const T wy1f = wy1[ify];
 
-        for (int ifx = 0; ifx<nfx; ifx++) {
+          for (int ifx = 0; ifx<nfx; ifx++) {
 
-          int icx = ((ifx+1) >> 1) - gcx;
+            const T wx0f = wx0[ifx];
+            const T wx1f = wx1[ifx];
 
-          // Default weighting factor
-          int wx[2] = { 1, 3 };
+            int i_c = icx[ifx] + mcx*( icy[ify] + mcy*icz[ifz] );
+            int i_f = (ofx+ifx) + mfx*( (ofy+ify) + mfy*(ofz+ifz) );
 
-          // Update weights if no ghosts and on edges
-          if (ifx==0)     { icx += gcx; }
-          if (ifx==nfx-1) { icx -= gcx; }
-          if (ifx==0 || ifx==nfx-1) {
-            wx[0] += 4*gcx;
-            wx[1] -= 4*gcx;
+            temp_f[i_f] = wx0f*wy0f*wz0f*vc[i_c]
+              +           wx1f*wy0f*wz0f*vc[i_c + dcx ]
+              +           wx0f*wy1f*wz0f*vc[i_c       + dcy ]
+              +           wx1f*wy1f*wz0f*vc[i_c + dcx + dcy ]
+              +           wx0f*wy0f*wz1f*vc[i_c             + dcz ]
+              +           wx1f*wy0f*wz1f*vc[i_c + dcx       + dcz ]
+              +           wx0f*wy1f*wz1f*vc[i_c       + dcy + dcz ]
+              +           wx1f*wy1f*wz1f*vc[i_c + dcx + dcy + dcz ];
           }
-
-          T wx0 = 0.25*wx[ ifx&1];
-          T wx1 = 0.25*wx[~ifx&1];
-
-          int i_c = (ocx+icx) + mcx*( (ocy+icy) + mcy*(ocz+icz) );
-          int i_f = (ofx+ifx) + mfx*( (ofy+ify) + myf*(ofz+ifz) );
-	  
-          temp_f[i_f] = wx0*wy0*wz0*values_c[i_c]
-            +             wx1*wy0*wz0*values_c[i_c + dcx ]
-            +             wx0*wy1*wz0*values_c[i_c       + dcy ]
-            +             wx1*wy1*wz0*values_c[i_c + dcx + dcy ]
-            +             wx0*wy0*wz1*values_c[i_c             + dcz ]
-            +             wx1*wy0*wz1*values_c[i_c + dcx       + dcz ]
-            +             wx0*wy1*wz1*values_c[i_c       + dcy + dcz ]
-            +             wx1*wy1*wz1*values_c[i_c + dcx + dcy + dcz ];
         }
       }
     }
-  }
 
 #ifdef TRACE_SUMS
-  if (accumulate) {
-    DEBUG_PRINT_ARRAY0("values_c",values_c,mc3,nc3,oc3);
-    DEBUG_PRINT_ARRAY0("values_f",values_f,mf3,nf3,of3);
-  }
-  //  if (accumulate) {
-  for (int icz=0; icz<nc3[2]; icz++) {
-    int iz=icz+oc3[2];
-    for (int icy=0; icy<nc3[1]; icy++) {
-      int iy=icy+oc3[1];
-      for (int icx=0; icx<nc3[0]; icx++) {
-        ccount++;
-        int ix=icx+oc3[0];
-        int i_c=ix + mc3[0]*(iy + mc3[1]*iz);
-        cavg += values_c[i_c];
-        cmin = std::min(cmin,values_c[i_c]);
-        cmax = std::max(cmax,values_c[i_c]);
+    if (accumulate) {
+      DEBUG_PRINT_ARRAY0("values_c",vc,mc3,nc3,oc3);
+      DEBUG_PRINT_ARRAY0("values_f",vf,mf3,nf3,of3);
+    }
+    for (int icz=0; icz<nc3[2]; icz++) {
+      int iz=icz+oc3[2];
+      for (int icy=0; icy<nc3[1]; icy++) {
+        int iy=icy+oc3[1];
+        for (int icx=0; icx<nc3[0]; icx++) {
+          ccount++;
+          int ix=icx+oc3[0];
+          int i_c=ix + mc3[0]*(iy + mc3[1]*iz);
+          cavg += vc[i_c];
+          cmin = std::min(cmin,vc[i_c]);
+          cmax = std::max(cmax,vc[i_c]);
+        }
       }
     }
-  }
-  for (int ifz=0; ifz<nf3[2]; ifz++) {
-    int iz=ifz+of3[2];
-    for (int ify=0; ify<nf3[1]; ify++) {
-      int iy=ify+of3[1];
-      for (int ifx=0; ifx<nf3[0]; ifx++) {
-        fcount++;
-        int ix=ifx+of3[0];
-        int i_f=ix + mf3[0]*(iy + mf3[1]*iz);
-        favg += values_f[i_f];
-        fmin = std::min(fmin,values_f[i_f]);
-        fmax = std::max(fmax,values_f[i_f]);
+    for (int ifz=0; ifz<nf3[2]; ifz++) {
+      int iz=ifz+of3[2];
+      for (int ify=0; ify<nf3[1]; ify++) {
+        int iy=ify+of3[1];
+        for (int ifx=0; ifx<nf3[0]; ifx++) {
+          fcount++;
+          int ix=ifx+of3[0];
+          int i_f=ix + mf3[0]*(iy + mf3[1]*iz);
+          favg += vf[i_f];
+          fmin = std::min(fmin,vf[i_f]);
+          fmax = std::max(fmax,vf[i_f]);
+        }
       }
     }
-  }
   
-  favg/=fcount;
-  cavg/=ccount;
-  if (accumulate == 1) {
-    CkPrintf ("TRACE_SUMS accum %d nc %d %d %d mn/avg/max %g %g %g\n",
-              accumulate,
-              nc3[0],nc3[1],nc3[2],
-              //            oc3[0],oc3[1],oc3[2],
-              //            mc3[0],mc3[1],mc3[2],
-              cmin,cavg,cmax);
-    CkPrintf ("TRACE_SUMS accum %d nf %d %d %d mn/avg/max %g %g %g\n",
-              accumulate,
-              nf3[0],nf3[1],nf3[2],
-              //            of3[0],of3[1],of3[2],
-              //            mf3[0],mf3[1],mf3[2],
-              fmin,favg,fmax);
-  }
+    favg/=fcount;
+    cavg/=ccount;
+    if (accumulate == 1) {
+      CkPrintf ("TRACE_SUMS accum %d nc %d %d %d mn/avg/max %g %g %g\n",
+                accumulate,
+                nc3[0],nc3[1],nc3[2],
+                cmin,cavg,cmax);
+      CkPrintf ("TRACE_SUMS accum %d nf %d %d %d mn/avg/max %g %g %g\n",
+                accumulate,
+                nf3[0],nf3[1],nf3[2],
+                fmin,favg,fmax);
+    }
 #endif        
 
-  if (accumulate) {
-    int i0 = of3[0] + mf3[0]*(of3[1] + mf3[1]*of3[2]);
-    for (int iz=0; iz<nf3[2]; iz++) {
-      for (int iy=0; iy<nf3[1]; iy++) {
-        for (int ix=0; ix<nf3[0]; ix++) {
-          int i = i0 + ix + mf3[0]*(iy + mf3[1]*iz);
-          values_f[i] += temp_f[i];
+    if (accumulate) {
+      int i0 = of3[0] + mf3[0]*(of3[1] + mf3[1]*of3[2]);
+      for (int iz=0; iz<nf3[2]; iz++) {
+        for (int iy=0; iy<nf3[1]; iy++) {
+          for (int ix=0; ix<nf3[0]; ix++) {
+            int i = i0 + ix + mf3[0]*(iy + mf3[1]*iz);
+            vf[i] += temp_f[i];
+          }
         }
       }
     }
-    delete [] temp_f;
   }
 }
 
@@ -36,6 +36,14 @@ public: // interface
     const void * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
 
+  /// Prolong a list of fields with the same geometry, computing the
+  /// interpolation weights once
+  virtual void apply_list
+  ( precision_type precision, int num_fields,
+    void *       const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const void * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    bool accumulate = false);
+
   /// Return the name identifying the prolongation operator
   virtual std::string name () const { return "linear"; }
 
@@ -60,10 +68,17 @@ private: // functions
 
   template <class T>  
   void apply_
-  ( T *       values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
-    const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+  ( int num_fields,
+    T *       const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const T * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
 
+  /// Compute the coarse index (offset by oc) and the two linear
+  /// interpolation weights for each of the nf fine cells along an axis
+  template <class T>
+  void weights_ (int nf, int oc, int gc, std::vector<int> & ic,
+                 std::vector<T> & w0, std::vector<T> & w1);
+
 private: // attributes
 
   // NOTE: change pup() function whenever attributes change
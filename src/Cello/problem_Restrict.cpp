@@ -14,5 +14,23 @@ Restrict::Restrict() throw ()
   TRACE("Restrict::Restrict");
 }
 
+//----------------------------------------------------------------------
+
+int Restrict::apply_list
+( precision_type precision, int num_fields,
+  void *       const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+  const void * const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+  bool accumulate)
+{
+  int num_bytes = 0;
+  for (int i_f=0; i_f<num_fields; i_f++) {
+    num_bytes += apply (precision,
+                        values_c[i_f], nd3_c, im3_c, n3_c,
+                        values_f[i_f], nd3_f, im3_f, n3_f,
+                        accumulate);
+  }
+  return num_bytes;
+}
+
 //======================================================================
 
@@ -41,6 +41,15 @@ public: // virtual functions
     const void * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
     bool accumulate = false) = 0;
 
+  /// Restrict a list of fields that share the same precision, array
+  /// dimensions, and loop limits, returning the total number of bytes
+  /// written.  The default calls apply() for each field
+  virtual int apply_list
+  ( precision_type precision, int num_fields,
+    void *       const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    const void * const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    bool accumulate = false);
+
   /// Return the name identifying the restrict operator
   virtual std::string name () const = 0;
 
@@ -38,6 +38,9 @@ Simulation::Simulation
   time_(0.0),
   dt_(0),
   stop_(false),
+  subcycle_level_min_(0),
+  subcycle_level_max_(0),
+  subcycle_cycle_sync_(0),
   phase_(phase_unknown),
   config_(&g_config),
   problem_(NULL),
@@ -110,6 +113,9 @@ Simulation::Simulation()
   time_(0.0),
   dt_(0),
   stop_(false),
+  subcycle_level_min_(0),
+  subcycle_level_max_(0),
+  subcycle_cycle_sync_(0),
   phase_(phase_unknown),
   config_(&g_config),
   problem_(NULL),
@@ -170,6 +176,9 @@ Simulation::Simulation (CkMigrateMessage *m)
     time_(0.0),
     dt_(0),
     stop_(false),
+    subcycle_level_min_(0),
+    subcycle_level_max_(0),
+    subcycle_cycle_sync_(0),
     phase_(phase_unknown),
     config_(&g_config),
     problem_(NULL),
@@ -251,6 +260,9 @@ void Simulation::pup (PUP::er &p)
   p | time_;
   p | dt_;
   p | stop_;
+  p | subcycle_level_min_;
+  p | subcycle_level_max_;
+  p | subcycle_cycle_sync_;
   p | phase_;
 
   p | problem_; // PUPable
@@ -318,6 +330,12 @@ void Simulation::pup (PUP::er &p)
 	  (msg_refine_map_.size() == 0));
 
   //  p | msg_refine_map_;
+
+  ASSERT1("Simulation::pup()",
+	  "refresh_aggregate_ is assumed to be empty but has size %lu",
+	  refresh_aggregate_.size(),
+	  (refresh_aggregate_.size() == 0));
+
   p | index_output_;
   p | num_solver_iter_;
   p | max_solver_iter_;
@@ -396,6 +414,8 @@ void Simulation::initialize_memory_() throw()
     memory->set_warning_mb (config_->memory_warning_mb);
     memory->set_limit_gb (config_->memory_limit_gb);
   }
+  MemoryPool::instance()->set_bytes_limit
+    (int64_t(config_->memory_pool_mb*1024*1024));
 }
 //----------------------------------------------------------------------
 
@@ -412,6 +432,7 @@ void Simulation::initialize_performance_() throw()
   p->new_region(perf_initial,            "initial");
   p->new_region(perf_adapt_apply,        "adapt_apply");
   p->new_region(perf_adapt_apply_sync,   "adapt_apply_sync",in_charm);
+  p->new_region(perf_adapt_compute,      "adapt_compute");
   p->new_region(perf_adapt_notify,       "adapt_notify");
   p->new_region(perf_adapt_notify_sync,  "adapt_notify_sync",in_charm);
   p->new_region(perf_adapt_update,       "adapt_update");
@@ -867,6 +888,28 @@ void Simulation::update_state(int cycle, double time, double dt, double stop)
 
 //----------------------------------------------------------------------
 
+void Simulation::set_subcycle_levels
+(int level_min, int level_max, int cycle) throw()
+{
+  if (level_min != subcycle_level_min_ ||
+      level_max != subcycle_level_max_) {
+    subcycle_cycle_sync_ = cycle;
+  }
+  subcycle_level_min_ = level_min;
+  subcycle_level_max_ = level_max;
+}
+
+//----------------------------------------------------------------------
+
+int Simulation::subcycle_ratio(int level) const throw()
+{
+  const int depth = std::min(subcycle_level_max_ - level,
+                             config_->stopping_subcycle_max_levels);
+  return (depth > 0) ? (1 << depth) : 1;
+}
+
+//----------------------------------------------------------------------
+
 void Simulation::p_initialize_state(MsgState * msg)
 {
   msg->update(this);
@@ -943,19 +986,24 @@ void Simulation::monitor_performance()
   // 5 data_msg
   // 6 field_face
   // 7 particle_data
-  // 8 num-particles
-  // 9+ num_solver_iters
-  // NL+ num-blocks-<L>
-  // 10+ num_blocks_total
-  // 11+ max_proc_blocks
-  // 12+ max_proc_particles
-  // 13+ max_node_blocks
-  // 14+ max_node_particles
-  // 15+ max_solver_iters
+  // 8 num-field-pool-hit
+  // 9 num-field-pool-miss
+  // 10 num-particles
+  // 11 num-particles-scanned
+  // 12 num-particles-migrated
+  // 13   .. 13+S-1 num_solver_iters (S = number of solvers)
+  // B    .. B+NL-1 num-blocks-<L> (B = 13+S, NL = number of levels)
+  // B+NL num_blocks_total
+  // R    .. R+nr*nc-1 performance region counters (R = B+NL+1)
+  // M    max_proc_blocks (M = R+nr*nc)
+  // M+1  max_proc_particles
+  // M+2  max_node_blocks
+  // M+3  max_node_particles
+  // M+4  .. M+4+S-1 max_solver_iters
   
   const int num_solver = problem()->num_solvers();
 
-  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
+  int n = 18 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
 
   
   long long * counters_region = new long long [nc];
@@ -976,9 +1024,13 @@ void Simulation::monitor_performance()
   counters_reduce[m++] = DataMsg::counter[in];        // 5
   counters_reduce[m++] = FieldFace::counter[in];      // 6
   counters_reduce[m++] = ParticleData::counter[in];   // 7
-  counters_reduce[m++] = hierarchy_->num_particles(); // 8
+  counters_reduce[m++] = MemoryPool::instance()->num_hit();  // 8
+  counters_reduce[m++] = MemoryPool::instance()->num_miss(); // 9
+  counters_reduce[m++] = hierarchy_->num_particles(); // 10
+  counters_reduce[m++] = ParticleData::counter_scanned[in];  // 11
+  counters_reduce[m++] = ParticleData::counter_migrated[in]; // 12
   for (int i=0; i<num_solver; i++) {
-    counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 9
+    counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 13+i
   }
 
   const int min_level = hierarchy_->min_level();
@@ -986,9 +1038,9 @@ void Simulation::monitor_performance()
   int num_blocks_total = 0;
   for (int i=min_level; i<=hierarchy_->max_level(); i++) {
     num_blocks_total +=  hierarchy_->num_blocks(i);
-    counters_reduce[m++] = hierarchy_->num_blocks(i); // NL
+    counters_reduce[m++] = hierarchy_->num_blocks(i); // B+L
   }
-  counters_reduce[m++] = num_blocks_total;            // 10  num_blocks_total
+  counters_reduce[m++] = num_blocks_total;            // B+NL num_blocks_total
   
   // performance region counters
   for (int ir = 0; ir < nr; ir++) {
@@ -1000,12 +1052,12 @@ void Simulation::monitor_performance()
 
   // maximum metrics
   
-  counters_reduce[m++] = num_blocks_total;            // 11  max_proc_blocks
-  counters_reduce[m++] = hierarchy_->num_particles(); // 12  max_proc_particles
-  counters_reduce[m++] = Hierarchy::num_blocks_node;  // 13  max_node_blocks
-  counters_reduce[m++] = Hierarchy::num_particles_node;// 14 max_node_particles
+  counters_reduce[m++] = num_blocks_total;            // M    max_proc_blocks
+  counters_reduce[m++] = hierarchy_->num_particles(); // M+1  max_proc_particles
+  counters_reduce[m++] = Hierarchy::num_blocks_node;  // M+2  max_node_blocks
+  counters_reduce[m++] = Hierarchy::num_particles_node;// M+3 max_node_particles
   for (int i=0; i<num_solver; i++) {
-    counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 15 max_node_particles
+    counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // M+4+i max_solver_iters
   }
 
   ASSERT2("Simulation::monitor_performance()",
@@ -1048,11 +1100,15 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     const long long data_msg    = counters_reduce[m++];   // 5
     const long long field_face  = counters_reduce[m++];   // 6
     const long long particle_data = counters_reduce[m++]; // 7
-    const long long num_particles = counters_reduce[m++]; // 8
+    const long long pool_hit    = counters_reduce[m++];   // 8
+    const long long pool_miss   = counters_reduce[m++];   // 9
+    const long long num_particles = counters_reduce[m++]; // 10
+    const long long particles_scanned  = counters_reduce[m++]; // 11
+    const long long particles_migrated = counters_reduce[m++]; // 12
 
     const int num_solver = problem()->num_solvers();
     for (int i=0; i<num_solver; i++) {
-      const long long num_solver_iter = counters_reduce[m++]; // 15
+      const long long num_solver_iter = counters_reduce[m++]; // 13+i
       monitor()->print ("Performance","solver num-%s-iter %lld",
                         problem()->solver(i)->name().c_str(),
                         num_solver_iter);
@@ -1064,15 +1120,25 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     monitor()->print("Performance","counter num-data-msg %lld", data_msg);
     monitor()->print("Performance","counter num-field-face %lld", field_face);
     monitor()->print("Performance","counter num-particle-data %lld", particle_data);
+    monitor()->print("Performance","counter num-field-pool-hit %lld", pool_hit);
+    monitor()->print("Performance","counter num-field-pool-miss %lld", pool_miss);
+    if (pool_hit + pool_miss > 0) {
+      monitor()->print("Performance","counter field-pool-hit-rate %f",
+                       1.0*pool_hit/(pool_hit + pool_miss));
+    }
 
     monitor()->print("Performance","simulation num-particles total %lld",
                      num_particles);
+    monitor()->print("Performance","counter num-particles-scanned %lld",
+                     particles_scanned);
+    monitor()->print("Performance","counter num-particles-migrated %lld",
+                     particles_migrated);
 
     // compute total blocks and leaf blocks
     long long num_total_blocks = 0;
     long long num_leaf_blocks = 0;
     for (int i=hierarchy_->min_level(); i<=hierarchy_->max_level(); i++) {
-      const long long num_blocks_level = counters_reduce[m++]; // NL
+      const long long num_blocks_level = counters_reduce[m++]; // B+L
       monitor()->print("performance","simulation num-blocks-level %d %lld",
                        i,num_blocks_level);
 
@@ -1092,7 +1158,7 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     monitor()->print
       ("Performance","simulation num-total-blocks %lld", num_total_blocks);
 
-    const long long num_blocks_total   = counters_reduce[m++]; // 10
+    const long long num_blocks_total   = counters_reduce[m++]; // B+NL
 
     if (num_total_blocks != num_blocks_total) {
       WARNING2 ("Simulation::r_monitor_performance_reduce()",
@@ -1118,13 +1184,13 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
       }
     }
 
-    const long long max_proc_blocks    = counters_reduce[m++]; // 11
-    const long long max_proc_particles = counters_reduce[m++]; // 12
-    const long long max_node_blocks    = counters_reduce[m++]; // 13
-    const long long max_node_particles = counters_reduce[m++]; // 14
+    const long long max_proc_blocks    = counters_reduce[m++]; // M
+    const long long max_proc_particles = counters_reduce[m++]; // M+1
+    const long long max_node_blocks    = counters_reduce[m++]; // M+2
+    const long long max_node_particles = counters_reduce[m++]; // M+3
 
     for (int i=0; i<num_solver; i++) {
-      const long long max_solver_iters       = counters_reduce[m++]; // 15
+      const long long max_solver_iters       = counters_reduce[m++]; // M+4+i
       monitor()->print ("Performance","solver max-%s-iter %lld",
                         problem()->solver(i)->name().c_str(),
                         max_solver_iters);
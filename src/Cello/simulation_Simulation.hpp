@@ -137,6 +137,10 @@ public: // interface
   void set_stop(bool stop) throw()
   { stop_ = stop; }
 
+  /// Set the coarsest and finest leaf levels used for subcycling,
+  /// forcing a sync cycle if they changed
+  void set_subcycle_levels(int level_min, int level_max, int cycle) throw();
+
   /// Return true iff cycle_ changes
   bool cycle_changed() {
     bool value = false;
@@ -167,6 +171,22 @@ public: // interface
   bool stop() const throw() 
   { return stop_; };
 
+  /// Return the coarsest leaf level (stored from stopping reduction)
+  int subcycle_level_min() const throw()
+  { return subcycle_level_min_; };
+
+  /// Return the finest leaf level (stored from stopping reduction)
+  int subcycle_level_max() const throw()
+  { return subcycle_level_max_; };
+
+  /// Return the last cycle in which all levels must be stepped
+  int subcycle_cycle_sync() const throw()
+  { return subcycle_cycle_sync_; };
+
+  /// Return the number of cycles per step of subcycled Methods on
+  /// the given level
+  int subcycle_ratio(int level) const throw();
+
   /// Return the current phase of the simulation
   int phase() const throw() 
   { return phase_; };
@@ -406,6 +426,18 @@ public: // virtual functions
   int refresh_count() const
   { return refresh_list_.size(); }
 
+  /// Hold a refresh message from a Block on this process to a Block
+  /// on process ip, to be sent by p_refresh_flush()
+  void refresh_aggregate (int ip, Index index, MsgRefresh * msg_refresh);
+
+  /// Send refresh messages held by refresh_aggregate(), aggregated
+  /// into one message per destination process
+  void p_refresh_flush ();
+
+  /// Forward MsgRefresh messages aggregated on another process to
+  /// the destination Blocks on this process
+  void p_refresh_recv_aggregate (MsgRefreshAggregate * msg);
+
   //--------------------------------------
   // Initialization
   //--------------------------------------
@@ -516,6 +548,13 @@ protected: // attributes
   /// Current stopping criteria
   bool stop_;
 
+  /// Coarsest and finest leaf levels for subcycling
+  int subcycle_level_min_;
+  int subcycle_level_max_;
+
+  /// Last cycle in which all levels were stepped due to level changes
+  int subcycle_cycle_sync_;
+
   /// Current phase of the cycle
   mutable int phase_;
 
@@ -588,6 +627,11 @@ protected: // attributes
 
   std::map<Index,MsgRefine *> msg_refine_map_;
 
+  /// Outgoing refresh messages from Blocks on this process held for
+  /// aggregation, indexed by destination process.  Not empty only
+  /// while a p_refresh_flush() is pending
+  std::map < int, MsgRefreshAggregate * > refresh_aggregate_;
+
   /// Currently active output object
   int index_output_;
 
@@ -245,6 +245,74 @@ PARALLEL_MAIN_BEGIN
   unit_assert(true);
 #endif/* CONFIG_USE_MEMORY */
 
+  //----------------------------------------------------------------------
+  // MemoryPool
+  //----------------------------------------------------------------------
+
+  unit_class("MemoryPool");
+
+  MemoryPool * pool = MemoryPool::instance();
+
+  std::vector<char> a1, a2, a3;
+
+  unit_func("allocate()");
+
+  // inactive pool allocates directly
+
+  pool->allocate(a1,100);
+  unit_assert (a1.size() == 100);
+  unit_assert (pool->num_hit() == 0 && pool->num_miss() == 0);
+
+  pool->deallocate(a1);
+  unit_assert (a1.size() == 0);
+  unit_assert (pool->bytes() == 0);
+
+  pool->set_bytes_limit(250);
+  unit_assert (pool->bytes_limit() == 250);
+
+  pool->allocate(a1,100);
+  pool->allocate(a2,100);
+  unit_assert (pool->num_miss() == 2);
+
+  unit_func("deallocate()");
+
+  const char * p1 = &a1[0];
+  a1[17] = 17;
+  pool->deallocate(a1);
+  pool->deallocate(a2);
+  unit_assert (a1.size() == 0);
+  unit_assert (pool->bytes() == 200);
+
+  // different size misses
+
+  pool->allocate(a3,60);
+  unit_assert (pool->num_miss() == 3);
+  unit_assert (pool->num_hit() == 0);
+
+  // same size hits; reused arrays are not cleared, so their values
+  // are unspecified
+
+  pool->allocate(a1,100);
+  pool->allocate(a2,100);
+  unit_assert (pool->num_hit() == 2);
+  unit_assert (pool->bytes() == 0);
+  unit_assert (a1.size() == 100 && a2.size() == 100);
+  unit_assert (&a1[0] == p1 || &a2[0] == p1);
+
+  // pool over limit frees instead
+
+  pool->deallocate(a1);
+  pool->deallocate(a2);
+  pool->deallocate(a3);
+  unit_assert (a3.size() == 0);
+  unit_assert (pool->bytes() == 200);
+
+  unit_func("clear()");
+
+  pool->clear();
+  unit_assert (pool->bytes() == 0);
+  pool->set_bytes_limit(0);
+
   unit_finalize();
 
   exit_();
@@ -105,12 +105,24 @@ void generate_input()
   fp << "     }\n";
   fp << "  }\n";
 
+  fp << " Float_expr {\n";
+  fp << "    var_float_3 {\n";
+  fp << "       num1 = (x + 2.0*3.0) * y - z / 4.0 + t^2.0;\n";
+  fp << "       num2 = sqrt(4.0) * x;\n";
+  fp << "       num3 = exp(0.0 - x*x) + sqrt(fabs(y));\n";
+  fp << "     }\n";
+  fp << "  }\n";
+
   fp << " Logical_expr {\n";
   fp << "  var_logical {\n";
   fp << "    num1 = x < y;\n";
   fp << "    num2 = x + y >= t + 3.0;\n";
   fp << "    num3 = x == y;\n";
   fp << "  }\n";
+  fp << "  var_logical_2 {\n";
+  fp << "    num1 = (x < y && y <= z) || x > 0.5;\n";
+  fp << "    num2 = x + y > z && x != y;\n";
+  fp << "  }\n";
   fp << "}\n";
 
   fp << " List {\n";
@@ -421,6 +433,88 @@ void check_parameters(Parameters * parameters)
   unit_assert (values_logical[1] == (x[1] == y[1]));
   unit_assert (values_logical[2] == (x[2] == y[2]));
 
+  //--------------------------------------------------
+  unit_func("evaluate_float (tiled)");
+  //--------------------------------------------------
+
+  // more than one ParamExpr tile, with a partial last tile
+
+  const int n = 2*ParamExpr::tile_size + 17;
+  std::vector<double> xn(n), yn(n), zn(n);
+  for (int i=0; i<n; i++) {
+    xn[i] = 0.01*i - 1.0;
+    yn[i] = 1.0 - 0.02*i;
+    zn[i] = 0.5 + 0.003*i;
+  }
+  // every other y equals x, to exercise == in logical expressions
+  for (int i=0; i<n; i+=2) yn[i] = xn[i];
+  const double tn = 0.25;
+
+  std::vector<double> values_n(n), deflts_n(n,-1.0);
+
+  parameters->group_set(0,"Float_expr");
+  parameters->group_set(1,"var_float_3");
+
+  bool passed;
+
+  parameters->evaluate_float
+    ("num1",n,values_n.data(),deflts_n.data(),xn.data(),yn.data(),zn.data(),tn);
+  passed = true;
+  for (int i=0; i<n; i++) {
+    const double value = (xn[i] + 6.0)*yn[i] - zn[i]/4.0 + tn*tn;
+    passed = passed &&
+      (fabs(values_n[i] - value) <= 4*MACH_EPS*(1.0 + fabs(value)));
+  }
+  unit_assert (passed);
+
+  parameters->evaluate_float
+    ("num2",n,values_n.data(),deflts_n.data(),xn.data(),yn.data(),zn.data(),tn);
+  passed = true;
+  for (int i=0; i<n; i++) {
+    passed = passed && (values_n[i] == 2.0*xn[i]);
+  }
+  unit_assert (passed);
+
+  parameters->evaluate_float
+    ("num3",n,values_n.data(),deflts_n.data(),xn.data(),yn.data(),zn.data(),tn);
+  passed = true;
+  for (int i=0; i<n; i++) {
+    const double value = exp(-xn[i]*xn[i]) + sqrt(fabs(yn[i]));
+    passed = passed && CLOSE(values_n[i],value);
+  }
+  unit_assert (passed);
+
+  //--------------------------------------------------
+  unit_func("evaluate_logical (tiled)");
+  //--------------------------------------------------
+
+  bool * logical_n = new bool [n];
+  bool * deflts_logical_n = new bool [n];
+
+  parameters->group_set(0,"Logical_expr");
+  parameters->group_set(1,"var_logical_2");
+
+  parameters->evaluate_logical
+    ("num1",n,logical_n,deflts_logical_n,xn.data(),yn.data(),zn.data(),tn);
+  passed = true;
+  for (int i=0; i<n; i++) {
+    const bool value = (xn[i] < yn[i] && yn[i] <= zn[i]) || xn[i] > 0.5;
+    passed = passed && (logical_n[i] == value);
+  }
+  unit_assert (passed);
+
+  parameters->evaluate_logical
+    ("num2",n,logical_n,deflts_logical_n,xn.data(),yn.data(),zn.data(),tn);
+  passed = true;
+  for (int i=0; i<n; i++) {
+    const bool value = (xn[i] + yn[i] > zn[i]) && (xn[i] != yn[i]);
+    passed = passed && (logical_n[i] == value);
+  }
+  unit_assert (passed);
+
+  delete [] logical_n;
+  delete [] deflts_logical_n;
+
   //--------------------------------------------------
   // Lists
   //--------------------------------------------------
@@ -501,11 +595,11 @@ void check_parameters(Parameters * parameters)
     int count;
   } child_count[NUM_GROUPS] = {
     {"Float",       4 + 3},
-    {"Float_expr",  2},
+    {"Float_expr",  3},
     {"Integer",     2 + 2},
     {"List",        3},
     {"Logical",     2 + 2},
-    {"Logical_expr",1},
+    {"Logical_expr",2},
     {"String",      2 + 1},
     {"Duplicate",   1}
   };
@@ -342,6 +342,45 @@ PARALLEL_MAIN_BEGIN
   particle.index(20000,&ib,&ip);
   unit_assert (ib == 20000/mb);
   unit_assert (ip == 20000%mb);
+
+  unit_func("position_extent()");
+  {
+    const double lower[3] = {-1.0, -2.0, -3.0};
+    const double upper[3] = { 1.0,  2.0,  3.0};
+    double lower_get[3], upper_get[3];
+    const int nb_dark = particle.num_batches(it_dark);
+
+    unit_assert (! particle.position_extent(it_dark,0,lower_get,upper_get));
+
+    particle.set_position_extent(it_dark,1,lower,upper);
+    unit_assert (particle.position_extent(it_dark,1,lower_get,upper_get));
+    unit_assert (lower_get[0] == lower[0] && upper_get[0] == upper[0]);
+    unit_assert (lower_get[2] == lower[2] && upper_get[2] == upper[2]);
+    unit_assert (! particle.position_extent(it_dark,0,lower_get,upper_get));
+
+    // ...writable non-position attributes keep the extent
+    particle.attribute_array(it_dark,ia_dark_m,1);
+    unit_assert (particle.position_extent(it_dark,1,lower_get,upper_get));
+
+    // ...writable position attributes discard it
+    particle.attribute_array(it_dark,ia_dark_y,1);
+    unit_assert (! particle.position_extent(it_dark,1,lower_get,upper_get));
+
+    // ...inserting particles into the batch discards it
+    particle.set_position_extent(it_dark,nb_dark-1,lower,upper);
+    unit_assert (particle.position_extent(it_dark,nb_dark-1,lower_get,upper_get));
+    particle.insert_particles (it_dark, 1);
+    unit_assert (particle.num_batches(it_dark) == nb_dark);
+    unit_assert (! particle.position_extent(it_dark,nb_dark-1,lower_get,upper_get));
+
+    // ...remove the inserted particle
+    const int np_last = particle.num_particles(it_dark,nb_dark-1);
+    bool * mask = new bool[np_last];
+    for (int i=0; i<np_last; i++) mask[i] = (i == np_last-1);
+    particle.delete_particles (it_dark, nb_dark-1, mask);
+    delete [] mask;
+    unit_assert (particle.num_particles(it_dark) == 10000);
+  }
   
   int i_dark_1 = particle.insert_particles (it_dark, 20000);
   int i_trace_1 = particle.insert_particles (it_trace, 10000);
@@ -734,6 +773,83 @@ PARALLEL_MAIN_BEGIN
   unit_assert (particle.efficiency (it_trace)   > 0.99);
   unit_assert (particle.efficiency ()           > 0.90);
 
+  //--------------------------------------------------
+  //   SORT
+  //--------------------------------------------------
+
+  unit_func("sort()");
+
+  {
+    const int num_keys = 97;
+
+    // dark: key stored in velocity_x, copied to velocity_y to check
+    // that attributes are permuted together
+
+    const int np_dark = particle.num_particles(it_dark);
+    std::vector<int> key (np_dark);
+    int i = 0;
+    for (int ib=0; ib<particle.num_batches(it_dark); ib++) {
+      double * vx = (double *) particle.attribute_array(it_dark,ia_dark_vx,ib);
+      double * vy = (double *) particle.attribute_array(it_dark,ia_dark_vy,ib);
+      const int dv = particle.stride(it_dark,ia_dark_vx);
+      for (int ip=0; ip<particle.num_particles(it_dark,ib); ip++,i++) {
+        key[i] = (7919*i) % num_keys;
+        vx[ip*dv] = key[i];
+        vy[ip*dv] = i;
+      }
+    }
+
+    particle.sort(it_dark,key.data(),num_keys);
+
+    unit_assert (particle.num_particles(it_dark) == np_dark);
+    unit_assert (particle.efficiency (it_dark,0) > 0.99);
+
+    int count_wrong = 0;
+    double key_prev = -1.0, id_prev = -1.0;
+    for (int i=0; i<np_dark; i++) {
+      int ib,ip;
+      particle.index(i,&ib,&ip);
+      double * vx = (double *) particle.attribute_array(it_dark,ia_dark_vx,ib);
+      double * vy = (double *) particle.attribute_array(it_dark,ia_dark_vy,ib);
+      const int dv = particle.stride(it_dark,ia_dark_vx);
+      const double k  = vx[ip*dv];
+      const double id = vy[ip*dv];
+      // sorted by key, stable within key
+      if (k < key_prev) count_wrong++;
+      if (k == key_prev && id <= id_prev) count_wrong++;
+      if ((7919*int(id)) % num_keys != int(k)) count_wrong++;
+      key_prev = k;
+      id_prev = id;
+    }
+    unit_assert (count_wrong == 0);
+
+    // trace: interleaved, reverse order
+
+    const int np_trace = particle.num_particles(it_trace);
+    key.resize(np_trace);
+    i = 0;
+    for (int ib=0; ib<particle.num_batches(it_trace); ib++) {
+      int32_t * x = (int32_t *) particle.attribute_array(it_trace,ia_trace_x,ib);
+      const int dx = particle.stride(it_trace,ia_trace_x);
+      for (int ip=0; ip<particle.num_particles(it_trace,ib); ip++,i++) {
+        key[i] = np_trace - 1 - i;
+        x[ip*dx] = i;
+      }
+    }
+
+    particle.sort(it_trace,key.data(),np_trace);
+
+    count_wrong = 0;
+    for (int i=0; i<np_trace; i++) {
+      int ib,ip;
+      particle.index(i,&ib,&ip);
+      int32_t * x = (int32_t *) particle.attribute_array(it_trace,ia_trace_x,ib);
+      const int dx = particle.stride(it_trace,ia_trace_x);
+      if (x[ip*dx] != np_trace - 1 - i) count_wrong++;
+    }
+    unit_assert (count_wrong == 0);
+  }
+
   //--------------------------------------------------
   //   GATHER / SCATTER
   //--------------------------------------------------
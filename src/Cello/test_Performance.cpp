@@ -138,6 +138,23 @@ PARALLEL_MAIN_BEGIN
   unit_assert(region_counters[index_counter_1] == 50);
   unit_assert(region_counters[index_counter_2] == 100);
 
+  unit_func("new_counter after begin");
+
+  int id_counter_3 = performance->new_counter(counter_type_user,"counter_3");
+
+  long long * region_counters_3 = new long long [num_counters + 1];
+
+  performance->start_region(id_region_2);
+  performance->increment_counter(id_counter_3,30);
+  performance->stop_region(id_region_2);
+
+  performance->region_counters(id_region_2,region_counters_3);
+
+  unit_assert(region_counters_3[id_counter_3] == 30);
+  unit_assert(region_counters_3[index_counter_2] == 100);
+
+  delete [] region_counters_3;
+
   performance->end();
 
   int num_regions = performance->num_regions();
@@ -0,0 +1,114 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Philox.cpp
+/// @date     2026-10-17
+/// @brief    Test program for the Philox class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "cello.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Philox");
+
+  unit_func("philox4x32_10");
+
+  // known-answer tests from the Random123 distribution
+  {
+    const uint32_t c4[4] = { 0, 0, 0, 0 };
+    const uint32_t k2[2] = { 0, 0 };
+    uint32_t r4[4];
+    Philox::philox4x32_10(c4,k2,r4);
+    unit_assert (r4[0] == 0x6627e8d5u);
+    unit_assert (r4[1] == 0xe169c58du);
+    unit_assert (r4[2] == 0xbc57ac4cu);
+    unit_assert (r4[3] == 0x9b00dbd8u);
+  }
+  {
+    const uint32_t c4[4] = { 0xffffffffu, 0xffffffffu,
+                             0xffffffffu, 0xffffffffu };
+    const uint32_t k2[2] = { 0xffffffffu, 0xffffffffu };
+    uint32_t r4[4];
+    Philox::philox4x32_10(c4,k2,r4);
+    unit_assert (r4[0] == 0x408f276du);
+    unit_assert (r4[1] == 0x41c83b0eu);
+    unit_assert (r4[2] == 0xa20bc7c6u);
+    unit_assert (r4[3] == 0x6d5451fdu);
+  }
+  {
+    const uint32_t c4[4] = { 0x243f6a88u, 0x85a308d3u,
+                             0x13198a2eu, 0x03707344u };
+    const uint32_t k2[2] = { 0xa4093822u, 0x299f31d0u };
+    uint32_t r4[4];
+    Philox::philox4x32_10(c4,k2,r4);
+    unit_assert (r4[0] == 0xd16cfe09u);
+    unit_assert (r4[1] == 0x94fdccebu);
+    unit_assert (r4[2] == 0x5001e420u);
+    unit_assert (r4[3] == 0x24126ea1u);
+  }
+
+  unit_func("generate");
+
+  // the counter is (i, index3) and the key is (stream, cycle)
+  {
+    const int index3[3] = { 0x243f6a88, int(0x85a308d3u), 0x13198a2e };
+    Philox philox (int(0xa4093822u), 0x299f31d0, index3);
+    uint32_t r4[4];
+    philox.generate(0x03707344u, r4);
+    const uint32_t c4[4] = { 0x03707344u, 0x243f6a88u,
+                             0x85a308d3u, 0x13198a2eu };
+    const uint32_t k2[2] = { 0xa4093822u, 0x299f31d0u };
+    uint32_t s4[4];
+    Philox::philox4x32_10(c4,k2,s4);
+    unit_assert (r4[0] == s4[0]);
+    unit_assert (r4[1] == s4[1]);
+    unit_assert (r4[2] == s4[2]);
+    unit_assert (r4[3] == s4[3]);
+  }
+
+  unit_func("uniform");
+
+  {
+    const int index3[3] = { 1, 2, 3 };
+    Philox philox_1 (0, 10, index3);
+    Philox philox_2 (0, 10, index3);
+    Philox philox_3 (1, 10, index3);
+    Philox philox_4 (0, 11, index3);
+
+    const int n = 100000;
+    double sum = 0.0;
+    bool in_range = true;
+    bool same = true;
+    int num_equal_3 = 0;
+    int num_equal_4 = 0;
+    for (int i=0; i<n; i++) {
+      const double u = philox_1.uniform(i);
+      in_range = in_range && (0.0 <= u) && (u < 1.0);
+      same = same && (u == philox_2.uniform(i));
+      if (u == philox_3.uniform(i)) ++num_equal_3;
+      if (u == philox_4.uniform(i)) ++num_equal_4;
+      sum += u;
+    }
+    unit_assert (in_range);
+    // same key and counter give the same value
+    unit_assert (same);
+    // different streams and cycles are independent
+    unit_assert (num_equal_3 == 0);
+    unit_assert (num_equal_4 == 0);
+    // mean of n uniform values has standard deviation 1/sqrt(12 n) ~ 0.001
+    unit_assert (fabs(sum/n - 0.5) < 0.005);
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
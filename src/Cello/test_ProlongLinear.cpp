@@ -33,6 +33,89 @@ double fun (double x, double y=0.0, double z=0.0)
 double p_c(int i) { return 2.0*i + 0.5; }
 double p_f(int i) { return i; }
 
+//----------------------------------------------------------------------
+
+/// Return whether Prolong::apply_list() (if prolong is not null) or
+/// Restrict::apply_list() gives bit-for-bit the same values as calling
+/// apply() for each field.  If alias is true the destination of field
+/// 0 is also the source of field 1, so field 1 reads values written
+/// by field 0
+
+bool test_apply_list
+(Prolong * prolong, Restrict * restrict_op,
+ int rank, int gc, bool accumulate, bool alias)
+{
+  const int num_fields = 3;
+
+  // destination and source array sizes, offsets, and loop limits
+  int md3[3]={1,1,1}, od3[3]={0,0,0}, nd3[3]={1,1,1};
+  int ms3[3]={1,1,1}, os3[3]={0,0,0}, ns3[3]={1,1,1};
+  for (int axis=0; axis<rank; axis++) {
+    if (prolong) {
+      md3[axis] = 24; od3[axis] = 2;    nd3[axis] = 16;
+      ms3[axis] = 14; os3[axis] = 2-gc; ns3[axis] = 8+2*gc;
+    } else {
+      md3[axis] = 14; od3[axis] = 3;    nd3[axis] = 8;
+      ms3[axis] = 24; os3[axis] = 4;    ns3[axis] = 16;
+    }
+  }
+  const int m = std::max(md3[0]*md3[1]*md3[2], ms3[0]*ms3[1]*ms3[2]);
+
+  // arrays for apply() (a) and apply_list() (b)
+  std::vector<double> src_a[num_fields], dst_a[num_fields];
+  std::vector<double> src_b[num_fields], dst_b[num_fields];
+  for (int k=0; k<num_fields; k++) {
+    src_a[k].resize(m);
+    dst_a[k].resize(m);
+    for (int i=0; i<m; i++) {
+      src_a[k][i] = 1.0 + 0.25*k + sin(0.1*i + k);
+      dst_a[k][i] = 2.0 - 0.5*k + cos(0.3*i - k);
+    }
+    src_b[k] = src_a[k];
+    dst_b[k] = dst_a[k];
+  }
+
+  void *       pd_a[num_fields], * pd_b[num_fields];
+  const void * ps_a[num_fields], * ps_b[num_fields];
+  for (int k=0; k<num_fields; k++) {
+    pd_a[k] = dst_a[k].data();
+    pd_b[k] = dst_b[k].data();
+    ps_a[k] = src_a[k].data();
+    ps_b[k] = src_b[k].data();
+  }
+  if (alias) {
+    ps_a[1] = pd_a[0];
+    ps_b[1] = pd_b[0];
+  }
+
+  for (int k=0; k<num_fields; k++) {
+    if (prolong) {
+      prolong->apply (precision_double,
+                      pd_a[k], md3, od3, nd3,
+                      ps_a[k], ms3, os3, ns3, accumulate);
+    } else {
+      restrict_op->apply (precision_double,
+                       pd_a[k], md3, od3, nd3,
+                       ps_a[k], ms3, os3, ns3, accumulate);
+    }
+  }
+  if (prolong) {
+    prolong->apply_list (precision_double, num_fields,
+                         pd_b, md3, od3, nd3,
+                         ps_b, ms3, os3, ns3, accumulate);
+  } else {
+    restrict_op->apply_list (precision_double, num_fields,
+                          pd_b, md3, od3, nd3,
+                          ps_b, ms3, os3, ns3, accumulate);
+  }
+
+  bool l_equal = true;
+  for (int k=0; k<num_fields; k++) {
+    l_equal = l_equal && (dst_a[k] == dst_b[k]);
+  }
+  return l_equal;
+}
+
 PARALLEL_MAIN_BEGIN
 {
 
@@ -221,6 +304,27 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  //--------------------------------------------------
+
+  unit_func ("apply_list()");
+
+  {
+    Restrict * restrict_op = new RestrictLinear;
+    for (int rank=1; rank<=3; rank++) {
+      for (int alias=0; alias<2; alias++) {
+        for (int accumulate=0; accumulate<2; accumulate++) {
+          for (int gc=0; gc<2; gc++) {
+            unit_assert (test_apply_list
+                         (prolong, nullptr, rank, gc, accumulate, alias));
+          }
+          unit_assert (test_apply_list
+                       (nullptr, restrict_op, rank, 0, accumulate, alias));
+        }
+      }
+    }
+    delete restrict_op;
+  }
+
   //--------------------------------------------------
   
   delete prolong;
@@ -126,6 +126,7 @@ enum return_enum {
 
 #include "enzo-core/EnzoBlock.hpp"
 
+#include "inference/EnzoInferenceModel.hpp"
 #include "inference/EnzoLevelArray.hpp"
 #include "inference/EnzoMethodInference.hpp"
 
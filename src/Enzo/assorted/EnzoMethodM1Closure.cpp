@@ -47,7 +47,8 @@ EnzoMethodM1Closure::EnzoMethodM1Closure(ParameterGroup p)
     sigmaN_(),
     sigmaE_(),
     ir_injection_(-1),
-    M1_tables(nullptr)
+    M1_tables(nullptr),
+    transport_scratch_()
 {
 
   this->set_courant(p.value_float("courant",1.0));
@@ -763,42 +764,6 @@ void EnzoMethodM1Closure::compute_hll_eigenvalues (double f, double theta, doubl
 
 //----------------------------------------------------------------------
 
-double EnzoMethodM1Closure::flux_function (double U_l, double U_lplus1,
-					    double Q_l, double Q_lplus1, double clight,
-                                            double lmin, double lmax,  
-					    std::string type) throw()
-{
-  // returns face-flux of a cell at index idx
-  if (type == "GLF") {
-    return 0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) ); 
-  }
-
-  else if (type == "HLL") {
-    return (lmax*Q_l - lmin*Q_lplus1 + lmax*lmin*clight*(U_lplus1-U_l)) / (lmax - lmin);
-  }
-
-  else {
-    ERROR("EnzoMethodM1Closure::flux_function",
-	     "flux_function type not recognized");
-    return 0.0; 
-  }
-}
-
-//--------------------------------------------------------------------------
-
-double EnzoMethodM1Closure::deltaQ_faces (double U_l, double U_lplus1, double U_lminus1,
-                                                  double Q_l, double Q_lplus1, double Q_lminus1,
-                                                  double clight, double lmin, double lmax, 
-                                                  std::string flux_type) throw()
-{
-  // calls flux_function(), and calculates Q_{i-1/2} - Q_{i+1/2}
-  
-  return flux_function(U_lminus1, U_l     , Q_lminus1, Q_l     , clight, lmin, lmax, flux_type) - 
-         flux_function(U_l      , U_lplus1, Q_l      , Q_lplus1, clight, lmin, lmax, flux_type); 
-}
-
-//--------------------------------------------------------------------------
-
 void EnzoMethodM1Closure::get_reduced_variables (double * chi, double (*n)[3], int i, double clight,
                                enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz) throw()
 {
@@ -878,105 +843,104 @@ void EnzoMethodM1Closure::get_pressure_tensor (EnzoBlock * enzo_block,
 //--------------------------------------------------------------------------
 
 
-void EnzoMethodM1Closure::get_U_update (EnzoBlock * enzo_block, double * N_update, 
-                       double * Fx_update, double * Fy_update, double * Fz_update, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
-                       double hx, double hy, double hz, double dt, double clight, 
-                       int i, int idx, int idy, int idz) throw()
-{
-  Field field = enzo_block->data()->field();
-  // if rank >= 1
-  enzo_float * P00 = (enzo_float *) field.values("P00");
-  // if rank >= 2
-  enzo_float * P10 = (enzo_float *) field.values("P10");
-  enzo_float * P01 = (enzo_float *) field.values("P01");
-  enzo_float * P11 = (enzo_float *) field.values("P11");
-  // if rank >= 3
-  enzo_float * P02 = (enzo_float *) field.values("P02");
-  enzo_float * P12 = (enzo_float *) field.values("P12");
-  enzo_float * P20 = (enzo_float *) field.values("P20");
-  enzo_float * P21 = (enzo_float *) field.values("P21"); 
-  enzo_float * P22 = (enzo_float *) field.values("P22"); 
+namespace {
 
-  // if using HLL flux function, compute eigenvalues here
-  std::string flux_type = this->flux_function_;
+  /// Global Lax-Friedrichs face flux
+  struct M1FluxGLF {
+    static const bool use_hll = false;
+    static inline double flux (double U_l, double U_lplus1,
+                               double Q_l, double Q_lplus1, double clight,
+                               double lmin, double lmax)
+    { return 0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) ); }
+  };
 
-  // HLL min and max eigenvalues
-  // +/- clight corresponds to GLF flux function
-  double lmin_x = -1.0, lmin_y = -1.0, lmin_z = -1.0;
-  double lmax_x =  1.0, lmax_y =  1.0, lmax_z =  1.0;
+  /// Harten-Lax-van Leer face flux
+  struct M1FluxHLL {
+    static const bool use_hll = true;
+    static inline double flux (double U_l, double U_lplus1,
+                               double Q_l, double Q_lplus1, double clight,
+                               double lmin, double lmax)
+    {
+      return (lmax*Q_l - lmin*Q_lplus1 + lmax*lmin*clight*(U_lplus1-U_l))
+        / (lmax - lmin);
+    }
+  };
 
-  if (flux_type == "HLL") {
-    double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
-    double f = std::min(Fnorm / (N[i]*clight), 1.0);
+}
 
-    double theta_x = acos(std::min(Fx[i] / Fnorm, -1.0));
-    double theta_y = acos(std::min(Fy[i] / Fnorm, -1.0));
-    double theta_z = acos(std::min(Fz[i] / Fnorm, -1.0));
+//--------------------------------------------------------------------------
 
-    compute_hll_eigenvalues(f, theta_x, &lmin_x, &lmax_x, clight);
-    compute_hll_eigenvalues(f, theta_y, &lmin_y, &lmax_y, clight);
-    compute_hll_eigenvalues(f, theta_z, &lmin_z, &lmax_z, clight);
-  } 
-  
-  // if rank >= 1
-  *N_update += dt/hx * deltaQ_faces( N[i],  N[i+idx],  N[i-idx],
-                                   Fx[i], Fx[i+idx], Fx[i-idx], clight, lmin_x, lmax_x, flux_type );
-    
-  *Fx_update += dt/hx * deltaQ_faces(Fx[i], Fx[i+idx], Fx[i-idx],
-                                   P00[i],
-                                   P00[i+idx],
-                                   P00[i-idx], clight, lmin_x, lmax_x, flux_type );
+template <class FLUX>
+void EnzoMethodM1Closure::transport_sweep_
+(enzo_float * const U[4], enzo_float * const U_new[4],
+ enzo_float * const P[3][3],
+ int mx, int my, int mz, int gx, int gy, int gz,
+ const double h[3], double dt, double clight, double Nmin) throw()
+{
+  // Adds the flux divergence to U_new = {N, Fx, Fy, Fz} in all active
+  // cells. The flux of N along axis d is F_d, and the flux of F_c
+  // along axis d is c^2 P_dc, which is what field "P<d><c>" holds
+  // (see get_pressure_tensor()).
+  //
+  // Field pointers are resolved once by the caller, and the flux
+  // function is a template parameter, so the ix loop below has no
+  // string comparisons or field lookups.
 
-  // if rank >= 2
-  *N_update += dt/hy * deltaQ_faces( N[i],  N[i+idy],  N[i-idy],
-                                   Fy[i], Fy[i+idy], Fy[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-  *Fx_update += dt/hy * deltaQ_faces(Fx[i], Fx[i+idy], Fx[i-idy],
-                                   P10[i],
-                                   P10[i+idy],
-                                   P10[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-  *Fy_update += dt/hx * deltaQ_faces(Fy[i], Fy[i+idx], Fy[i-idx],
-                                   P01[i],
-                                   P01[i+idx],
-                                   P01[i-idx], clight, lmin_x, lmax_x, flux_type );
-
-  *Fy_update += dt/hy * deltaQ_faces(Fy[i], Fy[i+idy], Fy[i-idy],
-                                   P11[i],
-                                   P11[i+idy],
-                                   P11[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-
-   // if rank >= 3
-  *N_update += dt/hz * deltaQ_faces( N[i],  N[i+idz],  N[i-idz],
-                                   Fz[i], Fz[i+idz], Fz[i-idz], clight, lmin_z, lmax_z, flux_type );
-
-  *Fx_update += dt/hz * deltaQ_faces(Fx[i], Fx[i+idz], Fx[i-idz],
-                                   P20[i],
-                                   P20[i+idz],
-                                   P20[i-idz], clight, lmin_z, lmax_z, flux_type );
-
-  *Fy_update += dt/hz * deltaQ_faces(Fy[i], Fy[i+idz], Fy[i-idz],
-                                   P21[i],
-                                   P21[i+idz],
-                                   P21[i-idz], clight, lmin_z, lmax_z, flux_type);
-
-  *Fz_update += dt/hx * deltaQ_faces(Fz[i], Fz[i+idx], Fz[i-idx],
-                                   P02[i],
-                                   P02[i+idx],
-                                   P02[i-idx], clight, lmin_x, lmax_x, flux_type);
-
-  *Fz_update += dt/hy * deltaQ_faces(Fz[i], Fz[i+idy], Fz[i-idy],
-                                   P12[i],
-                                   P12[i+idy],
-                                   P12[i-idy], clight, lmin_y, lmax_y, flux_type);
-
-  *Fz_update += dt/hz * deltaQ_faces(Fz[i], Fz[i+idz], Fz[i-idz],
-                                   P22[i],
-                                   P22[i+idz],
-                                   P22[i-idz], clight, lmin_z, lmax_z, flux_type);
+  const int id[3] = {1, mx, mx*my};
+  const double dth[3] = {dt/h[0], dt/h[1], dt/h[2]};
+  const enzo_float * N = U[0];
 
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      const int i0 = INDEX(0,iy,iz,mx,my);
+      for (int ix=gx; ix<mx-gx; ix++) {
+        const int i = i0 + ix;
+
+        // HLL min and max eigenvalues
+        // +/- clight corresponds to GLF flux function
+        double lmin[3] = {-1.0, -1.0, -1.0};
+        double lmax[3] = { 1.0,  1.0,  1.0};
+
+        if (FLUX::use_hll) {
+          const enzo_float * Fx = U[1];
+          const enzo_float * Fy = U[2];
+          const enzo_float * Fz = U[3];
+          double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
+          double f = std::min(Fnorm / (N[i]*clight), 1.0);
+          for (int d=0; d<3; d++) {
+            double theta = acos(std::min(U[1+d][i] / Fnorm, -1.0));
+            compute_hll_eigenvalues(f, theta, &lmin[d], &lmax[d], clight);
+          }
+        }
+
+        // photon density: flux along axis d is F_d
+        double N_update = 0.0;
+        for (int d=0; d<3; d++) {
+          const enzo_float * Q = U[1+d];
+          const int k = id[d];
+          N_update += dth[d] *
+            (FLUX::flux(N[i-k], N[i],   Q[i-k], Q[i],   clight, lmin[d], lmax[d]) -
+             FLUX::flux(N[i],   N[i+k], Q[i],   Q[i+k], clight, lmin[d], lmax[d]));
+        }
+
+        // flux density F_c: flux along axis d is c^2 P_dc (field "P<d><c>")
+        for (int c=0; c<3; c++) {
+          const enzo_float * F = U[1+c];
+          double F_update = 0.0;
+          for (int d=0; d<3; d++) {
+            const enzo_float * Q = P[d][c];
+            const int k = id[d];
+            F_update += dth[d] *
+              (FLUX::flux(F[i-k], F[i],   Q[i-k], Q[i],   clight, lmin[d], lmax[d]) -
+               FLUX::flux(F[i],   F[i+k], Q[i],   Q[i+k], clight, lmin[d], lmax[d]));
+          }
+          U_new[1+c][i] += F_update;
+        }
+
+        U_new[0][i] = std::max(U_new[0][i] + N_update, Nmin);
+      }
+    }
+  }
 }
 
 //----------------------------------
@@ -1292,8 +1256,9 @@ double EnzoMethodM1Closure::C_add_recombination (EnzoBlock * enzo_block,
 
 //---------------------------------
 
-double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block, 
-                                             double clight, int i, int igroup) throw()
+void EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block, 
+                                             double clight, int igroup,
+                                             enzo_float * D) throw()
 {
   // Attenuate radiation
 
@@ -1303,7 +1268,13 @@ double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block,
 
   Field field = enzo_block->data()->field();
 
-  if (! field.is_field("density")) return 0.0;
+  int mx,my,mz;
+  field.dimensions(0,&mx, &my, &mz);
+  const int m = mx*my*mz;
+
+  std::fill_n(D, m, 0.0);
+
+  if (! field.is_field("density")) return;
  
   std::vector<std::string> chemistry_fields = {"HI_density", 
                                                "HeI_density", "HeII_density"};
@@ -1312,23 +1283,20 @@ double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block,
   std::vector<double> masses = {mH,4*mH, 4*mH};
  
   Scalar<double> scalar = enzo_block->data()->scalar_double();
-  double D = 0.0;
   for (std::size_t j=0; j<chemistry_fields.size(); j++) {  
-    enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
-    double n_j = density_j[i]*rhounit / masses[j];     
-    double sigN_ij = *(scalar.value( scalar.index( sigN_string(igroup, j) )));
-    
-    D += n_j * clight*sigN_ij * tunit; // code_time^-1
+    const enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
+    const double sigN_ij = *(scalar.value( scalar.index( sigN_string(igroup, j) )));
+    const double mass_j = masses[j];
+
+    for (int i=0; i<m; i++) {
+      double n_j = density_j[i]*rhounit / mass_j;
+      D[i] += n_j * clight*sigN_ij * tunit; // code_time^-1
+    }
 
     #ifdef DEBUG_ATTENUATION
-      CkPrintf("[i,j]=[%d,%d]; sigN_ij=%1.2e; n_j=%1.2e; clight=%1.2e\n", igroup, j, sigN_ij, n_j, clight);
+      CkPrintf("[i,j]=[%d,%d]; sigN_ij=%1.2e; clight=%1.2e\n", igroup, j, sigN_ij, clight);
     #endif
   }
-
-#ifdef DEBUG_ATTENUATION
-    CkPrintf("i=%d; D=%e s^-1; dt = %e\n",i, D / tunit, enzo_block->dt*enzo_units->time());
-#endif 
-  return D; 
 }
 
 //----------------------
@@ -1353,11 +1321,6 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
   enzo_block->lower(&xm,&ym,&zm);
   enzo_block->upper(&xp,&yp,&zp);
 
-  // array incremenent (because 3D array of field values are flattened to 1D)
-  const int idx = 1;
-  const int idy = mx;
-  const int idz = mx*my; 
-
   // energy bounds for this group (leave in eV)
   double E_lower = this->energy_lower_[igroup];
   double E_upper = this->energy_upper_[igroup];
@@ -1370,72 +1333,84 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
 
   enzo_float * T = (enzo_float *) field.values("temperature");
 
+  // pressure tensor fields, resolved once per block: P[d][c] is "P<d><c>"
+  enzo_float * P[3][3];
+  for (int d=0; d<3; d++) {
+    for (int c=0; c<3; c++) {
+      P[d][c] = (enzo_float *) field.values
+        ("P" + std::to_string(d) + std::to_string(c));
+    }
+  }
+
   const int m = mx*my*mz;
 
-  // extra copy of fields needed to store
-  // the evolved values until the end
-  enzo_float * Nnew  = new enzo_float[m]; 
-  enzo_float * Fxnew = new enzo_float[m];
-  enzo_float * Fynew = new enzo_float[m];
-  enzo_float * Fznew = new enzo_float[m];
+  // extra copy of fields needed to store the evolved values until
+  // the end, plus the attenuation rate; kept between calls to avoid
+  // reallocating for every group of every block
+  if (transport_scratch_.size() < 5*size_t(m)) {
+    transport_scratch_.resize(5*size_t(m));
+  }
+  enzo_float * Nnew  = transport_scratch_.data();
+  enzo_float * Fxnew = Nnew  + m;
+  enzo_float * Fynew = Fxnew + m;
+  enzo_float * Fznew = Fynew + m;
+  enzo_float * D     = Fznew + m;
 
   double lunit = enzo_units->length();
   double tunit = enzo_units->time();
   double Nunit = enzo_units->photon_number_density();
 
   double dt = enzo_block->dt;
-  double hx = (xp-xm)/(mx-2*gx);
-  double hy = (yp-ym)/(my-2*gy);
-  double hz = (zp-zm)/(mz-2*gz);
+  const double h[3] = { (xp-xm)/(mx-2*gx),
+                        (yp-ym)/(my-2*gy),
+                        (zp-zm)/(mz-2*gz) };
   double clight_cgs = this->clight_frac_*enzo_constants::clight;
   double clight_code = clight_cgs * tunit/lunit;
   
-  for (int i=0; i<m; i++)
-  {
-    Nnew [i] = N [i];
-    Fxnew[i] = Fx[i];
-    Fynew[i] = Fy[i];
-    Fznew[i] = Fz[i];
-  }
-
+  std::copy_n(N,  m, Nnew);
+  std::copy_n(Fx, m, Fxnew);
+  std::copy_n(Fy, m, Fynew);
+  std::copy_n(Fz, m, Fznew);
 
   //calculate the radiation pressure tensor
   get_pressure_tensor(enzo_block, N, Fx, Fy, Fz, clight_code);
   
   double Nmin = this->min_photon_density_ / Nunit;
 
+  // update photon densities and fluxes by the flux divergence
+
+  enzo_float * const U[4]     = { N, Fx, Fy, Fz };
+  enzo_float * const U_new[4] = { Nnew, Fxnew, Fynew, Fznew };
+
+  if (flux_function_ == "HLL") {
+    transport_sweep_<M1FluxHLL>
+      (U, U_new, P, mx,my,mz, gx,gy,gz, h, dt, clight_code, Nmin);
+  } else if (flux_function_ == "GLF") {
+    transport_sweep_<M1FluxGLF>
+      (U, U_new, P, mx,my,mz, gx,gy,gz, h, dt, clight_code, Nmin);
+  } else {
+    ERROR1("EnzoMethodM1Closure::solve_transport_eqn()",
+           "flux_function type %s not recognized",
+           flux_function_.c_str());
+  }
+
+  // add interactions with matter 
+
+  if (this->attenuation_) {
+    D_add_attenuation(enzo_block, clight_cgs, igroup, D);
+  }
+
   for (int iz=gz; iz<mz-gz; iz++) {
     for (int iy=gy; iy<my-gy; iy++) {
       for (int ix=gx; ix<mx-gx; ix++) {
         int i = INDEX(ix,iy,iz,mx,my); //index of current cell
-        double N_update=0, Fx_update=0, Fy_update=0, Fz_update=0;
-      
-        get_U_update( enzo_block, &N_update, &Fx_update, &Fy_update, &Fz_update,
-                             N, Fx, Fy, Fz, hx, hy, hz, dt, clight_code,
-                             i, idx, idy, idz ); 
-        
-        // get updated fluxes
-        Fxnew[i] += Fx_update;
-        Fynew[i] += Fy_update;
-        Fznew[i] += Fz_update;
-
-        // now get updated photon densities
-        Nnew[i] = std::max(Nnew[i] + N_update, Nmin);
-
 
       #ifdef DEBUG_TRANSPORT
-        CkPrintf("i = %d; N_update = %f; Fx_update = %f; Nnew[i] = %f; hx = %f; dt = %f \n", i, N_update, Fx_update, Nnew[i], hx, dt);
+        CkPrintf("i = %d; Nnew[i] = %f; dt = %f \n", i, Nnew[i], dt);
       #endif
 
-
-        // add interactions with matter 
-
         double C = 0.0; // photon creation term
-        double D = 0.0; // photon destruction term
-
-        if (this->attenuation_) {
-          D = D_add_attenuation(enzo_block, clight_cgs, i, igroup);
-        }
+        double Di = this->attenuation_ ? D[i] : 0.0; // photon destruction term
 
         if (this->recombination_radiation_) {
           // update photon density due to recombinations
@@ -1445,7 +1420,7 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
         }
         
         // update radiation fields due to thermochemistry (see appendix A)
-        double mult = 1.0/(1+dt*D);
+        double mult = 1.0/(1+dt*Di);
         Nnew [i] = std::max((Nnew [i] + dt*C) * mult, Nmin);
         Fxnew[i] = Fxnew[i] * mult;
         Fynew[i] = Fynew[i] * mult;
@@ -1471,11 +1446,6 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
       }
     }
   } 
-
-  delete [] Nnew;
-  delete [] Fxnew;
-  delete [] Fynew;
-  delete [] Fznew;
 }
 
 //----------------------------------------------------------------------
@@ -79,7 +79,8 @@ public: // interface
       sigmaN_(),
       sigmaE_(),
       ir_injection_(-1),
-      M1_tables(nullptr)
+      M1_tables(nullptr),
+      transport_scratch_()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -203,16 +204,8 @@ protected: // methods
   //--------- TRANSPORT STEP --------
 
 
-  double flux_function (double U_l, double U_lplus1,
-                        double Q_l, double Q_lplus1,
-                        double clight, double lmin, double lmax, std::string type) throw();
-
   void compute_hll_eigenvalues(double f, double theta, double * lmin, double * lmax, double clight) throw();
 
-  double deltaQ_faces (double U_l, double U_lplus1, double U_lminus1, 
-                       double Q_l, double Q_lplus1, double Q_lminus1,
-                       double clight, double lmin, double lmax, std::string flux_type) throw();
-
   void get_reduced_variables (double * chi_idx, double (*n_idx)[3], int i, double clight,
                               enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz) 
                               throw(); 
@@ -221,11 +214,14 @@ protected: // methods
                        enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
                        double clight) throw();
 
-  void get_U_update (EnzoBlock * enzo_block, double * N_update, 
-                       double * Fx_update, double * Fy_update, double * Fz_update, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
-                       double hx, double hy, double hz, double dt, double clight, 
-                       int i, int idx, int idy, int idz) throw();
+  /// adds the flux divergence of U = {N, Fx, Fy, Fz} to U_new in
+  /// all active cells, using the face flux function FLUX
+  template <class FLUX>
+  void transport_sweep_ (enzo_float * const U[4], enzo_float * const U_new[4],
+                         enzo_float * const P[3][3],
+                         int mx, int my, int mz, int gx, int gy, int gz,
+                         const double h[3], double dt, double clight,
+                         double Nmin) throw();
 
   void solve_transport_eqn (EnzoBlock * enzo_block, int igroup) throw();
 
@@ -234,8 +230,10 @@ protected: // methods
   //---------- THERMOCHEMISTRY STEP ------------
   // Interaction with matter is completely local, so don't need a refresh before this step
 
-  /// computes the photon-loss term from attenuation by local gas
-  double D_add_attenuation ( EnzoBlock * enzo_block, double clight, int i, int igroup) throw(); 
+  /// computes the photon-loss term from attenuation by local gas in
+  /// every cell of the block
+  void D_add_attenuation ( EnzoBlock * enzo_block, double clight, int igroup,
+                           enzo_float * D) throw(); 
 
   /// helper function used in C_add_recombination
   double get_alpha (double T, int species, char rec_case) throw();
@@ -305,6 +303,9 @@ protected: // attributes
 
   /// Tables relevant to M1 closure method
   M1Tables * M1_tables;
+
+  /// Scratch arrays for solve_transport_eqn() (not pup'ed)
+  std::vector<enzo_float> transport_scratch_;
 };
 
 
@@ -11,6 +11,10 @@
 #include "Cello/cello.hpp"
 #include "Enzo/enzo.hpp"
 
+std::map<int, std::vector<Block *> >
+EnzoMethodGrackle::batch_blocks_[CONFIG_NODE_SIZE];
+std::map<int,int> EnzoMethodGrackle::batch_count_[CONFIG_NODE_SIZE];
+
 //----------------------------------------------------------------------------
 
 namespace { // anonymous namespace
@@ -40,6 +44,8 @@ GrackleChemistryData parse_chemistry(ParameterGroup p)
   //      EnzoMethodGrackle)
   const std::unordered_set<std::string> ignore_leaf_names =
     {"use_cooling_timestep", "radiation_redshift",
+     "batch", "batch_min_density", "batch_max_temperature",
+     "reuse_cooling_time",
      // the next option is deprecated and is only listed in the short-term
      // for backwards compatability (it should now be replaced by
      // "Physics:fluid_props:floors:metallicity")
@@ -96,6 +102,22 @@ GrackleChemistryData parse_chemistry(ParameterGroup p)
   return my_chemistry;
 }
 
+//----------------------------------------------------------------------------
+
+void check_dual_energy_()
+{
+  if (cello::is_initial_cycle(InitCycleKind::fresh_or_noncharm_restart)) {
+    bool nohydro = ( (enzo::problem()->method("ppm") == nullptr) |
+                     (enzo::problem()->method("mhd_vlct") == nullptr) |
+                     (enzo::problem()->method("ppml") == nullptr) );
+
+    ASSERT("EnzoMethodGrackle::compute_",
+           "The current implementation requires the dual-energy formalism to "
+           "be in use, when EnzoMethodGrackle is used with a (M)HD-solver",
+           nohydro | !enzo::fluid_props()->dual_energy_config().is_disabled());
+  }
+}
+
 } // anonymous namespace
 
 //----------------------------------------------------------------------------
@@ -113,17 +135,47 @@ EnzoMethodGrackle::EnzoMethodGrackle
                     // the next parameter is relevant when using cosmology
                     physics_cosmology_initial_redshift,
                     time),
-    use_cooling_timestep_(p.value_logical("use_cooling_timestep", false))
+    use_cooling_timestep_(p.value_logical("use_cooling_timestep", false)),
+    batch_(p.value_logical("batch", false)),
+    batch_min_density_(p.value_float("batch_min_density", -1.0)),
+    batch_max_temperature_(p.value_float("batch_max_temperature", -1.0)),
+    reuse_cooling_time_(p.value_logical("reuse_cooling_time", false)),
+    is_cooling_time_min_(-1),
+    is_cooling_time_hash_(-1),
+    index_counter_reused_(-1)
 {
   // courant is only meaningful when use_cooling_timestep is true
   this->set_courant(p.value_float("courant", 1.0));
 
+  // cells of a batch aren't neighbors, so the Sobolev-like H2
+  // self-shielding (which uses density gradients) can't be computed
+  const GrackleChemistryData* my_chemistry = this->try_get_chemistry();
+  ASSERT("EnzoMethodGrackle::EnzoMethodGrackle",
+         "Method:grackle:batch can't be used with H2_self_shielding = 1",
+         ! batch_ || (my_chemistry == nullptr) ||
+         (my_chemistry->get<int>("H2_self_shielding") != 1));
+
+  // without batching, the cooling time is only computed in timestep(),
+  // after other Methods have changed the fields, so it's never reused
+  ASSERT("EnzoMethodGrackle::EnzoMethodGrackle",
+         "Method:grackle:reuse_cooling_time requires Method:grackle:batch",
+         ! reuse_cooling_time_ || batch_);
+
   // Gather list of fields that MUST be defined for this
   // method and check that they are permanent. If not,
   // define them.
 
   define_required_grackle_fields();
 
+  if (cache_cooling_time_()) {
+    is_cooling_time_min_ = cello::scalar_descr_double()->new_value
+      ("grackle:cooling_time_min");
+    is_cooling_time_hash_ = cello::scalar_descr_long_long()->new_value
+      ("grackle:cooling_time_hash");
+    index_counter_reused_ = cello::simulation()->performance()->new_counter
+      (counter_type_user,"grackle-cooling-time-reused");
+  }
+
   /// Initialize default Refresh
   cello::simulation()->refresh_set_name(ir_post_,name());
   Refresh * refresh = cello::refresh(ir_post_);
@@ -228,6 +280,11 @@ void EnzoMethodGrackle::define_required_grackle_fields
 void EnzoMethodGrackle::compute ( Block * block) throw()
 {
 
+  if (batch_) {
+    compute_batch_(block);
+    return;
+  }
+
   if (block->is_leaf()){
 
 #ifndef CONFIG_USE_GRACKLE
@@ -362,16 +419,7 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
   ERROR("EnzoMethodGrackle::compute_", "Enzo-E isn't linked to grackle");
 #else
   const EnzoConfig * enzo_config = enzo::config();
-  if (cello::is_initial_cycle(InitCycleKind::fresh_or_noncharm_restart)) {
-    bool nohydro = ( (enzo::problem()->method("ppm") == nullptr) |
-                     (enzo::problem()->method("mhd_vlct") == nullptr) |
-                     (enzo::problem()->method("ppml") == nullptr) );
-
-    ASSERT("EnzoMethodGrackle::compute_",
-           "The current implementation requires the dual-energy formalism to "
-           "be in use, when EnzoMethodGrackle is used with a (M)HD-solver",
-           nohydro | !enzo::fluid_props()->dual_energy_config().is_disabled());
-  }
+  check_dual_energy_();
 
   // Solve chemistry
   // NOTE: should we set compute_time to `block->time() + 0.5*block->dt()`?
@@ -379,6 +427,176 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
   double compute_time = block->time(); // only matters in cosmological sims
   grackle_facade_.solve_chemistry(block, compute_time, block->dt());
 
+  update_after_solve_(block);
+#endif // CONFIG_USE_GRACKLE
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::compute_batch_ ( Block * block) throw()
+{
+#ifndef CONFIG_USE_GRACKLE
+  ERROR("EnzoMethodGrackle::compute_batch_",
+        "Can't use method 'grackle' when Enzo-E isn't linked to Grackle");
+#else
+  // every Block on the PE must call compute() for the batch to be solved
+  ASSERT("EnzoMethodGrackle::compute_batch_",
+         "Method:grackle:batch can't be used when the Method is subcycled",
+         ! (subcycle() && cello::config()->stopping_subcycle));
+
+  const int is = cello::index_static();
+  const int cycle = block->cycle();
+
+  if (block->is_leaf()) batch_blocks_[is][cycle].push_back(block);
+
+  const int num_blocks = cello::hierarchy()->num_blocks();
+
+  if (++batch_count_[is][cycle] < num_blocks) {
+    // leaf Blocks wait for the batch; others are done
+    if (! block->is_leaf()) block->compute_done();
+    return;
+  }
+
+  // leaf Blocks can't start the next cycle until this batch is
+  // solved, so only the earliest pending batch can be complete
+  ASSERT1("EnzoMethodGrackle::compute_batch_",
+          "Batch for cycle %d completed before an earlier cycle's batch",
+          cycle, (batch_count_[is].begin()->first == cycle));
+
+  // reset the batch before any Block continues
+  std::vector<Block *> blocks;
+  blocks.swap(batch_blocks_[is][cycle]);
+  batch_blocks_[is].erase(cycle);
+  batch_count_[is].erase(cycle);
+
+  if (! blocks.empty()) {
+
+    Simulation * simulation = cello::simulation();
+    if (simulation)
+      simulation->performance()->start_region(perf_grackle,__FILE__,__LINE__);
+
+    check_dual_energy_();
+
+    const double compute_time = blocks[0]->time();
+    const double dt = blocks[0]->dt();
+
+    std::vector< std::vector<int> > cells(blocks.size());
+    for (std::size_t k = 0; k < blocks.size(); k++) {
+      ASSERT("EnzoMethodGrackle::compute_batch_",
+             "Blocks in a batch must have the same time and timestep",
+             (blocks[k]->time() == compute_time) && (blocks[k]->dt() == dt));
+      batch_cells_(blocks[k], cells[k]);
+    }
+
+    // if the timestep will need the cooling time before the fields
+    // change, compute it while the batch is gathered
+    std::vector<enzo_float> cooling_time;
+    if (batch_cooling_time_(blocks)) {
+      std::size_t num_cells = 0;
+      for (const std::vector<int> & block_cells : cells) {
+        num_cells += block_cells.size();
+      }
+      cooling_time.resize(num_cells);
+    }
+
+    grackle_facade_.solve_chemistry
+      (blocks, cells, compute_time, dt,
+       cooling_time.empty() ? nullptr : cooling_time.data(),
+       batch_max_temperature_);
+
+    std::size_t offset = 0;
+    for (std::size_t k = 0; k < blocks.size(); k++) {
+      update_after_solve_(blocks[k]);
+
+      if (! cooling_time.empty()) {
+        // every cell was solved, so cells[k][i] == i
+        Field field = blocks[k]->data()->field();
+        int gx,gy,gz;
+        field.ghost_depth (0,&gx,&gy,&gz);
+        int nx,ny,nz;
+        field.size (&nx,&ny,&nz);
+        const int ngx = nx + 2*gx;
+        const int ngy = ny + 2*gy;
+
+        const enzo_float * block_cooling_time = cooling_time.data() + offset;
+        if (field.is_field("cooling_time")) {
+          std::copy_n(block_cooling_time, cells[k].size(),
+                      (enzo_float *) field.values("cooling_time"));
+        }
+
+        double dt_min = std::numeric_limits<double>::max();
+        for (int iz = gz; iz < gz + nz; iz++) {
+          for (int iy = gy; iy < gy + ny; iy++) {
+            for (int ix = gx; ix < gx + nx; ix++) {
+              const int i = INDEX(ix, iy, iz, ngx, ngy);
+              dt_min = std::min(dt_min,
+                                (double) std::abs(block_cooling_time[i]));
+            }
+          }
+        }
+        store_cooling_time_(blocks[k], dt_min);
+      }
+      offset += cells[k].size();
+    }
+
+    if (simulation)
+      simulation->performance()->stop_region(perf_grackle,__FILE__,__LINE__);
+  }
+
+  // resume the waiting Blocks through the scheduler rather than calling
+  // into them from this Block's entry method
+  for (Block * leaf : blocks) {
+    enzo::block_array()[leaf->index()].p_method_grackle_batch_done();
+  }
+  if (! block->is_leaf()) block->compute_done();
+#endif // CONFIG_USE_GRACKLE
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_grackle_batch_done()
+{
+  compute_done();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::batch_cells_
+(Block * block, std::vector<int> & cells) const throw()
+{
+  Field field = block->data()->field();
+
+  int gx,gy,gz;
+  field.ghost_depth (0,&gx,&gy,&gz);
+
+  int nx,ny,nz;
+  field.size (&nx,&ny,&nz);
+
+  // like compute_(), solve the ghost zones as well
+  const int n = (nx + 2*gx) * (ny + 2*gy) * (nz + 2*gz);
+
+  const enzo_float * density = (enzo_float *) field.values("density");
+
+  // batch_max_temperature is applied by GrackleFacade::solve_chemistry()
+  // on the gathered batch
+
+  cells.clear();
+  cells.reserve(n);
+  for (int i = 0; i < n; i++) {
+    const bool skip =
+      (batch_min_density_ >= 0.0) && (density[i] < batch_min_density_);
+    if (! skip) cells.push_back(i);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::update_after_solve_ ( Block * block) throw()
+{
+#ifndef CONFIG_USE_GRACKLE
+  ERROR("EnzoMethodGrackle::update_after_solve_",
+        "Enzo-E isn't linked to grackle");
+#else
   // now we have to do some extra-work after the fact (such as adjusting total
   // energy density and applying floors...)
 
@@ -442,50 +660,115 @@ double EnzoMethodGrackle::timestep ( Block * block ) throw()
   double dt = std::numeric_limits<double>::max();;
 
   if (use_cooling_timestep_){
-    Field field = block->data()->field();
 
-    enzo_float * cooling_time = field.is_field("cooling_time") ?
-                        (enzo_float *) field.values("cooling_time") : NULL;
+    if (cache_cooling_time_()) {
 
-    // make it if it doesn't exist
-    bool delete_cooling_time = false;
-    int gx,gy,gz;
-    field.ghost_depth (0,&gx,&gy,&gz);
+      // reuse the cooling time if the fields haven't changed since it was
+      // computed
+      const long long hash = grackle_facade_.hash_fields(block);
 
-    int nx,ny,nz;
-    field.size (&nx,&ny,&nz);
+      Scalar<double> scalar_double = block->data()->scalar_double();
+      Scalar<long long> scalar_long_long = block->data()->scalar_long_long();
+
+      if (hash == *scalar_long_long.value(is_cooling_time_hash_)) {
+        dt = *scalar_double.value(is_cooling_time_min_);
+        cello::simulation()->performance()->increment_counter
+          (index_counter_reused_, 1);
+      } else {
+        dt = min_cooling_time_(block);
+        *scalar_double.value(is_cooling_time_min_) = dt;
+        *scalar_long_long.value(is_cooling_time_hash_) = hash;
+      }
 
-    int ngx = nx + 2*gx;
-    int ngy = ny + 2*gy;
-    int ngz = nz + 2*gz;
+    } else {
 
-    int size = ngx*ngy*ngz;
+      dt = min_cooling_time_(block);
 
-    if (!(cooling_time)){
-      cooling_time = new enzo_float [size];
-      delete_cooling_time = true;
     }
+  }
 
-    this->calculate_cooling_time(EnzoFieldAdaptor(block,0), cooling_time, 0);
+  return dt * courant_;
+}
 
-    // make sure to exclude the ghost zone. Because there is no refresh before
-    // this method is called (at least during the very first cycle) - this can
-    // including ghost zones can lead to timesteps of 0
-    for (int iz = gz; iz < ngz - gz; iz++) {   // if rank < 3: gz = 0, ngz = 1
-      for (int iy = gy; iy < ngy - gy; iy++) { // if rank < 2: gy = 0, ngy = 1
-        for (int ix = gx; ix < ngx - gx; ix++) {
-	  int i = INDEX(ix, iy, iz, ngx, ngy);
-          dt = std::min(enzo_float(dt), std::abs(cooling_time[i]));
-        }
+//----------------------------------------------------------------------
+
+double EnzoMethodGrackle::min_cooling_time_ ( Block * block ) throw()
+{
+  double dt = std::numeric_limits<double>::max();;
+
+  Field field = block->data()->field();
+
+  int gx,gy,gz;
+  field.ghost_depth (0,&gx,&gy,&gz);
+
+  int nx,ny,nz;
+  field.size (&nx,&ny,&nz);
+
+  int ngx = nx + 2*gx;
+  int ngy = ny + 2*gy;
+  int ngz = nz + 2*gz;
+
+  // use the cooling_time field if it exists
+  std::vector<enzo_float> cooling_time_scratch;
+  enzo_float * cooling_time = field.is_field("cooling_time") ?
+    (enzo_float *) field.values("cooling_time") : nullptr;
+  if (cooling_time == nullptr) {
+    cooling_time_scratch.resize(ngx*ngy*ngz);
+    cooling_time = cooling_time_scratch.data();
+  }
+
+  this->calculate_cooling_time(EnzoFieldAdaptor(block,0), cooling_time, 0);
+
+  // make sure to exclude the ghost zone. Because there is no refresh before
+  // this method is called (at least during the very first cycle) - this can
+  // including ghost zones can lead to timesteps of 0
+  for (int iz = gz; iz < ngz - gz; iz++) {   // if rank < 3: gz = 0, ngz = 1
+    for (int iy = gy; iy < ngy - gy; iy++) { // if rank < 2: gy = 0, ngy = 1
+      for (int ix = gx; ix < ngx - gx; ix++) {
+        int i = INDEX(ix, iy, iz, ngx, ngy);
+        dt = std::min(enzo_float(dt), std::abs(cooling_time[i]));
       }
     }
+  }
 
-    if (delete_cooling_time){
-      delete [] cooling_time;
-    }
+  return dt;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::store_cooling_time_
+(Block * block, double cooling_time_min) throw()
+{
+  Scalar<double> scalar_double = block->data()->scalar_double();
+  Scalar<long long> scalar_long_long = block->data()->scalar_long_long();
+
+  *scalar_double.value(is_cooling_time_min_) = cooling_time_min;
+  *scalar_long_long.value(is_cooling_time_hash_) =
+    grackle_facade_.hash_fields(block);
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoMethodGrackle::batch_cooling_time_
+(const std::vector<Block *> & blocks) const throw()
+{
+  if (! cache_cooling_time_() || blocks.empty()) return false;
+
+  // every cell must be solved, and no floor may be applied afterwards
+  if ((batch_min_density_ >= 0.0) || (batch_max_temperature_ >= 0.0) ||
+      enzo::fluid_props()->fluid_floor_config().has_metal_mass_frac_floor()) {
+    return false;
   }
 
-  return dt * courant_;
+  // no later Method may modify the fields before the timestep
+  Problem * problem = cello::problem();
+  int index_last = 0;
+  while (problem->method(index_last+1) != nullptr) index_last++;
+  if (problem->method(index_last) != this) return false;
+
+  // the stopping phase of the next cycle must compute the timestep
+  const int interval = cello::config()->stopping_interval;
+  return interval && (((blocks[0]->cycle() + 1) % interval) == 0);
 }
 
 //----------------------------------------------------------------------
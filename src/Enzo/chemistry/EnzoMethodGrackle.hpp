@@ -44,7 +44,14 @@ public: // interface
   EnzoMethodGrackle (CkMigrateMessage *m)
     : Method (m),
       grackle_facade_(m),
-      use_cooling_timestep_(false)
+      use_cooling_timestep_(false),
+      batch_(false),
+      batch_min_density_(-1.0),
+      batch_max_temperature_(-1.0),
+      reuse_cooling_time_(false),
+      is_cooling_time_min_(-1),
+      is_cooling_time_hash_(-1),
+      index_counter_reused_(-1)
   {  }
 
   /// CHARM++ Pack / Unpack function
@@ -57,6 +64,13 @@ public: // interface
     Method::pup(p);
     p | grackle_facade_;
     p | use_cooling_timestep_;
+    p | batch_;
+    p | batch_min_density_;
+    p | batch_max_temperature_;
+    p | reuse_cooling_time_;
+    p | is_cooling_time_min_;
+    p | is_cooling_time_hash_;
+    p | index_counter_reused_;
   }
 
   /// Apply the method to advance a block one timestep
@@ -146,12 +160,72 @@ protected: // methods
 
   void compute_( Block * block) throw();
 
+  /// Add the Block to this PE's batch for its cycle, and solve the batch
+  /// once all Blocks on the PE have been added for that cycle
+  void compute_batch_( Block * block) throw();
+
+  /// Indices of the Block's cells that are solved in batched mode
+  void batch_cells_(Block * block, std::vector<int> & cells) const throw();
+
+  /// Apply the metallicity floor and update the total energy after
+  /// solving chemistry
+  void update_after_solve_(Block * block) throw();
+
+  /// Whether each Block's minimum cooling time is cached for reuse by
+  /// timestep(). The UVB depends on the time in cosmological runs, so
+  /// the cooling time can change even when the fields don't
+  bool cache_cooling_time_() const throw()
+  {
+    return use_cooling_timestep_ && reuse_cooling_time_ && batch_ &&
+      (enzo::cosmology() == nullptr);
+  }
+
+  /// Whether the batched solve of the given Blocks should also compute
+  /// their cooling time for the next call to timestep()
+  bool batch_cooling_time_(const std::vector<Block *> & blocks) const throw();
+
+  /// Cache the Block's minimum cooling time together with the hash of
+  /// the fields it was computed from
+  void store_cooling_time_(Block * block, double cooling_time_min) throw();
+
+  /// Return the minimum cooling time over the Block's interior
+  double min_cooling_time_(Block * block) throw();
+
 protected: // attributes
   /// the GrackleFacade instance provides an interface to all operations in the
   /// Grackle library and stores the current configuration. You can assume that
   /// this is always correctly initialized
   GrackleFacade grackle_facade_;
   bool use_cooling_timestep_;
+
+  /// Whether to solve all leaf Blocks on a PE with a single Grackle call
+  bool batch_;
+
+  /// In batched mode, cells with lower density (in code units) or higher
+  /// temperature (in K) are not solved. Negative values disable the limits
+  double batch_min_density_;
+  double batch_max_temperature_;
+
+  /// Whether to reuse a Block's cooling time in timestep() until the
+  /// fields it depends on change
+  bool reuse_cooling_time_;
+
+  /// Indices of Block scalars holding the cached minimum cooling time
+  /// and the hash of the fields it was computed from
+  int is_cooling_time_min_;
+  int is_cooling_time_hash_;
+
+  /// Index of the "grackle-cooling-time-reused" user performance counter
+  int index_counter_reused_;
+
+  /// Leaf Blocks on each PE waiting for the batched solve, by cycle
+  static std::map<int, std::vector<Block *> > batch_blocks_[CONFIG_NODE_SIZE];
+
+  /// Number of Blocks on each PE that have called compute(), by cycle.
+  /// Non-leaf Blocks don't wait for the batch, so without an adapt
+  /// between cycles they can call compute() for the next cycle before
+  /// the current batch is complete
+  static std::map<int,int> batch_count_[CONFIG_NODE_SIZE];
 };
 
 #endif /* ENZO_ENZO_METHOD_GRACKLE_HPP */
@@ -381,6 +381,254 @@ void GrackleFacade::solve_chemistry(Block* block, double compute_time,
 
 //----------------------------------------------------------------------------
 
+namespace { // things within anonymous namespace are local to this file
+
+#ifdef CONFIG_USE_GRACKLE
+/// members of grackle_field_data that point to field values, whether
+/// Grackle may modify those values while solving chemistry, and whether
+/// they affect the cooling and chemistry rates
+struct GrackleFieldMember {
+  gr_float* grackle_field_data::* ptr;
+  bool modified;
+  bool affects_rates;
+};
+
+const GrackleFieldMember grackle_field_members_[] = {
+  {&grackle_field_data::density,                 true,  true},
+  {&grackle_field_data::internal_energy,         true,  true},
+  {&grackle_field_data::x_velocity,              false, false},
+  {&grackle_field_data::y_velocity,              false, false},
+  {&grackle_field_data::z_velocity,              false, false},
+  {&grackle_field_data::HI_density,              true,  true},
+  {&grackle_field_data::HII_density,             true,  true},
+  {&grackle_field_data::HeI_density,             true,  true},
+  {&grackle_field_data::HeII_density,            true,  true},
+  {&grackle_field_data::HeIII_density,           true,  true},
+  {&grackle_field_data::e_density,               true,  true},
+  {&grackle_field_data::HM_density,              true,  true},
+  {&grackle_field_data::H2I_density,             true,  true},
+  {&grackle_field_data::H2II_density,            true,  true},
+  {&grackle_field_data::DI_density,              true,  true},
+  {&grackle_field_data::DII_density,             true,  true},
+  {&grackle_field_data::HDI_density,             true,  true},
+  {&grackle_field_data::metal_density,           true,  true},
+  {&grackle_field_data::RT_heating_rate,         false, true},
+  {&grackle_field_data::RT_HI_ionization_rate,   false, true},
+  {&grackle_field_data::RT_HeI_ionization_rate,  false, true},
+  {&grackle_field_data::RT_HeII_ionization_rate, false, true},
+  {&grackle_field_data::RT_H2_dissociation_rate, false, true},
+  {&grackle_field_data::volumetric_heating_rate, false, true},
+  {&grackle_field_data::specific_heating_rate,   false, true}
+};
+#endif /* CONFIG_USE_GRACKLE */
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+
+void GrackleFacade::solve_chemistry
+(const std::vector<Block*>& blocks,
+ const std::vector<std::vector<int>>& cells,
+ double compute_time, double dt, enzo_float* cooling_time,
+ double max_temperature) const noexcept
+{
+#ifndef CONFIG_USE_GRACKLE
+  ERROR("GrackleFacade::solve_chemistry", "grackle isn't being used");
+#else
+
+  const std::size_t num_blocks = blocks.size();
+  ASSERT("GrackleFacade::solve_chemistry",
+         "a list of cells is required for each block",
+         cells.size() == num_blocks);
+
+  int num_cells = 0;
+  for (const std::vector<int>& block_cells : cells) {
+    num_cells += block_cells.size();
+  }
+  if (num_cells == 0) return;
+
+  code_units grackle_units;
+  setup_grackle_u_(compute_time, radiation_redshift_, &grackle_units);
+
+  std::vector<grackle_field_data> block_fields(num_blocks);
+  for (std::size_t k = 0; k < num_blocks; k++) {
+    setup_grackle_fields(EnzoFieldAdaptor(blocks[k], 0), &block_fields[k]);
+  }
+
+  // the 1D grid holding the selected cells of all blocks (members that
+  // aren't set here are zero, as if they were unused)
+  int grid_dimension[3] = {num_cells,   1, 1};
+  int grid_start[3]     = {0,           0, 0};
+  int grid_end[3]       = {num_cells-1, 0, 0};
+
+  grackle_field_data batch_fields = {};
+  batch_fields.grid_rank      = 1;
+  batch_fields.grid_dimension = grid_dimension;
+  batch_fields.grid_start     = grid_start;
+  batch_fields.grid_end       = grid_end;
+  batch_fields.grid_dx        = block_fields[0].grid_dx;
+
+  // gather the selected cells of each field used by Grackle
+
+  const int num_members =
+    sizeof(grackle_field_members_) / sizeof(grackle_field_members_[0]);
+  std::vector< std::vector<gr_float> > values(num_members);
+
+  for (int m = 0; m < num_members; m++) {
+    gr_float* grackle_field_data::* member = grackle_field_members_[m].ptr;
+    if (block_fields[0].*member == nullptr) continue;
+
+    values[m].resize(num_cells);
+    int i = 0;
+    for (std::size_t k = 0; k < num_blocks; k++) {
+      const gr_float * block_values = block_fields[k].*member;
+      for (int i_cell : cells[k]) values[m][i++] = block_values[i_cell];
+    }
+    batch_fields.*member = values[m].data();
+  }
+
+  // see solve_chemistry() above for why the const is dropped
+  chemistry_data * chemistry_data_ptr
+    = const_cast<chemistry_data *>(my_chemistry_.get_ptr());
+  chemistry_data_storage * grackle_rates_ptr
+    = const_cast<chemistry_data_storage *>(grackle_rates_.get());
+
+  // drop cells hotter than max_temperature, using the temperature of the
+  // whole batch from a single Grackle call.  Kept cells are moved to the
+  // front of the gathered arrays, and keep holds their gathered indices
+  const bool skip_hot = (max_temperature >= 0.0);
+  std::vector<int> keep;
+  int num_solve = num_cells;
+
+  if (skip_hot) {
+    ASSERT("GrackleFacade::solve_chemistry",
+           "the cooling time can't be computed when cells are skipped",
+           cooling_time == nullptr);
+
+    std::vector<gr_float> temperature(num_cells);
+    if (local_calculate_temperature(chemistry_data_ptr, grackle_rates_ptr,
+                                    &grackle_units, &batch_fields,
+                                    temperature.data()) == ENZO_FAIL) {
+      ERROR("GrackleFacade::solve_chemistry",
+            "Error in local_calculate_temperature.");
+    }
+
+    keep.reserve(num_cells);
+    for (int i = 0; i < num_cells; i++) {
+      if (temperature[i] <= max_temperature) keep.push_back(i);
+    }
+    num_solve = keep.size();
+
+    for (int m = 0; m < num_members; m++) {
+      if (values[m].empty()) continue;
+      // keep[j] >= j, so the arrays can be compacted in place
+      for (int j = 0; j < num_solve; j++) values[m][j] = values[m][keep[j]];
+    }
+    grid_dimension[0] = num_solve;
+    grid_end[0] = num_solve - 1;
+  }
+
+  if (num_solve > 0) {
+
+    if (local_solve_chemistry(chemistry_data_ptr, grackle_rates_ptr,
+                              &grackle_units, &batch_fields, dt)
+        == ENZO_FAIL) {
+      ERROR("GrackleFacade::solve_chemistry",
+            "Error in local_solve_chemistry.");
+    }
+
+    // the gathered values are now the updated values, so the cooling time
+    // can be computed without gathering them again
+    if (cooling_time != nullptr) {
+      if (local_calculate_cooling_time(chemistry_data_ptr, grackle_rates_ptr,
+                                       &grackle_units, &batch_fields,
+                                       cooling_time) == ENZO_FAIL) {
+        ERROR("GrackleFacade::solve_chemistry",
+              "Error in local_calculate_cooling_time.");
+      }
+    }
+  }
+
+  // scatter the fields Grackle may have modified back to the blocks
+
+  for (int m = 0; m < num_members; m++) {
+    if (values[m].empty() || ! grackle_field_members_[m].modified) continue;
+
+    gr_float* grackle_field_data::* member = grackle_field_members_[m].ptr;
+    int i = 0; // index of the gathered cell
+    int j = 0; // index of the solved cell
+    for (std::size_t k = 0; k < num_blocks; k++) {
+      gr_float * block_values = block_fields[k].*member;
+      for (int i_cell : cells[k]) {
+        if (! skip_hot || (j < num_solve && keep[j] == i)) {
+          block_values[i_cell] = values[m][j++];
+        }
+        i++;
+      }
+    }
+  }
+
+  for (std::size_t k = 0; k < num_blocks; k++) {
+    delete_grackle_fields(&block_fields[k]);
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+
+long long GrackleFacade::hash_fields(Block* block) const noexcept
+{
+#ifndef CONFIG_USE_GRACKLE
+  ERROR("GrackleFacade::hash_fields", "grackle isn't being used");
+#else
+
+  grackle_field_data grackle_fields;
+  setup_grackle_fields(EnzoFieldAdaptor(block, 0), &grackle_fields);
+
+  Field field = block->data()->field();
+
+  int gx,gy,gz;
+  field.ghost_depth (0,&gx,&gy,&gz);
+
+  int nx,ny,nz;
+  field.size (&nx,&ny,&nz);
+
+  const int ngx = nx + 2*gx;
+  const int ngy = ny + 2*gy;
+
+  // FNV-1a style hash of the bits of each value in the Block's interior
+  const uint64_t prime = 1099511628211ull;
+  uint64_t hash = 14695981039346656037ull;
+
+  const int num_members =
+    sizeof(grackle_field_members_) / sizeof(grackle_field_members_[0]);
+
+  for (int m = 0; m < num_members; m++) {
+    if (! grackle_field_members_[m].affects_rates) continue;
+    const gr_float * values = grackle_fields.*(grackle_field_members_[m].ptr);
+    hash = (hash ^ (values != nullptr)) * prime;
+    if (values == nullptr) continue;
+
+    for (int iz = gz; iz < gz + nz; iz++) {
+      for (int iy = gy; iy < gy + ny; iy++) {
+        for (int ix = gx; ix < gx + nx; ix++) {
+          uint64_t bits = 0;
+          std::memcpy(&bits, &values[INDEX(ix,iy,iz,ngx,ngy)],
+                      sizeof(gr_float));
+          hash = (hash ^ bits) * prime;
+        }
+      }
+    }
+  }
+
+  delete_grackle_fields(&grackle_fields);
+
+  return static_cast<long long>(hash);
+#endif
+}
+
+//----------------------------------------------------------------------------
+
 typedef int (*grackle_local_property_func)(chemistry_data*,
                                            chemistry_data_storage *,
                                            code_units*, grackle_field_data*,
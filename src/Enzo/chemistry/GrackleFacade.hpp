@@ -164,6 +164,46 @@ public: // wrapped grackle functions:
   void solve_chemistry(Block* block, double compute_time,
                        double dt) const noexcept;
 
+  /// solve chemistry for selected cells of several blocks with a single call
+  /// to local_solve_chemistry
+  ///
+  /// The selected cells are gathered into a 1D grid, which is passed to
+  /// Grackle, and the results are scattered back to the blocks.
+  ///
+  /// @param[in] blocks Blocks holding the field data passed through to
+  ///     Grackle. These must all have the same fields and be evolved over
+  ///     the same timestep.
+  /// @param[in] cells For each block, the indices of the cells (including
+  ///     ghost zones) that are solved. Other cells are left unchanged.
+  /// @param[in] compute_time The nominal simulation time at which this
+  ///     evaluation occurs. This only matters in cosmological simulations.
+  /// @param[in] dt The integration timestep in code units
+  /// @param[out] cooling_time When not a nullptr, this is filled with the
+  ///     cooling time of each selected cell after the solve (in the order of
+  ///     the cells of each block, block after block), computed on the same
+  ///     1D grid
+  /// @param[in] max_temperature When not negative, selected cells with a
+  ///     higher temperature (in K) are left unchanged. The temperature is
+  ///     computed on the same 1D grid before the solve. This can't be
+  ///     combined with ``cooling_time``
+  ///
+  /// @note
+  /// Because neighboring cells of the 1D grid aren't neighbors in space, this
+  /// can't be used with options that depend on the grid's geometry (e.g.
+  /// ``H2_self_shielding = 1``)
+  void solve_chemistry(const std::vector<Block*>& blocks,
+                       const std::vector<std::vector<int>>& cells,
+                       double compute_time, double dt,
+                       enzo_float* cooling_time = nullptr,
+                       double max_temperature = -1.0) const noexcept;
+
+  /// hash of the values in the block's interior of every field that affects
+  /// Grackle's cooling and chemistry rates
+  ///
+  /// This is used to detect whether these fields have been modified since a
+  /// quantity (e.g. the cooling time) was computed from them.
+  long long hash_fields(Block* block) const noexcept;
+
   /// wrapper around the various methods for computing various grackle
   /// properties.
   ///
@@ -19,7 +19,11 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <vector>
 
 //----------------------------------------------------------------------
 // Component dependencies
@@ -122,6 +122,22 @@ public: /// entry methods
 
   //--------------------------------------------------
 
+  // EnzoMethodFof
+
+  /// Receive boundary particle labels (and positions in round 0)
+  void p_method_fof_recv
+  (int round, Index index, int of3[3], int np, double * pos,
+   int n, long long * label, int * owner);
+  /// Number of group labels changed in the last round
+  void r_method_fof_round(CkReductionMsg * msg);
+  /// Receive partial sums for halos owned by this Block
+  void p_method_fof_recv_halos
+  (Index index, int n, long long * label, double * data);
+  /// Acknowledge receipt of halo partial sums
+  void p_method_fof_ack();
+  /// Write the halo catalog and exit EnzoMethodFof
+  void r_method_fof_end(CkReductionMsg * msg);
+
   // EnzoMethodBalance
   void p_method_balance_migrate();
   void p_method_balance_done();
@@ -132,6 +148,11 @@ public: /// entry methods
   /// Synchronize for refresh
   void p_method_gravity_end();
 
+  // EnzoMethodGrackle
+
+  /// Continue after this PE's batched Grackle solve
+  void p_method_grackle_batch_done();
+
   // EnzoMethodInference
 
   /// Merge inference array creation masks from children
@@ -232,6 +253,15 @@ public: /// entry methods
   /// EnzoSolverBiCGStab entry method: ITER++
   void r_solver_bicgstab_loop_15(CkReductionMsg* msg);
 
+  /// EnzoSolverBiCGStab entry method: fused DOT's and SUM's
+  void r_solver_bicgstab_fused(CkReductionMsg* msg);
+
+  /// EnzoSolverBiCGStab entry method: return from fused preconditioner
+  void p_solver_bicgstab_fused_precon();
+
+  /// EnzoSolverBiCGStab entry method: refresh fused matvec operand
+  void p_solver_bicgstab_fused_matvec();
+
   void p_dot_recv_parent  (int n, long double * dot_block,
 			   std::vector<int> is_array,
 			   int i_function, int iter);
@@ -250,6 +280,10 @@ public: /// entry methods
   void r_solver_dd_barrier(CkReductionMsg* msg);
   void r_solver_dd_end(CkReductionMsg* msg);
 
+  // EnzoSolverFft
+
+  void p_solver_fft_recv(int n, double * x);
+
   // EnzoSolverJacobi
 
   void p_solver_jacobi_continue();
@@ -267,7 +301,9 @@ public: /// entry methods
   void p_solver_mg0_restrict_recv(FieldMsg * msg);
 
   // EnzoMethodFeedbackSTARSS
-  void p_method_feedback_starss_end();
+  void p_method_feedback_starss_recv
+  (int level, int n, int * i3, double * values);
+  void r_method_feedback_starss_send(CkReductionMsg * msg);
 
   //EnzoMethodM1Closure
   void p_method_m1_closure_solve_transport_eqn();
@@ -137,6 +137,9 @@ EnzoConfig::EnzoConfig() throw ()
   method_check_dir(),
   method_check_monitor_iter(0),
   method_check_include_ghosts(false),
+  method_check_async(false),
+  method_check_async_mb(1024.0),
+  method_check_layout("block"),
   // EnzoInitialMergeSinksTest
   initial_merge_sinks_test_particle_data_filename(""),
   // EnzoInitialAccretionTest
@@ -157,6 +160,8 @@ EnzoConfig::EnzoConfig() throw ()
   method_inference_level_infer(0),
   method_inference_field_group(),
   method_inference_overdensity_threshold(0),
+  method_inference_model_file(),
+  method_inference_model_threshold(0.5),
   // EnzoMethodTurbulence
   method_turbulence_edot(0.0),
   method_turbulence_mach_number(0.0),
@@ -334,12 +339,17 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_check_dir;
   p | method_check_monitor_iter;
   p | method_check_include_ghosts;
+  p | method_check_async;
+  p | method_check_async_mb;
+  p | method_check_layout;
 
   p | method_inference_level_base;
   p | method_inference_level_array;
   p | method_inference_level_infer;
   p | method_inference_field_group;
   p | method_inference_overdensity_threshold;
+  p | method_inference_model_file;
+  p | method_inference_model_threshold;
 
   PUParray(p,initial_accretion_test_sink_position,3);
   PUParray(p,initial_accretion_test_sink_velocity,3);
@@ -890,6 +900,15 @@ void EnzoConfig::read_method_check_(Parameters * p)
   }
   method_check_monitor_iter   = p->value_integer("monitor_iter",0);
   method_check_include_ghosts = p->value_logical("include_ghosts",false);
+  method_check_async          = p->value_logical("async",false);
+  method_check_async_mb       = p->value_float("async_mb",1024.0);
+  method_check_layout         = p->value_string("layout","block");
+
+  ASSERT1 ("EnzoConfig::read_method_check_()",
+           "Method:check:layout \"%s\" must be \"block\" or \"aggregate\"",
+           method_check_layout.c_str(),
+           (method_check_layout == "block" ||
+            method_check_layout == "aggregate"));
 }
 
 //----------------------------------------------------------------------
@@ -909,6 +928,11 @@ void EnzoConfig::read_method_inference_(Parameters* p)
 
   method_inference_overdensity_threshold = p->value_float
     ("Method:inference:overdensity_threshold",0.0);
+
+  method_inference_model_file = p->value_string
+    ("Method:inference:model_file","");
+  method_inference_model_threshold = p->value_float
+    ("Method:inference:model_threshold",0.5);
 }
 
 //----------------------------------------------------------------------
@@ -188,6 +188,9 @@ public: // interface
       method_check_ordering("order_morton"),
       method_check_dir(),
       method_check_monitor_iter(0),
+      method_check_async(false),
+      method_check_async_mb(1024.0),
+      method_check_layout("block"),
       // EnzoMethodCheckGravity
       method_check_gravity_particle_type(),
       // EnzoMethodTurbulence
@@ -199,6 +202,8 @@ public: // interface
       method_inference_level_infer(0),
       method_inference_field_group(),
       method_inference_overdensity_threshold(0),
+      method_inference_model_file(),
+      method_inference_model_threshold(0.5),
       // EnzoProlong
       prolong_enzo_type(),
       prolong_enzo_positive(true),
@@ -454,6 +459,9 @@ public: // attributes
   std::vector<std::string>   method_check_dir;
   int                        method_check_monitor_iter;
   bool                       method_check_include_ghosts;
+  bool                       method_check_async;
+  double                     method_check_async_mb;
+  std::string                method_check_layout;
 
   /// EnzoMethodCheckGravity
   std::string                method_check_gravity_particle_type;
@@ -464,6 +472,8 @@ public: // attributes
   int                        method_inference_level_infer;
   std::string                method_inference_field_group;
   float                      method_inference_overdensity_threshold;
+  std::string                method_inference_model_file;
+  double                     method_inference_model_threshold;
 
   /// EnzoMethodTurbulence
   double                     method_turbulence_edot;
@@ -76,12 +76,15 @@ void EnzoFactory::create_block_array
   int nax,nay,naz;
   cello::hierarchy()->root_blocks(&nax,&nay,&naz);
 
+  // process of each root block, as in MappingArray
+  const std::vector<int> process = MappingArray::root_process
+    (nax,nay,naz,MappingArray::mapping_type(enzo::config()->mesh_root_mapping));
+
   for (int ix=0; ix<nbx; ix++) {
     for (int iy=0; iy<nby; iy++) {
       for (int iz=0; iz<nbz; iz++) {
 
-        const int ip = ((long long) CkNumPes()) *
-          (ix + nax*(iy + nay*iz)) / (nax*nay*naz);
+        const int ip = process[ix + nax*(iy + nay*iz)];
 
         if (ip == CkMyPe()) {
 
@@ -138,6 +141,9 @@ void EnzoFactory::create_subblock_array
   int nax,nay,naz;
   cello::hierarchy()->root_blocks(&nax,&nay,&naz);
 
+  const std::vector<int> process = MappingArray::root_process
+    (nax,nay,naz,MappingArray::mapping_type(enzo::config()->mesh_root_mapping));
+
   for (int level = -1; level >= min_level; level--) {
 
     if (nbx > 1) nbx = ceil(0.5*nbx);
@@ -159,12 +165,12 @@ void EnzoFactory::create_subblock_array
       for (int iy=0; iy<nby; iy++) {
         for (int iz=0; iz<nbz; iz++) {
 
-          const int ip = ((long long) CkNumPes()) *
-            (ix + nax*(iy + nay*iz)) / (nax*nay*naz);
+          // map to the process of the first root block it covers
+          const int shift = -level;
+          const int ip =
+            process[(ix<<shift) + nax*((iy<<shift) + nay*(iz<<shift))];
 
           if (ip == CkMyPe()) {
-
-            int shift = -level;
  
             Index index(ix<<shift,iy<<shift,iz<<shift);
 
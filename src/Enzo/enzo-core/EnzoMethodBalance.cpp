@@ -11,6 +11,17 @@
 // #define TRACE_BALANCE
 //----------------------------------------------------------------------
 
+/// Return the index of the order method's Scalar<double> value with
+/// the given suffix, or -1 if none
+static int scalar_index_(std::string suffix)
+{
+  ScalarDescr * sd = cello::scalar_descr_double();
+  const int is_hilbert = sd->index("order_hilbert:" + suffix);
+  return (is_hilbert != -1) ? is_hilbert : sd->index("order_morton:" + suffix);
+}
+
+//----------------------------------------------------------------------
+
 EnzoMethodBalance::EnzoMethodBalance()
   : Method()
 {
@@ -59,6 +70,18 @@ void EnzoMethodBalance::compute ( Block * block) throw()
   int index = *scalar.value(is_index);
   int ip_next = (long long) CkNumPes()*index/count;
 
+  // Cut the ordering into segments of equal cost if available
+
+  const int is_cost_index = scalar_index_("cost_index");
+  const double cost_total = total_cost(block);
+  if (is_cost_index >= 0 && cost_total > 0.0) {
+    Scalar<double> scalar_cost(cello::scalar_descr_double(),
+                               block->data()->scalar_data_double());
+    const double cost_index = *scalar_cost.value(is_cost_index);
+    ip_next = (int)(CkNumPes()*cost_index/cost_total);
+    ip_next = std::min(std::max(ip_next,0),CkNumPes()-1);
+  }
+
   block->set_ip_next(ip_next);
 #ifdef TRACE_BALANCE
   CkPrintf ("self_balance %d %d %d %d\n", count, index,ip_next,CkMyPe());
@@ -129,9 +152,44 @@ void EnzoSimulation::p_method_balance_check()
             CkMyPe(),MsgRefresh::counter[CkMyPe()]);
 #endif
   if (sync_method_balance_.next()) {
-    enzo::block_array().doneInserting();
-    enzo::block_array().p_method_balance_done();
+    proxy_enzo_simulation.p_method_balance_report();
+  }
+}
+
+void EnzoSimulation::p_method_balance_report()
+{
+  // Sum cost of Blocks on this process now that migration is done
+
+  double cost[2] = {0.0, 0.0};
+  const int nb = hierarchy_->num_blocks();
+  for (int ib=0; ib<nb; ib++) {
+    Block * block = hierarchy_->block(ib);
+    cost[0] += EnzoMethodBalance::block_cost(block);
+    cost[1] = std::max(cost[1],EnzoMethodBalance::total_cost(block));
+  }
+
+  CkCallback callback
+    (CkIndex_EnzoSimulation::r_method_balance_report(nullptr), 0,
+     proxy_enzo_simulation);
+
+  contribute(2*sizeof(double), cost, CkReduction::max_double, callback);
+}
+
+void EnzoSimulation::r_method_balance_report(CkReductionMsg * msg)
+{
+  const double * cost = (const double *)msg->getData();
+  const double cost_max = cost[0];
+  const double cost_avg = cost[1] / CkNumPes();
+  delete msg;
+
+  if (cost_avg > 0.0) {
+    cello::monitor()->print
+      ("Method", "balance cost imbalance %f (max %g avg %g)",
+       cost_max / cost_avg, cost_max, cost_avg);
   }
+
+  enzo::block_array().doneInserting();
+  enzo::block_array().p_method_balance_done();
 }
 
 void EnzoBlock::p_method_balance_done()
@@ -149,3 +207,24 @@ void EnzoMethodBalance::done(EnzoBlock * enzo_block)
   enzo_block->compute_done();
 }
 
+//----------------------------------------------------------------------
+
+double EnzoMethodBalance::block_cost(Block * block)
+{
+  const int is_cost_block = scalar_index_("cost_block");
+  if (is_cost_block < 0) return 1.0;
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return *scalar.value(is_cost_block);
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodBalance::total_cost(Block * block)
+{
+  const int is_cost_total = scalar_index_("cost_total");
+  if (is_cost_total < 0) return 0.0;
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return *scalar.value(is_cost_total);
+}
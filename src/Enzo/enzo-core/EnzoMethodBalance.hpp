@@ -33,6 +33,14 @@ public: // interface
   void do_migrate(EnzoBlock * enzo_block);
   void done(EnzoBlock * enzo_block);
 
+  /// Return the Block's cost as computed by the order method, or 1
+  /// if the order method does not compute costs
+  static double block_cost(Block * block);
+
+  /// Return the total cost of all Blocks as computed by the order
+  /// method, or 0 if the order method does not compute costs
+  static double total_cost(Block * block);
+
 public: // virtual methods
 
   /// Apply the method to advance a block one timestep 
@@ -34,12 +34,14 @@ EnzoMsgCheck::EnzoMsgCheck()
     name_this_(),
     name_next_(),
     index_block_(),
+    count_block_(0),
     is_first_(),
     is_last_(),
     name_dir_(),
     index_file_(-1),
     index_order_(-1),
-    count_order_(-1)
+    count_order_(-1),
+    ip_stage_(-1)
 {
   ++counter[cello::index_static()];
   cello::hex_string(tag_,TAG_LEN);
@@ -150,6 +152,7 @@ int EnzoMsgCheck::size_()
   SIZE_STRING_TYPE(size,name_this_);
   SIZE_STRING_TYPE(size,name_next_);
   SIZE_SCALAR_TYPE(size,long long,index_block_);
+  SIZE_SCALAR_TYPE(size,long long,count_block_);
   SIZE_SCALAR_TYPE(size,bool,is_first_);
   SIZE_SCALAR_TYPE(size,bool,is_last_);
   SIZE_STRING_TYPE(size,name_dir_);
@@ -157,6 +160,7 @@ int EnzoMsgCheck::size_()
   SIZE_ARRAY_TYPE (size,int,adapt_buffer_,ADAPT_BUFFER_SIZE);
   SIZE_SCALAR_TYPE(size,int,index_order_);
   SIZE_SCALAR_TYPE(size,int,count_order_);
+  SIZE_SCALAR_TYPE(size,int,ip_stage_);
   return size;
 }
 
@@ -178,6 +182,7 @@ char * EnzoMsgCheck::save_(char * pc)
   SAVE_STRING_TYPE(pc,name_this_);
   SAVE_STRING_TYPE(pc,name_next_);
   SAVE_SCALAR_TYPE(pc,long long,index_block_);
+  SAVE_SCALAR_TYPE(pc,long long,count_block_);
   SAVE_SCALAR_TYPE(pc,bool,is_first_);
   SAVE_SCALAR_TYPE(pc,bool,is_last_);
   SAVE_STRING_TYPE(pc,name_dir_);
@@ -185,6 +190,7 @@ char * EnzoMsgCheck::save_(char * pc)
   SAVE_ARRAY_TYPE (pc,int,adapt_buffer_,ADAPT_BUFFER_SIZE);
   SAVE_SCALAR_TYPE(pc,int,index_order_);
   SAVE_SCALAR_TYPE(pc,int,count_order_);
+  SAVE_SCALAR_TYPE(pc,int,ip_stage_);
   return pc;
 }
 
@@ -206,6 +212,7 @@ char * EnzoMsgCheck::load_(char * pc)
   LOAD_STRING_TYPE(pc,name_this_);
   LOAD_STRING_TYPE(pc,name_next_);
   LOAD_SCALAR_TYPE(pc,long long,index_block_);
+  LOAD_SCALAR_TYPE(pc,long long,count_block_);
   LOAD_SCALAR_TYPE(pc,bool,is_first_);
   LOAD_SCALAR_TYPE(pc,bool,is_last_);
   LOAD_STRING_TYPE(pc,name_dir_);
@@ -213,6 +220,7 @@ char * EnzoMsgCheck::load_(char * pc)
   LOAD_ARRAY_TYPE (pc,int,adapt_buffer_,ADAPT_BUFFER_SIZE);
   LOAD_SCALAR_TYPE(pc,int,index_order_);
   LOAD_SCALAR_TYPE(pc,int,count_order_);
+  LOAD_SCALAR_TYPE(pc,int,ip_stage_);
   return pc;
 }
 //----------------------------------------------------------------------
@@ -113,6 +113,11 @@ public: // interface
     name_dir = name_dir_;
   }
 
+  /// Set the total number of Blocks in the checkpoint ordering
+  void set_count_block (long long count_block)
+  { count_block_ = count_block; }
+  long long count_block() const { return count_block_; }
+
   void set_adapt (const Adapt & adapt) {
     int size = adapt.data_size();
     ASSERT2 ("EnzoMsgCheck::set_adapt()",
@@ -128,6 +133,12 @@ public: // interface
   void set_name_dir (std::string name_dir)
   { name_dir_ = name_dir; }
 
+  /// Set the process whose staging memory holds this message's data
+  /// (asynchronous checkpoints only)
+  void set_ip_stage (int ip_stage)
+  { ip_stage_ = ip_stage; }
+  int ip_stage() const { return ip_stage_; }
+
   void set_io_block(IoEnzoBlock * io_block) { io_block_ = io_block; }
   IoEnzoBlock * io_block() { return io_block_; }
 
@@ -165,6 +176,7 @@ protected: // methods
     name_this_   = enzo_msg_check.name_this_;
     name_next_   = enzo_msg_check.name_next_;
     index_block_ = enzo_msg_check.index_block_;
+    count_block_ = enzo_msg_check.count_block_;
     is_first_    = enzo_msg_check.is_first_;
     is_last_     = enzo_msg_check.is_last_;
     name_dir_    = enzo_msg_check.name_dir_;
@@ -174,6 +186,7 @@ protected: // methods
 
     index_order_ = enzo_msg_check.index_order_;
     count_order_ = enzo_msg_check.count_order_;
+    ip_stage_    = enzo_msg_check.ip_stage_;
   }
 
 protected: // attributes
@@ -214,6 +227,7 @@ protected: // attributes
   std::string name_this_;
   std::string name_next_;
   long long index_block_;
+  long long count_block_;
   bool is_first_;
   bool is_last_;
 
@@ -228,6 +242,9 @@ protected: // attributes
   /// index/count for load balancing
   long long index_order_;
   long long count_order_;
+
+  /// Process that reserved staging memory for an asynchronous checkpoint
+  int ip_stage_;
 };
 
 #endif /* CHARM_ENZO_MSG_CHECK_HPP */
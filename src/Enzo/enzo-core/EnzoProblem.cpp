@@ -406,7 +406,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_last_smooth[index_solver],
        enzo_config->solver_coarse_level[index_solver]);
 
-  } else if (solver_type == "bicgstab") {
+  } else if (solver_type == "bicgstab" ||
+             solver_type == "bicgstab_fused") {
 
     solver = new EnzoSolverBiCgStab
       (enzo_config->solver_list[index_solver],
@@ -422,7 +423,8 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
        enzo_config->solver_precondition[index_solver],
-       enzo_config->solver_coarse_level[index_solver]);
+       enzo_config->solver_coarse_level[index_solver],
+       solver_type == "bicgstab_fused");
 
   } else if (solver_type == "diagonal") {
 
@@ -436,6 +438,20 @@ Solver * EnzoProblem::create_solver_
        index_prolong,
        index_restrict);
 
+  } else if (solver_type == "fft") {
+
+    solver = new EnzoSolverFft
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       index_prolong,
+       index_restrict,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver]);
+
   } else if (solver_type == "jacobi") {
 
     solver = new EnzoSolverJacobi
@@ -716,6 +732,10 @@ Method * EnzoProblem::create_method_
 
     method = new EnzoMethodMergeSinks(p_group);
 
+  } else if (name == "fof") {
+
+    method = new EnzoMethodFof(p_group);
+
   } else if (name == "accretion") {
 
     // TODO: maybe make a factory method, EnzoMethodAccretion::from_parameters,
@@ -27,6 +27,7 @@ CProxy_EnzoSimulation proxy_enzo_simulation;
 CProxy_IoEnzoWriter   proxy_io_enzo_writer;
 CProxy_IoEnzoReader   proxy_io_enzo_reader;
 CProxy_EnzoLevelArray proxy_level_array;
+CProxy_EnzoFftArray   proxy_fft_array;
 
 //----------------------------------------------------------------------
 
@@ -39,6 +40,12 @@ EnzoSimulation::EnzoSimulation
     check_num_files_(0),
     check_ordering_(""),
     check_directory_(),
+    check_name_dir_(),
+    check_async_active_(false),
+    check_async_pending_(false),
+    check_staged_bytes_(0),
+    check_staged_(),
+    check_deferred_(),
     restart_level_(0)
 {
 #ifdef CHECK_MEMORY
@@ -12,6 +12,7 @@
 class CProxy_IoEnzoReader;
 class CProxy_IoEnzoWriter;
 class CProxy_EnzoLevelArray;
+class CProxy_EnzoFftArray;
 
 #include "charm++.h"
 #include "charm_enzo.hpp"
@@ -31,10 +32,21 @@ public: // functions
   ( const char parameter_file[], int n);
 
   /// CHARM++ Constructor
-  EnzoSimulation() : CBase_EnzoSimulation() {}
+  EnzoSimulation()
+    : CBase_EnzoSimulation(),
+      check_async_active_(false),
+      check_async_pending_(false),
+      check_exit_pending_(false),
+      check_staged_bytes_(0)
+  {}
 
   /// CHARM++ Migration constructor
-  EnzoSimulation(CkMigrateMessage * m) : CBase_EnzoSimulation(m)
+  EnzoSimulation(CkMigrateMessage * m)
+    : CBase_EnzoSimulation(m),
+      check_async_active_(false),
+      check_async_pending_(false),
+      check_exit_pending_(false),
+      check_staged_bytes_(0)
   {
   };
 
@@ -62,13 +74,33 @@ public: // functions
   void r_method_balance_count(CkReductionMsg * msg);
   /// Count down of migrating blocks (plus root-Block in case none)
   void p_method_balance_check();
+  /// Compute the load of local Blocks after migrating
+  void p_method_balance_report();
+  /// Report the resulting load imbalance and complete load-balancing
+  void r_method_balance_report(CkReductionMsg * msg);
 
   /// EnzoMethodCheck
   void r_method_check_enter (CkReductionMsg *);
   void p_check_done();
+  /// Asynchronous checkpoint: all IoEnzoWriter files are open
+  void r_check_opened (CkReductionMsg *);
+
+  /// Asynchronous checkpoint: reserve bytes of staging memory for
+  /// Block index, returning false (and deferring the Block until
+  /// memory is released) if it would exceed Method:check:async_mb
+  bool check_stage (Index index, long long bytes, std::string name_dir);
+  /// Asynchronous checkpoint: release the staging memory this process
+  /// reserved for Block index, which may since have migrated, and
+  /// restart deferred Blocks that now fit
+  void p_check_unstage (Index index);
+  /// Asynchronous checkpoint: return whether exiting must wait until
+  /// the active checkpoint has closed its files, in which case
+  /// Main::p_exit_continue() is called when it has
+  bool check_exit_defer ();
   void p_set_io_reader(CProxy_IoEnzoReader proxy);
   void p_set_io_writer(CProxy_IoEnzoWriter proxy);
   void p_set_level_array(CProxy_EnzoLevelArray proxy);
+  void p_set_fft_array(CProxy_EnzoFftArray proxy);
 
   void set_sync_check_writer(int count)
   { sync_check_writer_created_.set_stop(count); }
@@ -107,6 +139,9 @@ private: // functions
 
   void infer_check_create_();
 
+  /// Create the checkpoint directory and start writing Blocks
+  void check_start_();
+
 private: // virtual functions
 
   virtual void initialize_config_() throw();
@@ -127,6 +162,21 @@ private: // attributes
   int                      check_num_files_;
   std::string              check_ordering_;
   std::vector<std::string> check_directory_;
+  /// Checkpoint directory of the current checkpoint
+  std::string              check_name_dir_;
+  /// Whether an asynchronous checkpoint is still being written
+  bool                     check_async_active_;
+  /// Whether a checkpoint is waiting for the active one to finish
+  bool                     check_async_pending_;
+  /// Whether exiting is waiting for the active checkpoint to finish
+  bool                     check_exit_pending_;
+  /// Bytes of Block data staged on this PE and not yet written
+  long long                check_staged_bytes_;
+  /// Bytes staged by each Block on this PE
+  std::map<Index,long long> check_staged_;
+  /// Blocks on this PE waiting for staging memory, with the
+  /// directory of the checkpoint each is waiting to write
+  std::vector<std::pair<Index,std::string>> check_deferred_;
 
   /// Balance Method synchronization
   Sync sync_method_balance_;
@@ -26,7 +26,7 @@ EnzoComputeAcceleration::EnzoComputeAcceleration
 
   i_p_ =  field_descr->field_id("potential");
 
-  if (order_ != 2 && order_ != 4) {
+  if (order_ != 2 && order_ != 4 && order_ != 6) {
     ERROR1("EnzoComputeAcceleration",
 	   "Unknown order %d", order_);
   }
@@ -89,6 +89,11 @@ void EnzoComputeAcceleration::compute_(Block * block)
   dy2 = 2*dy;
   dz2 = 2*dz;
 
+  int dx3,dy3,dz3;
+  dx3 = 3*dx;
+  dy3 = 3*dy;
+  dz3 = 3*dz;
+
   double xm,ym,zm;
   double xp,yp,zp;
   double hx,hy,hz;
@@ -198,6 +203,53 @@ void EnzoComputeAcceleration::compute_(Block * block)
 
     }
 
+  } else if (order_ == 6) {
+
+    if (rank_ == 1) {
+
+      const enzo_float fx = 1.0 / (60.0*hx);
+
+      for (int ix=3; ix<mx-3; ix++) {
+	int i=ix;
+	ax[i] = fx*(   p[i+dx3] -  9*p[i+dx2] + 45*p[i+dx]
+		    - 45*p[i-dx] +  9*p[i-dx2] -    p[i-dx3]);
+      }
+
+    } else if (rank_ == 2) {
+
+      const enzo_float fx = 1.0 / (60.0*hx);
+      const enzo_float fy = 1.0 / (60.0*hy);
+      for (int iy=3; iy<my-3; iy++) {
+	for (int ix=3; ix<mx-3; ix++) {
+	  int i=ix + mx*iy;
+	  ax[i] = fx*(   p[i+dx3] -  9*p[i+dx2] + 45*p[i+dx]
+		      - 45*p[i-dx] +  9*p[i-dx2] -    p[i-dx3]);
+	  ay[i] = fy*(   p[i+dy3] -  9*p[i+dy2] + 45*p[i+dy]
+		      - 45*p[i-dy] +  9*p[i-dy2] -    p[i-dy3]);
+	}
+      }
+
+    } else if (rank_ == 3) {
+
+      const enzo_float fx = 1.0 / (60.0*hx);
+      const enzo_float fy = 1.0 / (60.0*hy);
+      const enzo_float fz = 1.0 / (60.0*hz);
+      for (int iz=3; iz<mz-3; iz++) {
+	for (int iy=3; iy<my-3; iy++) {
+	  for (int ix=3; ix<mx-3; ix++) {
+	    int i=ix + mx*(iy + my*iz);
+	    ax[i] = fx*(   p[i+dx3] -  9*p[i+dx2] + 45*p[i+dx]
+			- 45*p[i-dx] +  9*p[i-dx2] -    p[i-dx3]);
+	    ay[i] = fy*(   p[i+dy3] -  9*p[i+dy2] + 45*p[i+dy]
+			- 45*p[i-dy] +  9*p[i-dy2] -    p[i-dy3]);
+	    az[i] = fz*(   p[i+dz3] -  9*p[i+dz2] + 45*p[i+dz]
+			- 45*p[i-dz] +  9*p[i-dz2] -    p[i-dz3]);
+	  }
+	}
+      }
+
+    }
+
   } else {
     ERROR1("EnzoComputeAcceleration",
 	   "Unknown order %d", order_);
@@ -47,6 +47,8 @@
 #include "gravity/solvers/EnzoSolverCg.hpp"
 #include "gravity/solvers/EnzoSolverDd.hpp"
 #include "gravity/solvers/EnzoSolverDiagonal.hpp"
+#include "gravity/solvers/EnzoFftArray.hpp"
+#include "gravity/solvers/EnzoSolverFft.hpp"
 #include "gravity/solvers/EnzoSolverJacobi.hpp"
 #include "gravity/solvers/EnzoSolverMg0.hpp"
 
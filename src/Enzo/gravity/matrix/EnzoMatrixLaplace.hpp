@@ -99,6 +99,10 @@ public: // virtual functions
   virtual int ghost_depth() const throw()
   { return (order_ == 2) ? 1 : ( (order_ == 4) ? 2 : 3); }
 
+  /// Order of accuracy of the finite-difference operator
+  int order() const throw()
+  { return order_; }
+
 protected: // functions
 
   void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
@@ -0,0 +1,357 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFftArray.cpp
+/// @date     2026-10-17
+/// @brief    Implements the EnzoFftArray class
+///
+///           Each phase counts its own messages, since transposed
+///           slabs from other elements may arrive before this element
+///           has received all of its Blocks.  A new solve cannot begin
+///           before the Blocks receive the previous solution, so state
+///           is reset in send_blocks_().
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/gravity/gravity.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoFftArray::EnzoFftArray()
+  : CBase_EnzoFftArray(),
+    order_(2),
+    num_slabs_(0),
+    count_block_(0),
+    count_fwd_(0),
+    count_bwd_(0),
+    block_index_(),
+    block_ixy_(),
+    z_slab_(),
+    y_slab_(),
+    scratch_()
+{
+  for (int axis=0; axis<3; axis++) {
+    N_[axis]  = 0;
+    n_[axis]  = 0;
+    nb_[axis] = 0;
+    h_[axis]  = 0.0;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::pup (PUP::er &p)
+{
+  TRACEPUP;
+
+  CBase_EnzoFftArray::pup(p);
+
+  // Slab data only exists during a solve, so is not migrated
+
+  PUParray(p,N_,3);
+  PUParray(p,n_,3);
+  PUParray(p,nb_,3);
+  PUParray(p,h_,3);
+  p | order_;
+  p | num_slabs_;
+  p | count_block_;
+  p | count_fwd_;
+  p | count_bwd_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::p_recv_block
+(Index index, int ib3[3], int nb3[3], int n3[3], double h3[3],
+ int order, int n, double * b)
+{
+  if (count_block_ == 0) {
+    set_level_(nb3,n3,h3,order);
+    z_slab_.assign(N_[0]*N_[1]*n_[2],0.0);
+    block_index_.clear();
+    block_ixy_.clear();
+  }
+
+  block_index_.push_back(index);
+  block_ixy_.push_back(ib3[0]);
+  block_ixy_.push_back(ib3[1]);
+
+  const int ix0 = ib3[0]*n_[0];
+  const int iy0 = ib3[1]*n_[1];
+  for (int iz=0; iz<n_[2]; iz++) {
+    for (int iy=0; iy<n_[1]; iy++) {
+      for (int ix=0; ix<n_[0]; ix++) {
+        z_slab_[ix0+ix + N_[0]*(iy0+iy + N_[1]*iz)] =
+          b[ix + n_[0]*(iy + n_[1]*iz)];
+      }
+    }
+  }
+
+  if (++count_block_ < nb_[0]*nb_[1]) return;
+
+  count_block_ = 0;
+
+  fft_xy_(-1);
+
+  // Send each y-slab its part of this z-slab
+
+  for (int iq=0; iq<num_slabs_; iq++) {
+    const int y0 = y_lower_(iq);
+    const int ny = y_lower_(iq+1) - y0;
+    std::vector< std::complex<double> > data (N_[0]*ny*n_[2]);
+    for (int iz=0; iz<n_[2]; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        std::copy_n (&z_slab_[N_[0]*(y0+iy + N_[1]*iz)], N_[0],
+                     &data[N_[0]*(iy + ny*iz)]);
+      }
+    }
+    thisProxy[iq].p_transpose_fwd
+      (thisIndex, nb_, n_, h_, order_, 2*data.size(), (double *)data.data());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::p_transpose_fwd
+(int ip, int nb3[3], int n3[3], double h3[3], int order,
+ int n, double * data)
+{
+  // this element may not have received any Blocks yet
+  set_level_(nb3,n3,h3,order);
+
+  const int y0 = y_lower_(thisIndex);
+  const int ny = y_lower_(thisIndex+1) - y0;
+  const int nz = n_[2];
+
+  if (count_fwd_ == 0) {
+    y_slab_.assign(N_[0]*ny*N_[2],0.0);
+  }
+
+  const std::complex<double> * values = (std::complex<double> *) data;
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      std::copy_n (&values[N_[0]*(iy + ny*iz)], N_[0],
+                   &y_slab_[N_[0]*(iy + ny*(ip*nz + iz))]);
+    }
+  }
+
+  if (++count_fwd_ < num_slabs_) return;
+
+  count_fwd_ = 0;
+
+  solve_z_();
+
+  // Return each z-slab its part of this y-slab
+
+  for (int jp=0; jp<num_slabs_; jp++) {
+    std::vector< std::complex<double> > data_bwd (N_[0]*ny*nz);
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        std::copy_n (&y_slab_[N_[0]*(iy + ny*(jp*nz + iz))], N_[0],
+                     &data_bwd[N_[0]*(iy + ny*iz)]);
+      }
+    }
+    thisProxy[jp].p_transpose_bwd
+      (thisIndex, 2*data_bwd.size(), (double *)data_bwd.data());
+  }
+  y_slab_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::p_transpose_bwd (int iq, int n, double * data)
+{
+  const int y0 = y_lower_(iq);
+  const int ny = y_lower_(iq+1) - y0;
+  const std::complex<double> * values = (std::complex<double> *) data;
+  for (int iz=0; iz<n_[2]; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      std::copy_n (&values[N_[0]*(iy + ny*iz)], N_[0],
+                   &z_slab_[N_[0]*(y0+iy + N_[1]*iz)]);
+    }
+  }
+
+  if (++count_bwd_ < num_slabs_) return;
+
+  count_bwd_ = 0;
+
+  fft_xy_(+1);
+
+  send_blocks_();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::fft_1d
+(std::complex<double> * a, int n, int stride, int sign,
+ std::vector< std::complex<double> > & scratch)
+{
+  if (n <= 1) return;
+
+  scratch.resize(n);
+  for (int i=0; i<n; i++) scratch[i] = a[i*stride];
+
+  if ((n & (n-1)) == 0) {
+
+    // iterative radix-2: bit-reversal permutation then butterflies
+
+    for (int i=1, j=0; i<n; i++) {
+      int bit = n >> 1;
+      for (; j & bit; bit >>= 1) j ^= bit;
+      j ^= bit;
+      if (i < j) std::swap(scratch[i],scratch[j]);
+    }
+    for (int len=2; len<=n; len<<=1) {
+      const double angle = sign*2.0*cello::pi/len;
+      for (int j=0; j<len/2; j++) {
+        const std::complex<double> w = std::polar(1.0,angle*j);
+        for (int i=0; i<n; i+=len) {
+          const std::complex<double> u = scratch[i+j];
+          const std::complex<double> v = scratch[i+j+len/2]*w;
+          scratch[i+j]       = u + v;
+          scratch[i+j+len/2] = u - v;
+        }
+      }
+    }
+    for (int i=0; i<n; i++) a[i*stride] = scratch[i];
+
+  } else {
+
+    // direct DFT
+
+    for (int k=0; k<n; k++) {
+      std::complex<double> sum = 0.0;
+      for (int j=0; j<n; j++) {
+        sum += scratch[j]*std::polar(1.0,sign*2.0*cello::pi*((1.0*j*k)/n));
+      }
+      a[k*stride] = sum;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+double EnzoFftArray::laplace_symbol (int order, int k, int n)
+{
+  const double theta = 2.0*cello::pi*k/n;
+  const double c1 = cos(theta);
+  const double c2 = cos(2.0*theta);
+  const double c3 = cos(3.0*theta);
+  if (order == 2) {
+    return 2.0*c1 - 2.0;
+  } else if (order == 4) {
+    return (-30.0 + 32.0*c1 - 2.0*c2) / 12.0;
+  } else if (order == 6) {
+    return (-2720.0 + 2910.0*c1 - 192.0*c2 + 2.0*c3) / 1080.0;
+  } else {
+    ERROR1 ("EnzoFftArray::laplace_symbol()",
+            "Order %d operator is not supported",
+            order);
+    return 0.0;
+  }
+}
+
+//======================================================================
+
+void EnzoFftArray::set_level_
+(int nb3[3], int n3[3], double h3[3], int order)
+{
+  for (int axis=0; axis<3; axis++) {
+    n_[axis]  = n3[axis];
+    nb_[axis] = nb3[axis];
+    N_[axis]  = n3[axis]*nb3[axis];
+    h_[axis]  = h3[axis];
+  }
+  order_ = order;
+  num_slabs_ = nb3[2];
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::fft_xy_(int sign)
+{
+  const int nx = N_[0];
+  const int ny = N_[1];
+  for (int iz=0; iz<n_[2]; iz++) {
+    std::complex<double> * z = &z_slab_[nx*ny*iz];
+    for (int iy=0; iy<ny; iy++) fft_1d (z + nx*iy, nx, 1,  sign, scratch_);
+    for (int ix=0; ix<nx; ix++) fft_1d (z + ix,    ny, nx, sign, scratch_);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::solve_z_()
+{
+  const int y0 = y_lower_(thisIndex);
+  const int ny = y_lower_(thisIndex+1) - y0;
+  const int nx = N_[0];
+  const int nz = N_[2];
+  const int dz = nx*ny;
+
+  for (int iy=0; iy<ny; iy++) {
+    for (int ix=0; ix<nx; ix++) {
+      fft_1d (&y_slab_[ix + nx*iy], nz, dz, -1, scratch_);
+    }
+  }
+
+  // Symbols of the Laplacian along each axis; axes with a single
+  // cell do not contribute
+
+  std::vector<double> symbol[3];
+  for (int axis=0; axis<3; axis++) {
+    symbol[axis].assign(N_[axis],0.0);
+    if (N_[axis] > 1) {
+      for (int k=0; k<N_[axis]; k++) {
+        symbol[axis][k] = laplace_symbol(order_,k,N_[axis])
+          / (h_[axis]*h_[axis]);
+      }
+    }
+  }
+
+  // Divide by the symbol, and set the singular zero mode (the mean
+  // of the solution) to zero
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+        const double lambda =
+          symbol[0][ix] + symbol[1][y0+iy] + symbol[2][iz];
+        std::complex<double> & y = y_slab_[ix + nx*(iy + ny*iz)];
+        y = (lambda != 0.0) ? y / lambda : 0.0;
+      }
+    }
+  }
+
+  for (int iy=0; iy<ny; iy++) {
+    for (int ix=0; ix<nx; ix++) {
+      fft_1d (&y_slab_[ix + nx*iy], nz, dz, +1, scratch_);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFftArray::send_blocks_()
+{
+  const double scale = 1.0 / (1.0*N_[0]*N_[1]*N_[2]);
+  const int n = n_[0]*n_[1]*n_[2];
+
+  std::vector<double> x(n);
+  for (size_t k=0; k<block_index_.size(); k++) {
+    const int ix0 = block_ixy_[2*k+0]*n_[0];
+    const int iy0 = block_ixy_[2*k+1]*n_[1];
+    for (int iz=0; iz<n_[2]; iz++) {
+      for (int iy=0; iy<n_[1]; iy++) {
+        for (int ix=0; ix<n_[0]; ix++) {
+          x[ix + n_[0]*(iy + n_[1]*iz)] = scale *
+            z_slab_[ix0+ix + N_[0]*(iy0+iy + N_[1]*iz)].real();
+        }
+      }
+    }
+    enzo::block_array()[block_index_[k]].p_solver_fft_recv(n,x.data());
+  }
+
+  z_slab_.clear();
+  block_index_.clear();
+  block_ixy_.clear();
+}
@@ -0,0 +1,113 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFftArray.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Declaration of the EnzoFftArray class
+
+#ifndef ENZO_ENZO_FFT_ARRAY_HPP
+#define ENZO_ENZO_FFT_ARRAY_HPP
+
+#include <complex>
+
+class EnzoFftArray : public CBase_EnzoFftArray {
+
+  /// @class    EnzoFftArray
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Slab-decomposed periodic Poisson solve
+  /// for EnzoSolverFft
+  ///
+  /// Element p first holds the z-slab of the level with the same z
+  /// extent as the p'th layer of Blocks, which is transformed along x
+  /// and y.  The slabs are then transposed into y-slabs, which are
+  /// transformed along z, multiplied by the inverse of the
+  /// finite-difference Laplacian's symbol, and transformed back.
+  /// Results are transposed back to z-slabs, inverse transformed
+  /// along y and x, and returned to the Blocks.
+
+public: // interface
+
+  /// Constructor
+  EnzoFftArray();
+
+  /// CHARM++ migration constructor
+  EnzoFftArray(CkMigrateMessage *m)
+    : CBase_EnzoFftArray(m)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Receive the right-hand side from a Block in this element's z-slab
+  void p_recv_block
+  (Index index, int ib3[3], int nb3[3], int n3[3], double h3[3],
+   int order, int n, double * b);
+
+  /// Receive this element's y range of a z-slab
+  void p_transpose_fwd
+  (int ip, int nb3[3], int n3[3], double h3[3], int order,
+   int n, double * data);
+
+  /// Receive the solution for a y range of this element's z-slab
+  void p_transpose_bwd (int iq, int n, double * data);
+
+  /// Unnormalized in-place 1D FFT of n values separated by stride,
+  /// with sign -1 for forward or +1 for inverse.  Uses radix-2 if n
+  /// is a power of two, else a direct DFT
+  static void fft_1d
+  (std::complex<double> * a, int n, int stride, int sign,
+   std::vector< std::complex<double> > & scratch);
+
+  /// Symbol of the 1D second-derivative operator of the given order
+  /// for wave number k of n, without the 1/h^2 factor
+  static double laplace_symbol (int order, int k, int n);
+
+protected: // functions
+
+  /// Set the level and Block sizes, cell widths, and Laplacian order
+  void set_level_(int nb3[3], int n3[3], double h3[3], int order);
+
+  /// Lower y index of the given y-slab
+  int y_lower_(int iq) const
+  { return (iq*N_[1])/num_slabs_; }
+
+  /// Transform the z-slab along x and y
+  void fft_xy_(int sign);
+
+  /// Transform the y-slab along z and apply the inverse Laplacian
+  void solve_z_();
+
+  /// Return the solution to the Blocks and reset for the next solve
+  void send_blocks_();
+
+protected: // attributes
+
+  /// Level size, Block size, and number of Blocks along each axis
+  int N_[3];
+  int n_[3];
+  int nb_[3];
+
+  /// Cell widths and Laplacian order
+  double h_[3];
+  int order_;
+
+  /// Number of slabs (Blocks along z)
+  int num_slabs_;
+
+  /// Counters for the current phase
+  int count_block_;
+  int count_fwd_;
+  int count_bwd_;
+
+  /// Blocks in this element's z-slab, and their x and y Block indices
+  std::vector<Index> block_index_;
+  std::vector<int> block_ixy_;
+
+  /// z-slab [iz][iy][ix] and y-slab [iz][iy][ix] data
+  std::vector< std::complex<double> > z_slab_;
+  std::vector< std::complex<double> > y_slab_;
+
+  /// Scratch space for strided 1D transforms
+  std::vector< std::complex<double> > scratch_;
+};
+
+#endif /* ENZO_ENZO_FFT_ARRAY_HPP */
@@ -28,6 +28,37 @@
 /// LINE 15:     beta = (R*R0) / beta_n * (alpha/omega)
 /// LINE 16:     P = R + beta * (P - omega * V)
 /// LINE 17:  end for
+///
+/// The "bicgstab_fused" solver type is a pipelined variant (after
+/// Cools and Vanroose, "The communication-hiding pipelined BiCGStab
+/// method for the parallel solution of large unsymmetric linear
+/// systems", Parallel Computing 65, 2017) with a single global
+/// reduction per iteration.  With B = A M^{-1} it additionally keeps
+/// U = B R, Q = B V, Z = B U and W = B Q, updated by recurrences, so
+/// that all inner products needed for alpha and omega are available
+/// from one reduction.  The reduction is overlapped with the refresh
+/// and matrix-vector product W = B Q.  Since M^{-1} is applied to
+/// linear combinations of vectors, the preconditioner must be linear
+/// (a fixed number of iterations from a zero initial guess).
+///
+/// F01:  U = B R
+/// F02:  for j=0,1,... until convergence
+/// F03:     Z = B U
+/// F04:     beta = (rho/rho_prev) * (alpha/omega)    [0 if j == 0]
+/// F05:     P = R + beta * (P - omega * V)
+/// F06:     V = U + beta * (V - omega * Q)
+/// F07:     Q = Z + beta * (Q - omega * W)
+/// F08:     begin reduction of R*R and inner products of R0, R, U, V, Q
+/// F09:     W = B Q
+/// F10:     end reduction, test convergence on R*R
+/// F11:     alpha = rho / (V*R0)
+/// F12:     S = R - alpha * V,  T = U - alpha * Q
+/// F13:     omega = (T*S) / (T*T)
+/// F14:     X = X + alpha * M \ P + omega * M \ S
+/// F15:     R = S - omega * T
+/// F16:     U = T - omega * (Z - alpha * W)
+/// F17:     rho = S*R0 - omega * T*R0
+/// F18:  end for
 
 #include "Cello/cello.hpp"
 #include "Enzo/enzo.hpp"
@@ -208,7 +239,8 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
  int min_level, int max_level,
  int iter_max, double res_tol,
  int index_precon,
- int coarse_level
+ int coarse_level,
+ bool fused
  ) 
   : Solver(name,
 	   field_x,
@@ -230,8 +262,10 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
     gx_(0), gy_(0), gz_(0),
     coarse_level_(coarse_level),
     ir_loop_3_(-1),
-    ir_loop_9_(-1)
+    ir_loop_9_(-1),
+    fused_(fused)
 {
+  for (int i=0; i<fused_num_stages; i++) ir_fused_[i] = -1;
 
   // RESET restart_cycle TO 1 UNTIL CONVERGENCE
   if (restart_cycle_ != 1) {
@@ -281,6 +315,21 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   ScalarDescr * scalar_descr_int = cello::scalar_descr_int();
   is_iter_ = scalar_descr_int->new_value("solver_bicgstab_iter");
 
+  if (fused_) {
+    const char * fused_names[fused_num_dots] =
+      { "r0v", "r0u", "r0q", "rr", "ur", "uv", "qr",
+        "vq",  "uu",  "uq",  "qq", "sr", "su", "sv", "sq" };
+    is_fused_.resize(fused_num_dots);
+    for (int i=0; i<fused_num_dots; i++) {
+      is_fused_[i] = scalar_descr_quad->new_value
+        (std::string("solver_bicgstab_fused_") + fused_names[i]);
+    }
+    is_fused_sync_ = cello::scalar_descr_sync()->new_value
+      ("solver_bicgstab_fused_sync");
+    is_fused_stage_ = scalar_descr_int->new_value
+      ("solver_bicgstab_fused_stage");
+  }
+
   FieldDescr * field_descr = cello::field_descr();
 
   ir_ = field_descr->insert_temporary();
@@ -291,6 +340,25 @@ EnzoSolverBiCgStab::EnzoSolverBiCgStab
   iq_ = field_descr->insert_temporary();
   iu_ = field_descr->insert_temporary();
 
+  if (fused_) {
+    iz_ = field_descr->insert_temporary();
+    iw_ = field_descr->insert_temporary();
+    if (index_precon_ >= 0) {
+      irh_ = field_descr->insert_temporary();
+      iph_ = field_descr->insert_temporary();
+      ivh_ = field_descr->insert_temporary();
+      iuh_ = field_descr->insert_temporary();
+      iqh_ = field_descr->insert_temporary();
+    } else {
+      // M = I: M^{-1} applied to a vector is the vector itself
+      irh_ = ir_;
+      iph_ = ip_;
+      ivh_ = iv_;
+      iuh_ = iu_;
+      iqh_ = iq_;
+    }
+  }
+
   /// Initialize default Refresh (called before entry to compute())
 
   new_register_refresh_();
@@ -330,6 +398,9 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | is_qs_;
     p | is_dot_sync_;
     p | is_iter_;
+    p | is_fused_;
+    p | is_fused_sync_;
+    p | is_fused_stage_;
 
     p | res_tol_;
     p | index_precon_;
@@ -342,6 +413,13 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | iv_;
     p | iq_;
     p | iu_;
+    p | iz_;
+    p | iw_;
+    p | irh_;
+    p | iph_;
+    p | ivh_;
+    p | iuh_;
+    p | iqh_;
 
     p | m_;
     p | mx_;
@@ -355,6 +433,8 @@ void EnzoSolverBiCgStab::pup(PUP::er& p) {
     p | coarse_level_;
     p | ir_loop_3_;
     p | ir_loop_9_;
+    PUParray(p,ir_fused_,fused_num_stages);
+    p | fused_;
   }
 
 //----------------------------------------------------------------------
@@ -387,6 +467,11 @@ void EnzoSolverBiCgStab::apply
     if (solve_type_ == solve_tree) {
       s_dot_sync_(enzo_block) = cello::num_children();
     }
+
+    if (fused_) {
+      // join the fused reduction with W = B * Q
+      s_fused_sync_(enzo_block) = 2;
+    }
   
     A_ = A;
 
@@ -440,6 +525,12 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
     Y[i] = V[i] = Q[i] =  U[i] = 0.0;
   }
 
+  if (fused_) {
+    enzo_float* Z = (enzo_float*) field.values(iz_);
+    enzo_float* W = (enzo_float*) field.values(iw_);
+    for (int i=0; i<m_; i++) Z[i] = W[i] = 0.0;
+  }
+
   if (is_finest_(block)) {
 
     const bool reuse_x = reuse_solution_ (block->cycle());
@@ -479,8 +570,7 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
   if (is_singular_()) {
 
     std::vector<long double> reduce;
-    reduce.resize(3+1);
-    reduce.clear();
+    reduce.assign(3+1,0.0);
     reduce[0] = 3;
 
     long double count = 0.0;
@@ -574,8 +664,7 @@ void EnzoSolverBiCgStab::start_2(EnzoBlock* block,
   /// update B and initialize temporary vectors (on leaf blocks only)
 
   std::vector<long double> reduce;
-  reduce.resize(3+1);
-  reduce.clear();
+  reduce.assign(3+1,0.0);
   reduce[0] = 3;
 
   if (is_finest_(block)) {
@@ -841,6 +930,16 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
     this->end(block, return_diverged);
 
     
+  } else if (fused_) {
+
+    /// F01: U = B R on first entry, else continue iteration at F11
+
+    if (iter == 0) {
+      fused_apply_(block,fused_stage_r);
+    } else {
+      fused_update_(block);
+    }
+
   } else {
 
     loop_2(block);
@@ -982,8 +1081,7 @@ void EnzoSolverBiCgStab::loop_4(EnzoBlock* block) throw() {
   /// compute local contributions to vr0_ = DOT(V, R0)
   
   std::vector<long double> reduce;
-  reduce.resize(3+1);
-  reduce.clear();
+  reduce.assign(3+1,0.0);
   reduce[0] = 3;
   
   if (is_finest_(block)) {
@@ -1280,8 +1378,7 @@ void EnzoSolverBiCgStab::loop_10(EnzoBlock* block) throw() {
   COPY_FIELD(block,"loop_10",iu_,"U");
 
   std::vector<long double> reduce;
-  reduce.resize(5+1);
-  reduce.clear();
+  reduce.assign(5+1,0.0);
   reduce[0] = 5;
   
   if (is_finest_(block)) {
@@ -1477,13 +1574,12 @@ void EnzoSolverBiCgStab::loop_12(EnzoBlock* block,
   /// Update previous beta value (beta_d_) to current value (beta_n_)
   
   S(beta_d) = S(beta_n);
-  
+
   /// rr_     = DOT(R, R)
   /// beta_n = DOT(R, R0)
   
   std::vector<long double> reduce;
-  reduce.resize(2+1);
-  reduce.clear();
+  reduce.assign(2+1,0.0);
   reduce[0] = 2;
   
   if (is_finest_(block)) {
@@ -1628,6 +1724,503 @@ void EnzoBlock::r_solver_bicgstab_loop_15(CkReductionMsg* msg) {
 
 //----------------------------------------------------------------------
 
+void EnzoSolverBiCgStab::fused_apply_(EnzoBlock* block, int stage) throw() {
+
+  TRACE_BCG(block,this,"fused_apply");
+
+  s_fused_stage_(block) = stage;
+
+  if (index_precon_ >= 0) {
+
+    const int i_src[fused_num_stages] = { ir_,  iu_,  iq_  };
+    const int i_hat[fused_num_stages] = { irh_, iuh_, iqh_ };
+
+    Field field = block->data()->field();
+
+    enzo_float * H = (enzo_float*) field.values(i_hat[stage]);
+
+    for (int i=0; i<m_; i++) H[i] = 0.0;
+
+    Solver * precon = cello::solver(index_precon_);
+
+    /// Consecutive stages on a Block may overlap stages on its
+    /// neighbors, so alternate sync id's as in the unfused solver
+
+    precon->set_sync_id ((stage == fused_stage_u) ?
+                         enzo_sync_id_solver_bicgstab_precon_2 :
+                         enzo_sync_id_solver_bicgstab_precon_1);
+    precon->set_callback(CkIndex_EnzoBlock::p_solver_bicgstab_fused_precon());
+
+    precon->set_field_x(i_hat[stage]);
+    precon->set_field_b(i_src[stage]);
+    precon->apply(A_,block);
+
+  } else {
+
+    fused_refresh_(block);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_bicgstab_fused_precon() {
+
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverBiCgStab*> (solver())->fused_refresh_(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::fused_refresh_(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"fused_refresh");
+
+  const int id_refresh = ir_fused_[s_fused_stage_(block)];
+
+  Refresh * refresh = cello::refresh(id_refresh);
+
+  refresh->set_active(is_finest_(block));
+
+  block->refresh_start
+    (id_refresh, CkIndex_EnzoBlock::p_solver_bicgstab_fused_matvec());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_bicgstab_fused_matvec() {
+
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverBiCgStab*> (solver())->fused_matvec_(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::fused_matvec_(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"fused_matvec");
+
+  const int stage = s_fused_stage_(block);
+
+  const int i_hat[fused_num_stages] = { irh_, iuh_, iqh_ };
+  const int i_dst[fused_num_stages] = { iu_,  iz_,  iw_  };
+
+  if (is_finest_(block)) {
+
+    /// F01: U = A * (M \ R)
+    /// F03: Z = A * (M \ U)
+    /// F09: W = A * (M \ Q)
+
+    A_->matvec(i_dst[stage], i_hat[stage], block);
+
+  }
+
+  switch (stage) {
+  case fused_stage_r:
+    fused_apply_(block,fused_stage_u);
+    break;
+  case fused_stage_u:
+    fused_reduce_(block);
+    break;
+  case fused_stage_q:
+    /// with a preconditioner the reduction is begun only after W is
+    /// computed, so that preconditioner solves on different Blocks
+    /// remain separated by a global reduction
+    if (index_precon_ >= 0) fused_dot_(block);
+    fused_join_(block);
+    break;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::fused_reduce_(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"fused_reduce");
+
+  const int iter = (s_iter_(block));
+
+  if (is_finest_(block)) {
+
+    Field field = block->data()->field();
+
+    enzo_float* R = (enzo_float*) field.values(ir_);
+    enzo_float* P = (enzo_float*) field.values(ip_);
+    enzo_float* V = (enzo_float*) field.values(iv_);
+    enzo_float* U = (enzo_float*) field.values(iu_);
+    enzo_float* Q = (enzo_float*) field.values(iq_);
+    enzo_float* Z = (enzo_float*) field.values(iz_);
+    enzo_float* W = (enzo_float*) field.values(iw_);
+
+    enzo_float* RH = (enzo_float*) field.values(irh_);
+    enzo_float* PH = (enzo_float*) field.values(iph_);
+    enzo_float* VH = (enzo_float*) field.values(ivh_);
+    enzo_float* UH = (enzo_float*) field.values(iuh_);
+    enzo_float* QH = (enzo_float*) field.values(iqh_);
+
+    if (iter == 0) {
+
+      for (int i=0; i<m_; i++) {
+        P[i] = R[i];
+        V[i] = U[i];
+        Q[i] = Z[i];
+      }
+      if (index_precon_ >= 0) {
+        for (int i=0; i<m_; i++) {
+          PH[i] = RH[i];
+          VH[i] = UH[i];
+        }
+      }
+
+    } else {
+
+      /// F04: beta = (rho/rho_prev) * (alpha/omega)
+
+      const enzo_float beta =
+        (S(beta_n)/S(beta_d))*(S(alpha)/ S(omega));
+      const enzo_float omega = S(omega);
+
+      /// F05: P = R + beta * (P - omega * V)
+      /// F06: V = U + beta * (V - omega * Q)
+      /// F07: Q = Z + beta * (Q - omega * W)
+
+      for (int i=0; i<m_; i++) {
+        P[i] = R[i] + beta*(P[i] - omega*V[i]);
+        V[i] = U[i] + beta*(V[i] - omega*Q[i]);
+        Q[i] = Z[i] + beta*(Q[i] - omega*W[i]);
+      }
+      if (index_precon_ >= 0) {
+        for (int i=0; i<m_; i++) {
+          PH[i] = RH[i] + beta*(PH[i] - omega*VH[i]);
+          VH[i] = UH[i] + beta*(VH[i] - omega*QH[i]);
+        }
+      }
+    }
+  }
+
+  /// F08: begin reduction
+  /// F09: W = B Q
+
+  if (index_precon_ < 0) fused_dot_(block);
+
+  fused_apply_(block,fused_stage_q);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::fused_dot_(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"fused_dot");
+
+  std::vector<long double> reduce;
+  reduce.assign(fused_num_dots+1,0.0);
+  reduce[0] = fused_num_dots;
+
+  if (is_finest_(block)) {
+
+    Field field = block->data()->field();
+
+    enzo_float* R0 = (enzo_float*) field.values(ir0_);
+    enzo_float* R  = (enzo_float*) field.values(ir_);
+    enzo_float* V  = (enzo_float*) field.values(iv_);
+    enzo_float* U  = (enzo_float*) field.values(iu_);
+    enzo_float* Q  = (enzo_float*) field.values(iq_);
+
+    long double * dot = &reduce[1];
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  dot[fused_r0v] += R0[i]*V[i];
+	  dot[fused_r0u] += R0[i]*U[i];
+	  dot[fused_r0q] += R0[i]*Q[i];
+	  dot[fused_rr]  += R[i]*R[i];
+	  dot[fused_ur]  += U[i]*R[i];
+	  dot[fused_uv]  += U[i]*V[i];
+	  dot[fused_qr]  += Q[i]*R[i];
+	  dot[fused_vq]  += V[i]*Q[i];
+	  dot[fused_uu]  += U[i]*U[i];
+	  dot[fused_uq]  += U[i]*Q[i];
+	  dot[fused_qq]  += Q[i]*Q[i];
+	}
+      }
+    }
+
+    /// for singular Poisson problems, sums for projecting R, U, V
+    /// and Q into R(A) after the reduction (R0 is already projected)
+
+    if (is_singular_()) {
+      for (int iz=gz_; iz<mz_-gz_; iz++) {
+	for (int iy=gy_; iy<my_-gy_; iy++) {
+	  for (int ix=gx_; ix<mx_-gx_; ix++) {
+	    int i = ix + mx_*(iy + my_*iz);
+	    dot[fused_sr] += R[i];
+	    dot[fused_su] += U[i];
+	    dot[fused_sv] += V[i];
+	    dot[fused_sq] += Q[i];
+	  }
+	}
+      }
+    }
+  }
+
+  /// sum over blocks and continue with r_solver_bicgstab_fused()
+
+  std::vector<int> is_array;
+  if (solve_type_ == solve_tree) {
+    is_array = is_fused_;
+  }
+
+  CkCallback callback = CkCallback
+    (CkIndex_EnzoBlock::r_solver_bicgstab_fused(NULL),
+     block->proxy_array());
+
+  TRACE_DOT(block,"start",5);
+  inner_product_(block,fused_num_dots,&reduce[0],is_array,callback,bcg_fused);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_bicgstab_fused(CkReductionMsg* msg) {
+
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  static_cast<EnzoSolverBiCgStab*> (solver())->fused_done_(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::fused_done_(EnzoBlock* block,
+                                     CkReductionMsg * msg) throw() {
+
+  TRACE_BCG(block,this,"fused_done");
+
+  if (solve_type_ != solve_tree && msg != NULL) {
+    long double* data = (long double*) msg->getData();
+    ASSERT2("EnzoSolverBiCgStab::fused_done_",
+	    "Expecting (data[0] = %Lg) == %d",
+	    data[0],fused_num_dots,(data[0] == fused_num_dots));
+    for (int i=0; i<fused_num_dots; i++) {
+      s_fused_(block,i) = data[i+1];
+    }
+  }
+
+  delete msg;
+
+  fused_join_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::fused_join_(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"fused_join");
+
+  /// F10: continue only when both the reduction and W are done
+
+  if (! s_fused_sync_(block).next()) return;
+
+  if (is_finest_(block)) {
+    cello::check(s_fused_(block,fused_rr),"BCG_rr_",__FILE__,__LINE__);
+  }
+
+  /// for singular problems, correct the inner products and project
+  /// R, U, V and Q into R(A)
+
+  if (is_singular_()) {
+
+    const long double c  = S(c);
+    const long double sr = s_fused_(block,fused_sr);
+    const long double su = s_fused_(block,fused_su);
+    const long double sv = s_fused_(block,fused_sv);
+    const long double sq = s_fused_(block,fused_sq);
+
+    s_fused_(block,fused_rr) -= sr*sr/c;
+    s_fused_(block,fused_ur) -= su*sr/c;
+    s_fused_(block,fused_uv) -= su*sv/c;
+    s_fused_(block,fused_qr) -= sq*sr/c;
+    s_fused_(block,fused_vq) -= sv*sq/c;
+    s_fused_(block,fused_uu) -= su*su/c;
+    s_fused_(block,fused_uq) -= su*sq/c;
+    s_fused_(block,fused_qq) -= sq*sq/c;
+
+    if (is_finest_(block)) {
+
+      Field field = block->data()->field();
+
+      enzo_float* R = (enzo_float*) field.values(ir_);
+      enzo_float* U = (enzo_float*) field.values(iu_);
+      enzo_float* V = (enzo_float*) field.values(iv_);
+      enzo_float* Q = (enzo_float*) field.values(iq_);
+
+      enzo_float r_shift = sr / c;
+      enzo_float u_shift = su / c;
+      enzo_float v_shift = sv / c;
+      enzo_float q_shift = sq / c;
+
+      for (int i=0; i<m_; i++) {
+	R[i] -= r_shift;
+	U[i] -= u_shift;
+	V[i] -= v_shift;
+	Q[i] -= q_shift;
+      }
+    }
+  }
+
+  S(rr) = s_fused_(block,fused_rr);
+
+  TRACE_SCALAR(block,"rr_",S(rr));
+
+  /// R*R of the initial residual was already tested by loop_0()
+
+  if (s_iter_(block) == 0) {
+    fused_update_(block);
+  } else {
+    loop_0(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBiCgStab::fused_update_(EnzoBlock* block) throw() {
+
+  TRACE_BCG(block,this,"fused_update");
+
+  const long double rho = S(beta_n);
+  const long double r0v = s_fused_(block,fused_r0v);
+  const long double r0u = s_fused_(block,fused_r0u);
+  const long double r0q = s_fused_(block,fused_r0q);
+  const long double ur  = s_fused_(block,fused_ur);
+  const long double uv  = s_fused_(block,fused_uv);
+  const long double qr  = s_fused_(block,fused_qr);
+  const long double vq  = s_fused_(block,fused_vq);
+  const long double uu  = s_fused_(block,fused_uu);
+  const long double uq  = s_fused_(block,fused_uq);
+  const long double qq  = s_fused_(block,fused_qq);
+
+  /// check for breakdown in BiCgStab
+
+  if (r0v == 0.0) {
+    WARNING1 ("EnzoSolverBiCgStab::fused_update_()",
+	      "Solver error: %s vr0 == 0",
+	      block->name().c_str());
+    this->end(block, return_error);
+    return;
+  }
+
+  /// F11: alpha = rho / (V*R0)
+
+  const long double alpha = rho / r0v;
+
+  /// F13: omega = (T*S) / (T*T), expanding S and T from F12
+
+  const long double ts = ur - alpha*(uv + qr) + alpha*alpha*vq;
+  const long double tt = uu - 2.0*alpha*uq + alpha*alpha*qq;
+
+  if (tt == 0.0 || ts == 0.0) {
+    WARNING1 ("EnzoSolverBiCgStab::fused_update_()",
+	      "Solver error: %s omega == 0",
+	      block->name().c_str());
+    this->end(block, return_error);
+    return;
+  }
+
+  const long double omega = ts / tt;
+
+  /// F17: rho = S*R0 - omega * T*R0
+
+  const long double rho_next = (rho - alpha*r0v) - omega*(r0u - alpha*r0q);
+
+  if (rho_next == 0.0) {
+    WARNING1 ("EnzoSolverBiCgStab::fused_update_()",
+	      "Solver error: %s beta_n == 0",
+	      block->name().c_str());
+    this->end(block, return_error);
+    return;
+  }
+
+  S(alpha)  = alpha;
+  S(omega)  = omega;
+  S(beta_d) = rho;
+  S(beta_n) = rho_next;
+
+  TRACE_SCALAR(block,"alpha",S(alpha));
+  TRACE_SCALAR(block,"omega",S(omega));
+  TRACE_SCALAR(block,"beta_n",S(beta_n));
+
+  /// update vectors on leaf blocks
+
+  if (is_finest_(block)) {
+
+    Field field = block->data()->field();
+
+    enzo_float* X = (enzo_float*) field.values(ix_);
+    enzo_float* R = (enzo_float*) field.values(ir_);
+    enzo_float* P = (enzo_float*) field.values(ip_);
+    enzo_float* V = (enzo_float*) field.values(iv_);
+    enzo_float* U = (enzo_float*) field.values(iu_);
+    enzo_float* Q = (enzo_float*) field.values(iq_);
+    enzo_float* Z = (enzo_float*) field.values(iz_);
+    enzo_float* W = (enzo_float*) field.values(iw_);
+
+    const enzo_float a = alpha;
+    const enzo_float w = omega;
+
+    if (index_precon_ >= 0) {
+
+      enzo_float* RH = (enzo_float*) field.values(irh_);
+      enzo_float* PH = (enzo_float*) field.values(iph_);
+      enzo_float* VH = (enzo_float*) field.values(ivh_);
+      enzo_float* UH = (enzo_float*) field.values(iuh_);
+      enzo_float* QH = (enzo_float*) field.values(iqh_);
+
+      /// F14: X = X + alpha * M \ P + omega * M \ S
+      /// and M \ R = M \ S - omega * M \ T
+
+      for (int i=0; i<m_; i++) {
+        const enzo_float sh = RH[i] - a*VH[i];
+        X[i]  = X[i] + a*PH[i] + w*sh;
+        RH[i] = sh - w*(UH[i] - a*QH[i]);
+      }
+
+    } else {
+
+      /// F14: X = X + alpha * P + omega * S  [ M = I ]
+
+      for (int i=0; i<m_; i++) {
+        X[i] = X[i] + a*P[i] + w*(R[i] - a*V[i]);
+      }
+    }
+
+    /// F15: R = S - omega * T
+    /// F16: U = T - omega * (Z - alpha * W)
+
+    for (int i=0; i<m_; i++) {
+      const enzo_float s = R[i] - a*V[i];
+      const enzo_float t = U[i] - a*Q[i];
+      R[i] = s - w*t;
+      U[i] = t - w*(Z[i] - a*W[i]);
+    }
+  }
+
+  (s_iter_(block))++;
+
+  /// F03: Z = B U
+
+  fused_apply_(block,fused_stage_u);
+}
+
+//----------------------------------------------------------------------
+
 void EnzoSolverBiCgStab::end (EnzoBlock* block, int retval) throw () {
 
   TRACE_BCG(block,this,"end");
@@ -1865,6 +2458,7 @@ void EnzoSolverBiCgStab::dot_done_(EnzoBlock * block,
   case bcg_loop_6:  loop_6  (block,nullptr); break;
   case bcg_loop_12: loop_12 (block,nullptr); break;
   case bcg_loop_14: loop_14 (block,nullptr); break;
+  case bcg_fused:   fused_done_ (block,nullptr); break;
   default:
    ERROR1 ("EnzoSolverBiCgStab::dot_done()",
            "Unknown i_function %d",
@@ -1912,4 +2506,27 @@ void EnzoSolverBiCgStab::new_register_refresh_()
   
   refresh_loop_9->set_callback(CkIndex_EnzoBlock::p_solver_bicgstab_loop_9());
 
+  //--------------------------------------------------
+
+  if (fused_) {
+
+    const int i_fused[fused_num_stages] = { irh_, iuh_, iqh_ };
+    const char * s_fused[fused_num_stages] = { ":fused_r", ":fused_u", ":fused_q" };
+
+    for (int stage=0; stage<fused_num_stages; stage++) {
+
+      ir_fused_[stage] = add_refresh_();
+      cello::simulation()->refresh_set_name(ir_fused_[stage],name()+s_fused[stage]);
+
+      Refresh * refresh_fused = cello::refresh(ir_fused_[stage]);
+
+      if (solve_type_ == solve_tree)
+        refresh_fused->set_root_level (coarse_level_);
+
+      refresh_fused->add_field (i_fused[stage]);
+
+      refresh_fused->set_callback
+        (CkIndex_EnzoBlock::p_solver_bicgstab_fused_matvec());
+    }
+  }
 }
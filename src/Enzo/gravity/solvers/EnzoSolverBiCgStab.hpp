@@ -21,7 +21,27 @@ class EnzoSolverBiCgStab : public Solver {
      bcg_loop_0a,
      bcg_loop_6,
      bcg_loop_12,
-     bcg_loop_14
+     bcg_loop_14,
+     bcg_fused
+    };
+
+  /// Stages of the fused solver, each applying M^{-1} then A
+  enum bcg_fused_stage
+    {
+     fused_stage_r,  /// U = A * (M \ R)
+     fused_stage_u,  /// Z = A * (M \ U)
+     fused_stage_q,  /// W = A * (M \ Q)
+     fused_num_stages
+    };
+
+  /// Values in the single reduction of the fused solver
+  enum bcg_fused_dot
+    {
+     fused_r0v, fused_r0u, fused_r0q,
+     fused_rr,  fused_ur,  fused_uv,  fused_qr,
+     fused_vq,  fused_uu,  fused_uq,  fused_qq,
+     fused_sr,  fused_su,  fused_sv,  fused_sq,
+     fused_num_dots
     };
     
   /// @class    EnzoSolverBiCgStab
@@ -50,7 +70,8 @@ public: // interface
 		     int iter_max, 
 		     double res_tol,
 		     int index_precon,
-		     int coarse_level);
+		     int coarse_level,
+		     bool fused = false);
 
   /// default constructor
   EnzoSolverBiCgStab()
@@ -62,6 +83,7 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_fused_(),    is_fused_sync_(-1), is_fused_stage_(-1),
       res_tol_(0),
       index_precon_(-1),
       iter_max_(-1),
@@ -72,13 +94,18 @@ public: // interface
       iv_(-1),
       iq_(-1),
       iu_(-1),
+      iz_(-1), iw_(-1),
+      irh_(-1), iph_(-1), ivh_(-1), iuh_(-1), iqh_(-1),
       m_(0),
       mx_(0), my_(0), mz_(0),
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
-  {};
+      ir_loop_9_(-1),
+      fused_(false)
+  {
+    for (int i=0; i<fused_num_stages; i++) ir_fused_[i] = -1;
+  }
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoSolverBiCgStab);
@@ -93,18 +120,24 @@ public: // interface
       is_r0s_(-1),    is_c_(-1),       is_bs_(-1),       is_xs_(-1),
       is_bnorm_(-1),  is_vr0_(-1),     is_ys_(-1),       is_vs_(-1),
       is_us_(-1),     is_qs_(-1),      is_dot_sync_(-1), is_iter_(-1),
+      is_fused_(),    is_fused_sync_(-1), is_fused_stage_(-1),
       res_tol_(0.0),
       index_precon_(-1),
       iter_max_(0), 
       ir_(-1), ir0_(-1), ip_(-1), 
       iy_(-1), iv_(-1), iq_(-1), iu_(-1),
+      iz_(-1), iw_(-1),
+      irh_(-1), iph_(-1), ivh_(-1), iuh_(-1), iqh_(-1),
       m_(0), mx_(0), my_(0), mz_(0),
       gx_(0), gy_(0), gz_(0),
       coarse_level_(0),
       ir_loop_3_(-1),
-      ir_loop_9_(-1)
+      ir_loop_9_(-1),
+      fused_(false)
           
-  {}
+  {
+    for (int i=0; i<fused_num_stages; i++) ir_fused_[i] = -1;
+  }
 
   /// Charm++ Pack / Unpack function
   void pup(PUP::er& p);
@@ -113,7 +146,8 @@ public: // interface
   virtual void apply (std::shared_ptr<Matrix> A, Block * block) throw();
 
   /// Type of this solver
-  virtual std::string type() const { return "bicgstab"; }
+  virtual std::string type() const
+  { return fused_ ? "bicgstab_fused" : "bicgstab"; }
 
   /// Projects RHS and sets initial vectors R, R0, and P
   void start_2(EnzoBlock* enzo_block,
@@ -156,6 +190,32 @@ public: // interface
   /// Updates search direction, begins update on iteration counter
   void loop_14(EnzoBlock* enzo_block, CkReductionMsg * ) throw();
 
+  /// Fused solver: begin applying M^{-1} then A for the given stage
+  void fused_apply_(EnzoBlock* enzo_block, int stage) throw();
+
+  /// Fused solver: return from preconditioner, begins refresh
+  void fused_refresh_(EnzoBlock* enzo_block) throw();
+
+  /// Fused solver: matrix-vector product for the current stage
+  void fused_matvec_(EnzoBlock* enzo_block) throw();
+
+  /// Fused solver: updates P, V and Q, begins the single reduction
+  /// overlapped with W = A * (M \ Q)
+  void fused_reduce_(EnzoBlock* enzo_block) throw();
+
+  /// Fused solver: local contributions to the single reduction
+  void fused_dot_(EnzoBlock* enzo_block) throw();
+
+  /// Fused solver: return from the single reduction
+  void fused_done_(EnzoBlock* enzo_block, CkReductionMsg * ) throw();
+
+  /// Fused solver: wait for both the reduction and W, then project
+  /// and test for convergence
+  void fused_join_(EnzoBlock* enzo_block) throw();
+
+  /// Fused solver: compute alpha and omega and update X, R and U
+  void fused_update_(EnzoBlock* enzo_block) throw();
+
   /// End the solve
   void end(EnzoBlock* enzo_block, int retval) throw();
 
@@ -182,6 +242,17 @@ public: // interface
     field.allocate_temporary(iv_);
     field.allocate_temporary(iq_);
     field.allocate_temporary(iu_);
+    if (fused_) {
+      field.allocate_temporary(iz_);
+      field.allocate_temporary(iw_);
+      if (index_precon_ >= 0) {
+        field.allocate_temporary(irh_);
+        field.allocate_temporary(iph_);
+        field.allocate_temporary(ivh_);
+        field.allocate_temporary(iuh_);
+        field.allocate_temporary(iqh_);
+      }
+    }
   }
 
   /// Dellocate temporary Fields
@@ -195,6 +266,17 @@ public: // interface
     field.deallocate_temporary(iv_);
     field.deallocate_temporary(iq_);
     field.deallocate_temporary(iu_);
+    if (fused_) {
+      field.deallocate_temporary(iz_);
+      field.deallocate_temporary(iw_);
+      if (index_precon_ >= 0) {
+        field.deallocate_temporary(irh_);
+        field.deallocate_temporary(iph_);
+        field.deallocate_temporary(ivh_);
+        field.deallocate_temporary(iuh_);
+        field.deallocate_temporary(iqh_);
+      }
+    }
   }
   
   // Inner product methods
@@ -240,6 +322,15 @@ protected:
   int & s_iter_(EnzoBlock * block)
   { return *block->data()->scalar_int().value(is_iter_); }
 
+  Sync & s_fused_sync_(EnzoBlock * block)
+  { return *block->data()->scalar_sync().value(is_fused_sync_); }
+
+  int & s_fused_stage_(EnzoBlock * block)
+  { return *block->data()->scalar_int().value(is_fused_stage_); }
+
+  long double & s_fused_(EnzoBlock * block, int i_dot)
+  { return scalar_(block,is_fused_[i_dot]); }
+
   /// Register all refresh phases
   void new_register_refresh_();
   
@@ -276,6 +367,11 @@ protected: // attributes
   int is_dot_sync_;
   int is_iter_;
 
+  /// Reduced values, join Sync, and current stage if fused
+  std::vector<int> is_fused_;
+  int is_fused_sync_;
+  int is_fused_stage_;
+
   /// Convergence tolerance on the relative residual
   double res_tol_;
 
@@ -294,6 +390,17 @@ protected: // attributes
   int iq_;
   int iu_;
 
+  /// Fused solver vector id's: Z = A * (M \ U), W = A * (M \ Q),
+  /// and M^{-1} applied to R, P, V, U, Q (aliases if no
+  /// preconditioner)
+  int iz_;
+  int iw_;
+  int irh_;
+  int iph_;
+  int ivh_;
+  int iuh_;
+  int iqh_;
+
   /// Block field attributes
   int m_;              /// product mx_*my_*mz_ for convenience
   int mx_, my_, mz_;   /// total block size
@@ -305,6 +412,11 @@ protected: // attributes
   /// Refresh id's
   int ir_loop_3_;
   int ir_loop_9_;
+  int ir_fused_[fused_num_stages];
+
+  /// Whether to use the pipelined variant with a single reduction
+  /// per iteration
+  bool fused_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_BICGSTAB_HPP */
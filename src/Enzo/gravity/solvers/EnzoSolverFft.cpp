@@ -0,0 +1,164 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.cpp
+/// @date     2026-10-17
+/// @brief    Direct periodic Poisson solver using distributed FFTs
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/gravity/gravity.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoSolverFft::EnzoSolverFft
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int index_prolong,
+ int index_restrict,
+ int min_level,
+ int max_level) throw()
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+           index_prolong,
+           index_restrict,
+	   min_level,
+	   max_level)
+{
+  // Create the FFT array with one element per root Block along z,
+  // which is enough slabs for any level at or below the root level,
+  // & broadcast proxy to other Simulation objects
+  if (CkMyPe() == 0) {
+
+    const int num_slabs = cello::config()->mesh_root_blocks[2];
+
+    proxy_fft_array = CProxy_EnzoFftArray::ckNew(num_slabs);
+
+    proxy_enzo_simulation.p_set_fft_array(proxy_fft_array);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::p_set_fft_array(CProxy_EnzoFftArray proxy)
+{
+  proxy_fft_array = proxy;
+}
+
+//======================================================================
+
+void EnzoSolverFft::apply ( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  // Blocks outside the solve level only call the callback
+
+  if (! is_finest_(block)) {
+    Solver::end_(block);
+    return;
+  }
+
+  ASSERT2 ("EnzoSolverFft::apply()",
+           "Solver %s Block level %d must be at or below the root level",
+           name_.c_str(), block->level(),
+           (block->level() <= 0));
+
+  int period3[3];
+  cello::hierarchy()->get_periodicity(period3,period3+1,period3+2);
+  const int rank = cello::rank();
+  for (int axis=0; axis<rank; axis++) {
+    ASSERT2 ("EnzoSolverFft::apply()",
+             "Solver %s requires periodic boundaries along axis %d",
+             name_.c_str(), axis, period3[axis]);
+  }
+
+  std::shared_ptr<EnzoMatrixLaplace> laplace =
+    std::dynamic_pointer_cast<EnzoMatrixLaplace>(A);
+
+  ASSERT1 ("EnzoSolverFft::apply()",
+           "Solver %s requires a Laplacian matrix",
+           name_.c_str(), (laplace != nullptr));
+
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions (ib_,&mx,&my,&mz);
+  field.ghost_depth(ib_,&gx,&gy,&gz);
+
+  int n3[3] = { mx-2*gx, my-2*gy, mz-2*gz };
+
+  int ib3[3], nb3[3];
+  block->index_global(ib3,ib3+1,ib3+2,nb3,nb3+1,nb3+2);
+
+  double h3[3] = { 1.0, 1.0, 1.0 };
+  block->cell_width(h3,h3+1,h3+2);
+
+  // Copy interior of B to the message buffer
+
+  const enzo_float * B = (enzo_float*) field.values(ib_);
+
+  std::vector<double> b(n3[0]*n3[1]*n3[2]);
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      for (int ix=0; ix<n3[0]; ix++) {
+        const int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+        b[ix + n3[0]*(iy + n3[1]*iz)] = B[i];
+      }
+    }
+  }
+
+  proxy_fft_array[ib3[2]].p_recv_block
+    (block->index(), ib3, nb3, n3, h3, laplace->order(),
+     b.size(), b.data());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_fft_recv (int n, double * x)
+{
+  EnzoSolverFft * solver = static_cast<EnzoSolverFft*> (this->solver());
+  solver->recv_solution(this,n,x);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::recv_solution
+(EnzoBlock * enzo_block, int n, double * x) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions (ix_,&mx,&my,&mz);
+  field.ghost_depth(ix_,&gx,&gy,&gz);
+
+  const int nx = mx-2*gx;
+  const int ny = my-2*gy;
+  const int nz = mz-2*gz;
+
+  ASSERT3 ("EnzoSolverFft::recv_solution()",
+           "Solver %s received %d values of the wrong size for Block %s",
+           name_.c_str(), n, enzo_block->name().c_str(),
+           (n == nx*ny*nz));
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+        const int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+        X[i] = x[ix + nx*(iy + ny*iz)];
+      }
+    }
+  }
+
+  Solver::end_(enzo_block);
+}
@@ -0,0 +1,66 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverFft class
+
+#ifndef ENZO_ENZO_SOLVER_FFT_HPP
+#define ENZO_ENZO_SOLVER_FFT_HPP
+
+class EnzoSolverFft : public Solver {
+
+  /// @class    EnzoSolverFft
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Direct periodic Poisson solver on a
+  /// uniform level
+  ///
+  /// Blocks in the solve level send B to an EnzoFftArray, which
+  /// solves A*X = B using distributed FFTs, where A is an
+  /// EnzoMatrixLaplace of order 2, 4, or 6, and returns X with zero
+  /// mean.  The level must cover the domain, so must be the root level
+  /// or coarser, and all boundaries must be periodic.  May be used as
+  /// the coarse solver of EnzoSolverMg0 or EnzoSolverDd.
+
+public: // interface
+
+  /// Constructor
+  EnzoSolverFft(std::string name,
+                std::string field_x,
+                std::string field_b,
+                int monitor_iter,
+                int restart_cycle,
+                int solve_type,
+                int index_prolong,
+                int index_restrict,
+                int min_level,
+                int max_level) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverFft);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverFft (CkMigrateMessage *m)
+    : Solver(m)
+  {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Solver::pup(p);
+  };
+
+  /// Copy the solution received from the EnzoFftArray to X and exit
+  void recv_solution (EnzoBlock * enzo_block, int n, double * x) throw();
+
+public: // virtual functions
+
+  /// Solve the linear system Ax = b
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "fft"; }
+
+};
+
+#endif /* ENZO_ENZO_SOLVER_FFT_HPP */
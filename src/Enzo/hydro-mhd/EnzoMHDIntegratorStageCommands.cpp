@@ -21,7 +21,8 @@ EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands
     reconstructors_(),
     integration_quan_updater_(nullptr),
     mhd_choice_(EnzoMHDIntegratorStageCommands::parse_bfield_choice_
-                (args.mhd_choice))
+                (args.mhd_choice)),
+    tile_size_(args.tile_size)
 {
   // check compatability with EnzoPhysicsFluidProps
   EnzoPhysicsFluidProps* fluid_props = enzo::fluid_props();
@@ -61,6 +62,10 @@ EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands
 
   integration_quan_updater_ =
     new EnzoIntegrationQuanUpdate(integration_field_list, true);
+
+  ASSERT1("EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands",
+          "tile_size must be non-negative, not %d",
+          tile_size_, tile_size_ >= 0);
 }
 
 //----------------------------------------------------------------------
@@ -168,10 +173,19 @@ void EnzoMHDIntegratorStageCommands::compute_update_stage
       interface_vel_arr_ptr = nullptr;
     }
 
-    compute_flux_(dim, cur_dt, cell_widths_xyz[dim], primitive_map,
-                  pl_map, pr_map, flux_maps_xyz[dim], dUcons_map,
-                  interface_vel_arr_ptr, *reconstructor, bfield_method_,
-                  stale_depth, passive_list);
+    if ((tile_size_ > 0) && (dim < 2)) {
+      // the z-fluxes are always computed for the whole block, since tiles
+      // along z would need to overlap along the direction of reconstruction
+      compute_flux_tiled_(dim, cur_dt, cell_widths_xyz[dim], primitive_map,
+                          pl_map, pr_map, flux_maps_xyz[dim], dUcons_map,
+                          interface_vel_arr_ptr, *reconstructor,
+                          bfield_method_, stale_depth, passive_list);
+    } else {
+      compute_flux_(dim, cur_dt, cell_widths_xyz[dim], primitive_map,
+                    pl_map, pr_map, flux_maps_xyz[dim], dUcons_map,
+                    interface_vel_arr_ptr, *reconstructor, bfield_method_,
+                    stale_depth, passive_list, CSlice(nullptr, nullptr));
+    }
   }
 
   // increment the stale_depth
@@ -211,7 +225,8 @@ void EnzoMHDIntegratorStageCommands::compute_flux_
  EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
  const EFlt3DArray* const interface_velocity_arr_ptr,
  EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
- const int stale_depth, const str_vec_t& passive_list) const noexcept
+ const int stale_depth, const str_vec_t& passive_list,
+ const CSlice &z_slc) const noexcept
 {
 
   // First, reconstruct the left and right interface values
@@ -228,7 +243,7 @@ void EnzoMHDIntegratorStageCommands::compute_flux_
   // interfaces
   if (bfield_method != nullptr) {
     bfield_method->correct_reconstructed_bfield(priml_map, primr_map,
-                                                dim, cur_stale_depth);
+                                                dim, cur_stale_depth, z_slc);
   }
 
   // Next, compute the fluxes
@@ -256,7 +271,66 @@ void EnzoMHDIntegratorStageCommands::compute_flux_
 
   // Finally, have bfield_method record the upwind direction (for handling CT)
   if (bfield_method != nullptr){
-    bfield_method->identify_upwind(flux_map, dim, cur_stale_depth);
+    bfield_method->identify_upwind(flux_map, dim, cur_stale_depth, z_slc);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMHDIntegratorStageCommands::compute_flux_tiled_
+(const int dim, const double cur_dt, const enzo_float cell_width,
+ EnzoEFltArrayMap &primitive_map,
+ EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
+ EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+ const EFlt3DArray* const interface_velocity_arr_ptr,
+ EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
+ const int stale_depth, const str_vec_t& passive_list) const noexcept
+{
+  // Each step of compute_flux_ trims at most this many planes from each side
+  // of the arrays it's given (including along z), so each tile's view
+  // includes this many extra planes on either side of the tile
+  const int halo = stale_depth + reconstructor.immediate_staling_rate();
+
+  // Tiles must be thicker than the halo so that the first and last tiles
+  // (which have no extra planes outside the block) aren't trimmed away. Any
+  // remainder thinner than a tile is merged into the last tile
+  const int mz = primitive_map.array_shape(0);
+  const int tile = std::max(tile_size_, halo + 1);
+
+  const CSlice full_ax(0, nullptr);
+
+  int z0 = 0;
+  while (z0 < mz) {
+    const int z1 = (mz - z0 < 2*tile) ? mz : z0 + tile;
+
+    const CSlice z_slc(std::max(0, z0 - halo), std::min(mz, z1 + halo));
+
+    EnzoEFltArrayMap tile_primitive_map =
+      primitive_map.subarray_map(z_slc, full_ax, full_ax);
+    EnzoEFltArrayMap tile_pl_map =
+      priml_map.subarray_map(z_slc, full_ax, full_ax);
+    EnzoEFltArrayMap tile_pr_map =
+      primr_map.subarray_map(z_slc, full_ax, full_ax);
+    EnzoEFltArrayMap tile_flux_map =
+      flux_map.subarray_map(z_slc, full_ax, full_ax);
+    EnzoEFltArrayMap tile_dUcons_map =
+      dUcons_map.subarray_map(z_slc, full_ax, full_ax);
+
+    EFlt3DArray *tile_vel_arr_ptr, tile_vel_arr;
+    if (interface_velocity_arr_ptr != nullptr) {
+      tile_vel_arr =
+        interface_velocity_arr_ptr->subarray(z_slc, full_ax, full_ax);
+      tile_vel_arr_ptr = &tile_vel_arr;
+    } else {
+      tile_vel_arr_ptr = nullptr;
+    }
+
+    compute_flux_(dim, cur_dt, cell_width, tile_primitive_map,
+                  tile_pl_map, tile_pr_map, tile_flux_map, tile_dUcons_map,
+                  tile_vel_arr_ptr, reconstructor, bfield_method,
+                  stale_depth, passive_list, z_slc);
+
+    z0 = z1;
   }
 }
 
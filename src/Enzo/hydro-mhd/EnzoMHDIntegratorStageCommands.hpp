@@ -29,12 +29,14 @@ struct EnzoMHDIntegratorStageArgPack {
   std::vector<std::string> recon_names;
   double theta_limiter;
   std::string mhd_choice;
+  int tile_size;
 
   void pup(PUP::er &p) {
     p | rsolver;
     p | recon_names;
     p | theta_limiter;
     p | mhd_choice;
+    p | tile_size;
   }
 };
 
@@ -317,7 +319,23 @@ protected:
   /// @param[in]     stale_depth indicates the current stale depth (before
   ///     performing reconstruction)
   /// @param[in]     passive_list A list of keys for passively advected scalars.
+  /// @param[in]     z_slc The range of z planes of the block that the maps
+  ///     cover. This is a full slice unless called by `compute_flux_tiled_`.
   void compute_flux_
+  (const int dim, const double cur_dt, const enzo_float cell_width,
+   EnzoEFltArrayMap &primitive_map,
+   EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
+   EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+   const EFlt3DArray* const interface_velocity_arr_ptr,
+   EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
+   const int stale_depth, const str_vec_t& passive_list,
+   const CSlice &z_slc) const noexcept;
+
+  /// Computes the fluxes along `dim` (which must be 0 or 1) by calling
+  /// `compute_flux_` on slabs of `tile_size_` z planes at a time, so that
+  /// the intermediate values of a slab are still in cache when used. The
+  /// arguments are the same as for `compute_flux_`.
+  void compute_flux_tiled_
   (const int dim, const double cur_dt, const enzo_float cell_width,
    EnzoEFltArrayMap &primitive_map,
    EnzoEFltArrayMap &priml_map, EnzoEFltArrayMap &primr_map,
@@ -380,6 +398,10 @@ private:
   /// Indicates how magnetic fields are handled
   bfield_choice mhd_choice_;
 
+  /// Number of z planes per tile when computing the x and y fluxes. A value
+  /// of 0 computes the fluxes of the whole block at once.
+  int tile_size_;
+
 };
 
 #endif /* ENZO_MHD_INTEGRATOR_STAGE_COMMANDS_HPP */
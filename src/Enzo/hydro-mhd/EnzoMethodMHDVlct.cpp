@@ -80,7 +80,8 @@ parse_mhdchoice_pack_pair_(ParameterGroup p)
     new EnzoMHDIntegratorStageArgPack {p.value_string("riemann_solver","hlld"),
                                        recon_names,
                                        p.value_float("theta_limiter", 1.5),
-                                       p.value_string("mhd_choice", "")};
+                                       p.value_string("mhd_choice", ""),
+                                       p.value_integer("tile_size", 0)};
 
   return {time_scheme, argpack_ptr};
 }
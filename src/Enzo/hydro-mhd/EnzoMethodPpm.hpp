@@ -57,6 +57,29 @@ private:
                                  bool use_minimum_pressure_support,
                                  enzo_float minimum_pressure_support_parameter);
 
+  /// Scratch arrays used by SolveHydroEquations(), kept between calls
+  /// so that Blocks of the same size reuse them without reallocating
+  struct ScratchSpace {
+    std::vector<enzo_float> temp;
+    std::vector<enzo_float> velocity;
+    std::vector<enzo_float> cell_width;
+    std::vector<int> array;
+    std::vector<int> coloff;
+    std::vector<int> ie_error;
+  };
+
+  /// Return a pointer to at least size elements of the scratch vector,
+  /// growing it only if needed
+  template <class T>
+  static T * scratch_array_(std::vector<T> & vector, std::size_t size)
+  {
+    if (vector.size() < size) vector.resize(size);
+    return vector.data();
+  }
+
+  /// Scratch space for each PE (one per thread in SMP mode)
+  static ScratchSpace scratch_[CONFIG_NODE_SIZE];
+
 public: // virtual methods
 
   /// Apply the method to advance a block one timestep 
@@ -29,6 +29,10 @@
 // #define DEBUG_FLUX
 //----------------------------------------------------------------------
 
+EnzoMethodPpm::ScratchSpace EnzoMethodPpm::scratch_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
 int EnzoMethodPpm::SolveHydroEquations
 (
  EnzoBlock& block,
@@ -54,11 +58,16 @@ int EnzoMethodPpm::SolveHydroEquations
   field.ghost_depth(0,&gx,&gy,&gz);
   field.dimensions(0,&mx,&my,&mz);
 
+  // Temporary arrays are taken from the per-PE scratch space, which
+  // only grows when a larger Block is encountered
+
+  ScratchSpace & scratch = scratch_[cello::index_static()];
+
 #ifdef IE_ERROR_FIELD
   int num_ie_error = 0;
-  int *ie_error_x = new int [mx*my*mz];
-  int *ie_error_y = new int [mx*my*mz];
-  int *ie_error_z = new int [mx*my*mz];
+  int *ie_error_x = scratch_array_(scratch.ie_error,3*mx*my*mz);
+  int *ie_error_y = ie_error_x + mx*my*mz;
+  int *ie_error_z = ie_error_y + mx*my*mz;
 #else
   int num_ie_error = -1;
   int *ie_error_x = nullptr;
@@ -79,7 +88,8 @@ int EnzoMethodPpm::SolveHydroEquations
   enzo_float * colorpt = (enzo_float *) field.permanent();
 
   // coloff: offsets into the color array (for each color field)
-  int * coloff   = (ncolor > 0) ? (new int [ncolor]) : NULL;
+  int * coloff   = (ncolor > 0) ?
+    scratch_array_(scratch.coloff,ncolor) : NULL;
   int index_color = 0;
   for (int index_field = 0;
        index_field < field.field_count();
@@ -113,17 +123,22 @@ int EnzoMethodPpm::SolveHydroEquations
 
   velocity_x = (enzo_float *) field.values("velocity_x");
 
+  // (the solver updates these, so they are cleared on every call)
+
+  enzo_float * velocity_yz = (rank < 3) ?
+    scratch_array_(scratch.velocity,2*size) : NULL;
+
   if (rank >= 2) {
     velocity_y = (enzo_float *) field.values("velocity_y");
   } else {
-    velocity_y = new enzo_float[size];
+    velocity_y = velocity_yz;
     for (int i=0; i<size; i++) velocity_y[i] = 0.0;
   }
 
     if (rank >= 3) {
     velocity_z = (enzo_float *) field.values("velocity_z");
   } else {
-    velocity_z = new enzo_float[size];
+    velocity_z = velocity_yz + size;
     for (int i=0; i<size; i++) velocity_z[i] = 0.0;
   }
 
@@ -206,14 +221,14 @@ int EnzoMethodPpm::SolveHydroEquations
 			 block.GridDimension[1]*block.GridDimension[2]),
 		     block.GridDimension[2]*block.GridDimension[0]);
 
-  enzo_float *temp = new enzo_float[tempsize*(32+ncolor*4)];
+  enzo_float *temp = scratch_array_(scratch.temp,tempsize*(32+ncolor*4));
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
 
   size = NumberOfSubgrids*3*(18+2*ncolor) + 1;
 
-  int * array = new int[size];
+  int * array = scratch_array_(scratch.array,size);
   for (int i=0; i<size; i++) array[i] = 0;
 
   int * p = array;
@@ -320,9 +335,16 @@ int EnzoMethodPpm::SolveHydroEquations
 
   /* Create a cell width array to pass (and convert to absolute coords). */
 
+  int cell_width_size = 0;
+  for (dim = 0; dim < MAX_DIMENSION; dim++) {
+    cell_width_size += block.GridDimension[dim];
+  }
+  enzo_float * cell_width = scratch_array_(scratch.cell_width,cell_width_size);
+
   enzo_float * CellWidthTemp[MAX_DIMENSION];
   for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    CellWidthTemp[dim] = new enzo_float [block.GridDimension[dim]];
+    CellWidthTemp[dim] = cell_width;
+    cell_width += block.GridDimension[dim];
     if (dim < rank) {
       for (int i=0; i<block.GridDimension[dim]; i++)
 	CellWidthTemp[dim][i] = (cosmo_a*block.CellWidth[dim]);
@@ -401,24 +423,7 @@ int EnzoMethodPpm::SolveHydroEquations
   }
 #endif
 
-  for (dim = 0; dim < MAX_DIMENSION; dim++) {
-    delete [] CellWidthTemp[dim];
-  }
-
-  /* deallocate temporary space for solver */
-
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
-
-  delete [] array;
-
-  delete [] coloff;
-#ifdef IE_ERROR_FIELD
-  delete [] ie_error_x;
-  delete [] ie_error_y;
-  delete [] ie_error_z;
-#endif
+  // (temporary space for solver is kept in scratch_ for the next call)
 
   return ENZO_SUCCESS;
 
@@ -113,9 +113,13 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
+  /// @param[in]     z_slc The range of z planes of the block that `l_map`
+  ///     and `r_map` cover. This is a full slice unless the fluxes are
+  ///     computed in tiles along z (which is only done for `dim` < 2).
   virtual void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
                                             EnzoEFltArrayMap &r_map, int dim,
-                                            int stale_depth) noexcept = 0;
+                                            int stale_depth,
+                                            const CSlice &z_slc) noexcept = 0;
 
   /// In the case of Constrained Transport, identifies and stores the upwind
   /// direction.
@@ -125,8 +129,12 @@ public: // interface
   /// @param[in] dim The dimension to identify the upwind direction along.
   /// @param[in] stale_depth The current staling depth. This should match the
   ///     staling depth used to compute the flux_group.
+  /// @param[in] z_slc The range of z planes of the block that `flux_map`
+  ///     covers. This is a full slice unless the fluxes are computed in
+  ///     tiles along z.
   virtual void identify_upwind(const EnzoEFltArrayMap &flux_map, int dim,
-                               int stale_depth) noexcept = 0;
+                               int stale_depth,
+                               const CSlice &z_slc) noexcept = 0;
 
   /// Updates all components of the bfields (this is to be called before the
   /// hydro quantities are updated)
@@ -121,7 +121,7 @@ void EnzoBfieldMethodCT::check_required_fields() const noexcept
 
 void EnzoBfieldMethodCT::correct_reconstructed_bfield
 (EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim,
- int stale_depth) noexcept
+ int stale_depth, const CSlice &z_slc) noexcept
 {
   require_registered_block_(); // confirm that target_block_ is valid
 
@@ -142,11 +142,12 @@ void EnzoBfieldMethodCT::correct_reconstructed_bfield
   } else {
     // the interface bfield values held in *cur_bfieldi_l[dim] includes values
     // on the exterior faces of the block. We only need the values on the
-    // interior faces.
+    // interior faces (and only the z planes covered by l_map and r_map).
     EnzoPermutedCoordinates coord(dim);
     CSlice full_ax(nullptr,nullptr);
-    EFlt3DArray bfield = coord.get_subarray((*cur_bfieldi_l)[dim],
-                                            full_ax, full_ax, CSlice(1,-1));
+    EFlt3DArray bfield = coord.get_subarray
+      ((*cur_bfieldi_l)[dim].subarray(z_slc, full_ax, full_ax),
+       full_ax, full_ax, CSlice(1,-1));
 
     const std::string names[3] = {"bfield_x", "bfield_y", "bfield_z"};
     EFlt3DArray l_bfield = l_map.at(names[dim]);
@@ -168,7 +169,8 @@ void EnzoBfieldMethodCT::correct_reconstructed_bfield
 //----------------------------------------------------------------------
 
 void EnzoBfieldMethodCT::identify_upwind(const EnzoEFltArrayMap &flux_map,
-                                         int dim, int stale_depth) noexcept
+                                         int dim, int stale_depth,
+                                         const CSlice &z_slc) noexcept
 {
   require_registered_block_(); // confirm that target_block_ is valid
 
@@ -191,8 +193,10 @@ void EnzoBfieldMethodCT::identify_upwind(const EnzoEFltArrayMap &flux_map,
     CSlice stale_slc = (stale_depth > 0) ?
       CSlice(stale_depth,-stale_depth) : CSlice(nullptr, nullptr);
 
+    CSlice full_ax(nullptr, nullptr);
     const CelloView<enzo_float, 3> weight_field =
-      weight_l_[dim].subarray(stale_slc, stale_slc, stale_slc);
+      weight_l_[dim].subarray(z_slc, full_ax, full_ax)
+                    .subarray(stale_slc, stale_slc, stale_slc);
 
     // Iteration limits compatible with both 2D and 3D grids
     for (int iz=0; iz<density_flux.shape(0); iz++) {
@@ -41,9 +41,12 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
+  /// @param[in]     z_slc The range of z planes of the block that `l_map`
+  ///     and `r_map` cover.
   void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
                                     EnzoEFltArrayMap &r_map, int dim,
-                                    int stale_depth) noexcept;
+                                    int stale_depth,
+                                    const CSlice &z_slc) noexcept;
 
   /// identifies and stores the upwind direction
   ///
@@ -52,8 +55,10 @@ public: // interface
   /// @param[in] dim The dimension to identify the upwind direction along.
   /// @param[in] stale_depth The current staling depth. This should match the
   ///     staling depth used to compute the flux_group.
+  /// @param[in] z_slc The range of z planes of the block that `flux_map`
+  ///     covers.
   void identify_upwind(const EnzoEFltArrayMap &flux_map, int dim,
-                       int stale_depth) noexcept;
+                       int stale_depth, const CSlice &z_slc) noexcept;
 
   /// Updates all components of the face-centered and the cell-centered bfields
   ///
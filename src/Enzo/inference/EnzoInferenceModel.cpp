@@ -0,0 +1,194 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoInferenceModel.cpp
+/// @date     2026-10-17
+/// @brief    Implements the EnzoInferenceModel class
+
+#include "cello.hpp"
+#include "enzo.hpp"
+
+EnzoInferenceModel * EnzoInferenceModel::instance_[CONFIG_NODE_SIZE] = { };
+
+//----------------------------------------------------------------------
+
+EnzoInferenceModel::EnzoInferenceModel(std::string file_name)
+  : file_name_(file_name),
+    layers_(),
+    scratch_()
+{
+  FileHdf5 file ("./",file_name);
+  file.file_open();
+
+  int type = type_unknown;
+  int num_layers = 0;
+  file.file_read_meta(&num_layers,"num_layers",&type);
+
+  ASSERT2 ("EnzoInferenceModel::EnzoInferenceModel()",
+           "Model file %s has invalid num_layers %d",
+           file_name.c_str(),num_layers,
+           (num_layers > 0));
+
+  layers_.resize(num_layers);
+
+  for (int k=0; k<num_layers; k++) {
+    Layer & layer = layers_[k];
+    const std::string prefix = "layer_" + std::to_string(k);
+
+    int m1,m2;
+    read_dataset_ (file, prefix + "_weight", layer.weight, &m1, &m2);
+    layer.n_out = m1;
+    layer.n_in  = m2;
+
+    layer.activation = activation_linear;
+    file.data_open (prefix + "_weight", &type);
+    file.data_read_meta (&layer.activation, "activation", &type);
+    file.data_close();
+
+    read_dataset_ (file, prefix + "_bias", layer.bias, &m1, &m2);
+
+    ASSERT3 ("EnzoInferenceModel::EnzoInferenceModel()",
+             "Layer %d bias length %d does not match output size %d",
+             k,m1*m2,layer.n_out,
+             (m1*m2 == layer.n_out));
+    ASSERT3 ("EnzoInferenceModel::EnzoInferenceModel()",
+             "Layer %d input size %d does not match previous output size %d",
+             k,layer.n_in,(k>0) ? layers_[k-1].n_out : layer.n_in,
+             (k==0) || (layer.n_in == layers_[k-1].n_out));
+    ASSERT2 ("EnzoInferenceModel::EnzoInferenceModel()",
+             "Layer %d has unknown activation %d",
+             k,layer.activation,
+             (activation_linear <= layer.activation &&
+              layer.activation <= activation_sigmoid));
+  }
+
+  file.file_close();
+
+  int max_width = 0;
+  for (const Layer & layer : layers_) {
+    max_width = std::max(max_width,std::max(layer.n_in,layer.n_out));
+  }
+  scratch_[0].resize(chunk_size*max_width);
+  scratch_[1].resize(chunk_size*max_width);
+}
+
+//----------------------------------------------------------------------
+
+EnzoInferenceModel * EnzoInferenceModel::instance(std::string file_name)
+{
+  EnzoInferenceModel *& model = instance_[cello::index_static()];
+  if (model == nullptr || model->file_name_ != file_name) {
+    delete model;
+    model = new EnzoInferenceModel(file_name);
+  }
+  return model;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInferenceModel::evaluate
+(int n, const double * input, double * output)
+{
+  const int nl = layers_.size();
+  const int n_in  = num_inputs();
+  const int n_out = num_outputs();
+
+  for (int i0=0; i0<n; i0+=chunk_size) {
+    const int m = std::min(int(chunk_size),n-i0);
+
+    // pass the chunk through all layers, alternating scratch arrays,
+    // with the last layer writing directly to the output
+
+    const double * x = input + i0*n_in;
+    for (int k=0; k<nl; k++) {
+      double * y = (k == nl-1) ?
+        output + i0*n_out : scratch_[k%2].data();
+      apply_layer_(layers_[k],m,x,y);
+      x = y;
+    }
+  }
+}
+
+//======================================================================
+
+void EnzoInferenceModel::read_dataset_
+(FileHdf5 & file, std::string name,
+ std::vector<double> & values, int * m1, int * m2)
+{
+  int type = type_unknown;
+  file.data_open (name, &type, m1, m2);
+  const int n = (*m1)*(*m2);
+  values.resize(n);
+  if (type == type_double) {
+    file.data_read (values.data());
+  } else if (type == type_single) {
+    std::vector<float> buffer(n);
+    file.data_read (buffer.data());
+    std::copy_n(buffer.begin(),n,values.begin());
+  } else {
+    ERROR2 ("EnzoInferenceModel::read_dataset_()",
+            "Unsupported type %d for dataset %s",
+            type,name.c_str());
+  }
+  file.data_close();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoInferenceModel::apply_layer_
+(const Layer & layer, int n, const double * x, double * y)
+{
+  // y[i][j] = activation (b[j] + sum_k x[i][k] * w[j][k]), blocked so
+  // that a BI x BK block of x and a BJ x BK block of w stay in cache,
+  // and the inner k loop is a unit-stride dot product
+
+  const int BI = 64;
+  const int BJ = 32;
+  const int BK = 256;
+
+  const int n_in  = layer.n_in;
+  const int n_out = layer.n_out;
+  const double * w = layer.weight.data();
+  const double * b = layer.bias.data();
+
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<n_out; j++) {
+      y[i*n_out+j] = b[j];
+    }
+  }
+
+  for (int i0=0; i0<n; i0+=BI) {
+    const int i1 = std::min(i0+BI,n);
+    for (int j0=0; j0<n_out; j0+=BJ) {
+      const int j1 = std::min(j0+BJ,n_out);
+      for (int k0=0; k0<n_in; k0+=BK) {
+        const int k1 = std::min(k0+BK,n_in);
+        for (int i=i0; i<i1; i++) {
+          const double * xi = x + i*n_in;
+          for (int j=j0; j<j1; j++) {
+            const double * wj = w + j*n_in;
+            double sum = 0.0;
+            for (int k=k0; k<k1; k++) {
+              sum += xi[k]*wj[k];
+            }
+            y[i*n_out+j] += sum;
+          }
+        }
+      }
+    }
+  }
+
+  const int m = n*n_out;
+  switch (layer.activation) {
+  case activation_relu:
+    for (int i=0; i<m; i++) y[i] = std::max(y[i],0.0);
+    break;
+  case activation_tanh:
+    for (int i=0; i<m; i++) y[i] = tanh(y[i]);
+    break;
+  case activation_sigmoid:
+    for (int i=0; i<m; i++) y[i] = 1.0/(1.0+exp(-y[i]));
+    break;
+  case activation_linear:
+    break;
+  }
+}
@@ -0,0 +1,98 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoInferenceModel.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Declaration of the EnzoInferenceModel class
+
+#ifndef ENZO_INFERENCE_ENZO_INFERENCE_MODEL_HPP
+#define ENZO_INFERENCE_ENZO_INFERENCE_MODEL_HPP
+
+class EnzoInferenceModel {
+
+  /// @class    EnzoInferenceModel
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Feed-forward network of dense layers used
+  /// by EnzoLevelArray to evaluate a surrogate model on each cell
+  ///
+  /// The model is read from an HDF5 file containing an integer file
+  /// attribute "num_layers", and for each layer k a dataset
+  /// "layer_<k>_weight" of size n_out x n_in with an integer
+  /// attribute "activation" (see activation_enum), and a dataset
+  /// "layer_<k>_bias" of length n_out.  Inputs are evaluated in
+  /// chunks of rows, each layer being a cache-blocked matrix product.
+
+public: // interface
+
+  /// Activation functions applied after each layer
+  enum activation_enum {
+    activation_linear,
+    activation_relu,
+    activation_tanh,
+    activation_sigmoid
+  };
+
+  /// Number of input rows evaluated together through all layers
+  enum { chunk_size = 1024 };
+
+  /// Read the model from the given HDF5 file
+  EnzoInferenceModel(std::string file_name);
+
+  // No copy constructor or copy assignment:
+  EnzoInferenceModel(const EnzoInferenceModel&) = delete;
+  EnzoInferenceModel & operator= (const EnzoInferenceModel &) = delete;
+
+  /// Return the model read from file_name, reading it on first use
+  /// (one copy per PE)
+  static EnzoInferenceModel * instance(std::string file_name);
+
+  /// Number of values per input row
+  int num_inputs() const
+  { return layers_.empty() ? 0 : layers_.front().n_in; }
+
+  /// Number of values per output row
+  int num_outputs() const
+  { return layers_.empty() ? 0 : layers_.back().n_out; }
+
+  /// Number of layers
+  int num_layers() const { return layers_.size(); }
+
+  /// Evaluate the model on n rows: input is n x num_inputs() and
+  /// output is n x num_outputs(), both row-major
+  void evaluate (int n, const double * input, double * output);
+
+private: // types
+
+  struct Layer {
+    int n_in;
+    int n_out;
+    int activation;
+    std::vector<double> weight;
+    std::vector<double> bias;
+  };
+
+private: // functions
+
+  /// Read a single- or double-precision dataset into values
+  void read_dataset_ (FileHdf5 & file, std::string name,
+                      std::vector<double> & values, int * m1, int * m2);
+
+  /// Apply layer to n rows of x, storing the result in y
+  static void apply_layer_
+  (const Layer & layer, int n, const double * x, double * y);
+
+private: // attributes
+
+  /// File the model was read from
+  std::string file_name_;
+
+  /// Layers in order of evaluation
+  std::vector<Layer> layers_;
+
+  /// Scratch arrays for intermediate layer values
+  std::vector<double> scratch_[2];
+
+  /// Models read on each PE
+  static EnzoInferenceModel * instance_[CONFIG_NODE_SIZE];
+};
+
+#endif /* ENZO_INFERENCE_ENZO_INFERENCE_MODEL_HPP */
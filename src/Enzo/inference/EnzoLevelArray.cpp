@@ -8,6 +8,9 @@
 #include "cello.hpp"
 #include "enzo.hpp"
 
+int EnzoLevelArray::num_local_[CONFIG_NODE_SIZE] = { };
+std::vector<EnzoLevelArray *> EnzoLevelArray::batch_[CONFIG_NODE_SIZE];
+
 //----------------------------------------------------------------------
 
 EnzoLevelArray::EnzoLevelArray
@@ -57,11 +60,20 @@ EnzoLevelArray::EnzoLevelArray
   for (int i=0; i<num_fields_; i++) {
     field_values_[i].resize(nix_*niy_*niz_);
   }
+  ++num_local_[cello::index_static()];
   proxy_enzo_simulation[0].p_infer_array_created();
 }
 
 //----------------------------------------------------------------------
 
+EnzoLevelArray::EnzoLevelArray(CkMigrateMessage *m)
+  : CBase_EnzoLevelArray(m)
+{
+  ++num_local_[cello::index_static()];
+}
+
+//----------------------------------------------------------------------
+
 void EnzoLevelArray::pup (PUP::er &p)
 {
 
@@ -88,5 +100,7 @@ void EnzoLevelArray::pup (PUP::er &p)
 //----------------------------------------------------------------------
 
 EnzoLevelArray::~EnzoLevelArray()
-{ }
+{
+  --num_local_[cello::index_static()];
+}
 
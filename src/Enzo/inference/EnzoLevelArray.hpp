@@ -22,7 +22,7 @@ public: // interface
                  int nax, int nay=1, int naz=1);
   
   /// CHARM++ migration constructor
-  EnzoLevelArray(CkMigrateMessage *m) : CBase_EnzoLevelArray(m) {}
+  EnzoLevelArray(CkMigrateMessage *m);
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &);
@@ -43,6 +43,10 @@ public: // interface
   /// with EnzoSimulation[0] afterwards
   void apply_inference();
 
+  /// Return the number of inference arrays on this PE
+  static int num_local()
+  { return num_local_[cello::index_static()]; }
+
   /// Return the coordinates of the lower point of the inference array
   void lower (double lower[3])
   {
@@ -78,6 +82,14 @@ protected: // functions
   (      enzo_float * af, int mfx, int mfy, int mfz, int nfx, int nfy, int nfz,
    const enzo_float * ac, int mcx, int mcy, int mcz, int ncx, int ncy, int ncz);
 
+  /// Send the list of spheres found by inference to the blocks
+  /// overlapping this array
+  void update_blocks_ (std::vector<ObjectSphere> & sphere_list);
+
+  /// Evaluate the inference model on all arrays waiting in this PE's
+  /// batch as a single tensor, and update their blocks
+  static void apply_batch_inference_ ();
+
 private: // attributes
 
   /// AMR level of blocks associated with this array
@@ -112,6 +124,12 @@ private: // attributes
 
   /// List of spheres
   std::vector<ObjectSphere> spheres_;
+
+  /// Number of inference arrays on each PE
+  static int num_local_[CONFIG_NODE_SIZE];
+
+  /// Inference arrays on each PE waiting for batched inference
+  static std::vector<EnzoLevelArray *> batch_[CONFIG_NODE_SIZE];
 };
 
 #endif /* ENZO_IO_ENZO_LEVEL_ARRAY_HPP */
@@ -1012,13 +1012,22 @@ void EnzoLevelArray::apply_inference()
     fflush(stdout);
   }
 #endif
-  //==================================================
-  //
-  // ADD DEEP LEARNING INFERENCE HERE
-  //
-  //==================================================
+  const std::string model_file = enzo::config()->method_inference_model_file;
 
-  // Update blocks with inference results
+  if (model_file != "") {
+
+    // Defer to batched inference: the model is evaluated once all
+    // inference arrays on this PE have received their data
+
+    const int ip = cello::index_static();
+    batch_[ip].push_back(this);
+    if (int(batch_[ip].size()) == num_local_[ip]) {
+      apply_batch_inference_();
+    }
+    return;
+  }
+
+  // Without a model, update blocks with a placeholder result
 
   //    find center of inference array
   double center[3] = {
@@ -1032,6 +1041,109 @@ void EnzoLevelArray::apply_inference()
   std::vector<ObjectSphere> sphere_list;
   sphere_list.push_back(sphere);
 
+  update_blocks_(sphere_list);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoLevelArray::apply_batch_inference_()
+{
+  const int ip = cello::index_static();
+
+  std::vector<EnzoLevelArray *> batch;
+  batch.swap(batch_[ip]);
+
+  const EnzoConfig * enzo_config = enzo::config();
+  EnzoInferenceModel * model =
+    EnzoInferenceModel::instance(enzo_config->method_inference_model_file);
+
+  const int nf = batch[0]->num_fields_;
+  const int no = model->num_outputs();
+
+  ASSERT2 ("EnzoLevelArray::apply_batch_inference_()",
+           "Model input size %d differs from number of fields %d",
+           model->num_inputs(),nf,
+           (model->num_inputs() == nf));
+
+  // Gather cells of all arrays into a single (cells x fields) tensor
+
+  int num_cells = 0;
+  for (EnzoLevelArray * array : batch) {
+    num_cells += array->nix_*array->niy_*array->niz_;
+  }
+
+  Timer timer;
+  timer.start();
+
+  std::vector<double> input(size_t(num_cells)*nf);
+  std::vector<double> output(size_t(num_cells)*no);
+
+  int i0 = 0;
+  for (EnzoLevelArray * array : batch) {
+    const int n = array->nix_*array->niy_*array->niz_;
+    for (int i_f=0; i_f<nf; i_f++) {
+      const enzo_float * values = array->field_values_[i_f].data();
+      for (int i=0; i<n; i++) {
+        input[(i0+i)*nf + i_f] = values[i];
+      }
+    }
+    i0 += n;
+  }
+
+  model->evaluate(num_cells,input.data(),output.data());
+
+  timer.stop();
+
+  // Convert results to spheres: the first model output is the score
+  // of each cell, and a sphere is placed at the highest-scoring cell
+  // of each array if it exceeds Method:inference:model_threshold
+
+  const double threshold = enzo_config->method_inference_model_threshold;
+
+  i0 = 0;
+  for (EnzoLevelArray * array : batch) {
+    const int nx = array->nix_;
+    const int ny = array->niy_;
+    const int nz = array->niz_;
+    const int n = nx*ny*nz;
+
+    int i_max = 0;
+    for (int i=1; i<n; i++) {
+      if (output[(i0+i)*no] > output[(i0+i_max)*no]) i_max = i;
+    }
+
+    std::vector<ObjectSphere> sphere_list;
+    if (output[(i0+i_max)*no] >= threshold) {
+      double lower[3],upper[3];
+      array->lower(lower);
+      array->upper(upper);
+      const int ix = i_max % nx;
+      const int iy = (i_max / nx) % ny;
+      const int iz = i_max / (nx*ny);
+      double center[3] = {
+        lower[0] + (ix+0.5)*(upper[0]-lower[0])/nx,
+        lower[1] + (iy+0.5)*(upper[1]-lower[1])/ny,
+        lower[2] + (iz+0.5)*(upper[2]-lower[2])/nz};
+      double radius = 0.1*(upper[0]-lower[0]);
+      sphere_list.push_back(ObjectSphere(center,radius));
+    }
+
+    array->update_blocks_(sphere_list);
+
+    i0 += n;
+  }
+
+  const double time = timer.value();
+  cello::monitor()->print
+    ("Method", "inference batch %d arrays %d cells time %g s (%g arrays/s)",
+     int(batch.size()), num_cells, time,
+     (time > 0.0) ? batch.size()/time : 0.0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoLevelArray::update_blocks_(std::vector<ObjectSphere> & sphere_list)
+{
 #ifdef TRACE_INFER
   for (auto sphere : sphere_list) {
     char buffer[80];
@@ -1056,6 +1168,9 @@ void EnzoLevelArray::apply_inference()
   enzo::block_array()[index_block].p_method_infer_update(n,buffer,il3);
 
 #ifdef TRACE_INFER
+  double lower[3],upper[3];
+  this->lower(lower);
+  this->upper(upper);
   CkPrintf ("TRACE_INFER rectangle %d %g %g %g %g %g %g\n",
             cello::simulation()->cycle(),
             lower[0],lower[1],lower[2],
@@ -7,6 +7,7 @@
 
 #include "Cello/cello.hpp"
 #include <charm.hpp>
+#include "Cello/charm_simulation.hpp"
 #include "Enzo/enzo.hpp"
 #include "Enzo/charm_enzo.hpp"
 #include "Enzo/io/io.hpp"
@@ -118,6 +119,19 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
   check_ordering_   = enzo::config()->method_check_ordering;
   check_directory_  = enzo::config()->method_check_dir;
 
+  if (check_async_active_) {
+    // Previous asynchronous checkpoint is still being written: Blocks
+    // wait in EnzoMethodCheck until it completes
+    check_async_pending_ = true;
+  } else {
+    check_start_();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::check_start_()
+{
   /// Initialize synchronization counters
   sync_check_done_.          set_stop(check_num_files_);
 
@@ -151,8 +165,16 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
     }
     stream_file_list.flush();
 
-    enzo::block_array().p_check_write_first
-      (check_num_files_, check_ordering_, name_dir);
+    if (enzo::config()->method_check_async) {
+      // Open writer files first so that hierarchy meta data is
+      // written before Blocks continue to the next cycle
+      check_async_active_ = true;
+      check_name_dir_ = name_dir;
+      proxy_io_enzo_writer.p_check_open(name_dir);
+    } else {
+      enzo::block_array().p_check_write_first
+        (check_num_files_, check_ordering_, name_dir);
+    }
   }
   // Create IoEnzoWriter array. Synchronizes by calling
   // EnzoSimulation[0]::p_writer_created() when done
@@ -161,6 +183,60 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
 
 //----------------------------------------------------------------------
 
+void EnzoSimulation::r_check_opened(CkReductionMsg *msg)
+// [ Called on ip=0 only ]
+{
+  TRACE_CHECK("[3a] EnzoSimulation::r_check_opened()");
+
+  delete msg;
+
+  enzo::block_array().p_check_write_first
+    (check_num_files_, check_ordering_, check_name_dir_);
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoSimulation::check_stage
+(Index index, long long bytes, std::string name_dir)
+{
+  const long long bytes_limit =
+    (long long)(enzo::config()->method_check_async_mb*1024*1024);
+
+  // Always accept at least one Block so that writing progresses
+  if (check_staged_bytes_ > 0 && check_staged_bytes_ + bytes > bytes_limit) {
+    check_deferred_.push_back({index,name_dir});
+    return false;
+  }
+  check_staged_bytes_ += bytes;
+  check_staged_[index] = bytes;
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::p_check_unstage(Index index)
+{
+  TRACE_CHECK("[B1] EnzoSimulation::p_check_unstage()");
+  auto it = check_staged_.find(index);
+  if (it != check_staged_.end()) {
+    check_staged_bytes_ -= it->second;
+    check_staged_.erase(it);
+  }
+
+  // Retry the next deferred Block; it defers itself again if it
+  // still does not fit
+  if (! check_deferred_.empty()) {
+    const auto deferred = check_deferred_.front();
+    check_deferred_.erase(check_deferred_.begin());
+    enzo::block_array()[deferred.first].p_check_write_first
+      (enzo::config()->method_check_num_files,
+       enzo::config()->method_check_ordering,
+       deferred.second);
+  }
+}
+
+//----------------------------------------------------------------------
+
 IoEnzoWriter::IoEnzoWriter
 (int num_files,
  std::string ordering,
@@ -170,7 +246,13 @@ IoEnzoWriter::IoEnzoWriter
     num_files_(num_files),
     ordering_(ordering),
     monitor_iter_(monitor_iter),
-    include_ghosts_(include_ghosts)
+    include_ghosts_(include_ghosts),
+    async_index_first_(-1),
+    async_index_last_(-1),
+    async_count_(0),
+    aggregate_blocks_(0),
+    aggregate_first_(0),
+    aggregate_offsets_()
 {
   TRACE_CHECK("[4] IoEnzoWriter::IoEnzoWriter()");
 }
@@ -182,6 +264,36 @@ void EnzoBlock::p_check_write_first
 {
   TRACE_CHECK_BLOCK("[8] EnzoBlock::p_check_write_first",this);
 
+  if (enzo::config()->method_check_async) {
+
+    // Reserve staging memory, or wait in EnzoMethodCheck until
+    // enough staged data has been written
+
+    const long long bytes =
+      data()->field_data()->permanent_size() +
+      data()->particle_data()->data_size(cello::particle_descr());
+    if (! enzo::simulation()->check_stage(index(),bytes,name_dir)) return;
+
+    EnzoMsgCheck * msg_check;
+    bool is_first (false);
+    const int index_file = create_msg_check_
+      (&msg_check,num_files,ordering,name_dir,&is_first);
+
+    // The Block may migrate before its data is written, so the writer
+    // releases the staging memory on this process rather than the
+    // Block's process at that time
+    msg_check->set_ip_stage(CkMyPe());
+
+    // Serialize the message now so that it holds a copy of the Block
+    // data rather than references to it, then continue to the next
+    // cycle while the writer drains it
+    msg_check = EnzoMsgCheck::unpack(EnzoMsgCheck::pack(msg_check));
+    proxy_io_enzo_writer[index_file].p_write_async (msg_check);
+
+    compute_done();
+    return;
+  }
+
   EnzoMsgCheck * msg_check;
   bool is_first (false);
   const int index_file = create_msg_check_
@@ -231,23 +343,7 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
   // Write to block list file, opening or closing file as needed
 
   if (is_first) {
-
-    // Create HDF5 file
-
-    std::stringstream stream_block_list;
-    stream_block_list << std::setfill('0');
-    int max_digits = log(num_files_-1)/log(10) + 1;
-    stream_block_list << "block_data-" << std::setw(max_digits) << thisIndex;
-
-    // Create block list
-    stream_block_list_ = create_block_list_
-      (name_dir,stream_block_list.str()+".block_list");
-
-    std::string name_file = stream_block_list.str() + ".h5";
-    file_ = file_open_(name_dir,name_file);
-
-    // Write HDF5 header meta data
-    file_write_hierarchy_();
+    open_files_(name_dir);
   }
 
   // Write block list
@@ -259,10 +355,7 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
   delete msg_check;
 
   if (is_last) {
-    // close block list
-    close_block_list_();
-    // close HDF5 file
-    file_->file_close();
+    close_files_();
   }
 
   if (!is_last) {
@@ -274,6 +367,112 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
 
 //----------------------------------------------------------------------
 
+void IoEnzoWriter::p_check_open (std::string name_dir)
+{
+  TRACE_CHECK("[A0] IoEnzoWriter::p_check_open");
+
+  async_index_first_ = -1;
+  async_index_last_  = -1;
+  async_count_       = 0;
+
+  open_files_(name_dir);
+
+  CkCallback callback(CkIndex_EnzoSimulation::r_check_opened(NULL),0,
+                      proxy_enzo_simulation);
+  contribute(callback);
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::p_write_async (EnzoMsgCheck * msg_check)
+{
+  TRACE_CHECK("[A1] IoEnzoWriter::p_write_async");
+  std::string name_this, name_next;
+  Index index_this, index_next;
+  long long index_block;
+  bool is_first, is_last;
+  std::string name_dir;
+
+  msg_check->get_parameters
+    (index_this,index_next,name_this,name_next,
+     index_block,is_first,is_last,name_dir);
+
+  if (thisIndex == 0 && monitor_iter_ &&
+      ((is_first || is_last) || ((index_block % monitor_iter_) == 0))) {
+    cello::monitor()->print("Method", "check %d",index_block);
+  }
+
+  // Blocks arrive in any order: the first and last Blocks of the
+  // file determine how many to expect
+
+  if (is_first) async_index_first_ = index_block;
+  if (is_last)  async_index_last_  = index_block;
+
+  write_block_list_(name_this, msg_check->block_level());
+
+  file_write_block_(msg_check);
+
+  const int ip_stage = msg_check->ip_stage();
+
+  delete msg_check;
+
+  ++async_count_;
+
+  // Release the Block's staging memory
+  proxy_enzo_simulation[ip_stage].p_check_unstage(index_this);
+
+  if (async_index_first_ >= 0 && async_index_last_ >= 0 &&
+      async_count_ == async_index_last_ - async_index_first_ + 1) {
+    close_files_();
+    proxy_enzo_simulation[0].p_check_done();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::open_files_ (std::string name_dir)
+{
+  // Create HDF5 file
+
+  std::stringstream stream_block_list;
+  stream_block_list << std::setfill('0');
+  int max_digits = log(num_files_-1)/log(10) + 1;
+  stream_block_list << "block_data-" << std::setw(max_digits) << thisIndex;
+
+  // Create block list
+  stream_block_list_ = create_block_list_
+    (name_dir,stream_block_list.str()+".block_list");
+
+  std::string name_file = stream_block_list.str() + ".h5";
+  file_ = file_open_(name_dir,name_file);
+
+  aggregate_blocks_ = 0;
+  aggregate_offsets_.clear();
+
+  // Write HDF5 header meta data
+  file_write_hierarchy_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::close_files_ ()
+{
+  close_block_list_();
+
+  if (! aggregate_offsets_.empty()) {
+    // Write the slot of each Block in block_list order
+    const int nb = aggregate_offsets_.size();
+    file_->mem_create(nb,1,1,nb,1,1,0,0,0);
+    file_->data_create("block_offset",type_int,nb,1,1,1,nb,1,1,1);
+    file_->data_write(aggregate_offsets_.data());
+    file_->data_close();
+  }
+
+  file_->file_close();
+}
+
+//----------------------------------------------------------------------
+
 std::ofstream IoEnzoWriter::create_block_list_(std::string name_dir, std::string name_file)
 {
   std::ofstream stream_block_list (name_dir + "/" + name_file);
@@ -305,8 +504,37 @@ void EnzoSimulation::p_check_done()
 {
   TRACE_CHECK("[B] EnzoSimulation::p_check_done()");
   if (sync_check_done_.next()) {
-    enzo::block_array().p_check_done();
+    if (check_async_active_) {
+      // Blocks have already continued: start any checkpoint that
+      // was waiting for this one
+      check_async_active_ = false;
+      cello::monitor()->print
+        ("Method", "check written to %s",check_name_dir_.c_str());
+      if (check_async_pending_) {
+        check_async_pending_ = false;
+        check_start_();
+      } else if (check_exit_pending_) {
+        check_exit_pending_ = false;
+        proxy_main.p_exit_continue();
+      }
+    } else {
+      enzo::block_array().p_check_done();
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoSimulation::check_exit_defer()
+// [ Called on ip=0 only ]
+{
+  if (check_async_active_) {
+    cello::monitor()->print
+      ("Method", "waiting for check to %s before exiting",
+       check_name_dir_.c_str());
+    check_exit_pending_ = true;
   }
+  return check_async_active_;
 }
 
 //----------------------------------------------------------------------
@@ -374,6 +602,8 @@ int EnzoBlock::create_msg_check_
     (index_this,index_next,name_this,name_next,
      index_block,is_first?(*is_first):false,is_last);
 
+  (*msg_check)->set_count_block (count);
+
   (*msg_check)->set_name_dir (name_dir);
 
   (*msg_check)->set_adapt(adapt_);
@@ -486,6 +716,14 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
   double * upper = msg_check->block_upper();
   int * size     = msg_check->block_size();
 
+  // Find the Block's slot in the file's aggregated field datasets
+
+  const bool aggregate =
+    (enzo::config()->method_check_layout == "aggregate");
+  const bool aggregate_new = aggregate && aggregate_offsets_.empty();
+  const int aggregate_offset = aggregate ?
+    aggregate_slot_(block_order,msg_check->count_block()) : -1;
+
   // Create file group for block
 
   std::string group_name = "/" + name_block;
@@ -502,6 +740,11 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
   file_->group_write_meta
     (msg_check->adapt_buffer_,"adapt_buffer",type_int,ADAPT_BUFFER_SIZE);
 
+  if (aggregate) {
+    file_->group_write_meta
+      (&aggregate_offset,"aggregate_offset",type_int);
+  }
+
   // Create new data object to hold EnzoMsgCheck/DataMsg fields and particles
 
   Data * data;
@@ -547,7 +790,10 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
           (&buffer, &name, &type, &mx,&my,&mz, &nx,&ny,&nz);
 
         file_->mem_create(mx,my,mz,nx,ny,nz,0,0,0);
-        if (mz > 1) {
+        if (aggregate) {
+          file_write_field_aggregate_
+            (name,type,nx,ny,nz,aggregate_offset,aggregate_new);
+        } else if (mz > 1) {
           file_->data_create(name.c_str(),type,nz,ny,nx,1,nz,ny,nx,1);
         } else if (my > 1) {
           file_->data_create(name.c_str(),type,ny,nx,  1,1,ny,nx, 1,1);
@@ -637,6 +883,71 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
 
 //----------------------------------------------------------------------
 
+int IoEnzoWriter::aggregate_slot_ (long long index_block, long long count_block)
+{
+  if (aggregate_offsets_.empty()) {
+    // First Block written to this file: the file holds the Blocks
+    // with index ib where ib*nf/nb == thisIndex (see
+    // EnzoBlock::create_msg_check_())
+    const long long nb = count_block;
+    const long long nf = num_files_;
+    const long long f  = thisIndex;
+    aggregate_first_  = (f*nb + nf - 1) / nf;
+    aggregate_blocks_ = ((f+1)*nb + nf - 1) / nf - aggregate_first_;
+    file_->file_write_meta(&aggregate_blocks_,"aggregate_blocks",type_int);
+  }
+
+  const int slot = index_block - aggregate_first_;
+
+  ASSERT3 ("IoEnzoWriter::aggregate_slot_()",
+           "Block index %lld is outside file range [%lld,%lld)",
+           index_block,aggregate_first_,
+           aggregate_first_ + aggregate_blocks_,
+           (0 <= slot && slot < aggregate_blocks_));
+
+  aggregate_offsets_.push_back(slot);
+  return slot;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::file_write_field_aggregate_
+(std::string name, int type, int nx, int ny, int nz,
+ int slot, bool is_new)
+{
+  // Block array dimensions in the same (reversed) order as the
+  // "block" layout, preceded by the slot axis
+
+  const int rank = cello::rank();
+  int n3[3] = {nx,1,1};
+  if (rank >= 3) {
+    n3[0] = nz; n3[1] = ny; n3[2] = nx;
+  } else if (rank == 2) {
+    n3[0] = ny; n3[1] = nx;
+  }
+
+  // Absolute name so the dataset is shared by all Block groups
+  const std::string name_aggregate = "/" + name;
+  const int nb = aggregate_blocks_;
+
+  if (is_new) {
+    file_->data_create
+      (name_aggregate,type,
+       nb,n3[0],n3[1],n3[2],
+       1, n3[0],n3[1],n3[2],
+       slot,0,0,0);
+  } else {
+    int type_data;
+    file_->data_open (name_aggregate,&type_data);
+    file_->data_slice
+      (nb,n3[0],n3[1],n3[2],
+       1, n3[0],n3[1],n3[2],
+       slot,0,0,0);
+  }
+}
+
+//----------------------------------------------------------------------
+
 DataMsg * EnzoBlock::create_data_msg_ ()
 {
   int if3[3] = {0,0,0};
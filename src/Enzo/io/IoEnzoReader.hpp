@@ -60,8 +60,22 @@ protected: // functions
   void block_created_();
 
   void file_open_block_list_(std::string name_dir, std::string name_file);
-  void file_read_block_(EnzoMsgCheck * msg_check, std::string file_name);
-  void file_read_block_fields_(DataMsg * data_msg, int nx, int ny, int nz);
+  void file_read_block_(EnzoMsgCheck * msg_check, std::string file_name,
+                        int index_list);
+  /// Read Block fields, copying from the aggregated field data if
+  /// slot >= 0
+  void file_read_block_fields_
+  (DataMsg * data_msg, int nx, int ny, int nz, int slot);
+  /// Read the Block slot table if the file uses the aggregate layout
+  void file_read_block_offsets_();
+  /// Aggregate layout: read all permanent fields for the slots
+  /// holding Blocks in the given level
+  void file_read_aggregate_(int level);
+  /// Aggregate layout: copy a Block's field values from the slots read
+  void copy_field_aggregate_
+  (char * values, int i_f, int slot,
+   int mx, int my, int mz,
+   int gx, int gy, int gz);
   void file_read_block_particles_(DataMsg * data_msg);
   bool read_block_list_(std::string & block_name, int & level);
   void file_close_block_list_();
@@ -106,6 +120,19 @@ private: // attributes
 
   /// Count of blocks in each level_
   std::vector<int> blocks_in_level_;
+
+  /// Aggregate layout: number of Block slots in the file (0 for the
+  /// "block" layout) and slot of each Block in block_name_list_
+  int aggregate_blocks_;
+  std::vector<int> block_offset_list_;
+
+  /// Aggregate layout: position in the values read for the current
+  /// level of each slot (-1 if not read), and the values, type, and
+  /// cells per Block of each permanent field
+  std::vector<int> aggregate_position_;
+  std::vector< std::vector<char> > aggregate_field_;
+  std::vector<int> aggregate_type_;
+  std::vector<int> aggregate_cells_;
 };
 
 #endif /* ENZO_IO_ENZO_READER_HPP */
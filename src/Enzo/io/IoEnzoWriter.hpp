@@ -23,7 +23,13 @@ public: // interface
     stream_block_list_(),
     file_(nullptr),
     monitor_iter_(0),
-    include_ghosts_(false)
+    include_ghosts_(false),
+    async_index_first_(-1),
+    async_index_last_(-1),
+    async_count_(0),
+    aggregate_blocks_(0),
+    aggregate_first_(0),
+    aggregate_offsets_()
   {  }
 
   /// Constructor
@@ -33,7 +39,15 @@ public: // interface
                bool include_ghosts) throw();
 
   /// CHARM++ migration constructor
-  IoEnzoWriter(CkMigrateMessage *m) : CBase_IoEnzoWriter(m) {}
+  IoEnzoWriter(CkMigrateMessage *m)
+    : CBase_IoEnzoWriter(m),
+      async_index_first_(-1),
+      async_index_last_(-1),
+      async_count_(0),
+      aggregate_blocks_(0),
+      aggregate_first_(0),
+      aggregate_offsets_()
+  {}
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p)
@@ -50,14 +64,35 @@ public: // entry methods
 
   void p_write(EnzoMsgCheck *);
 
+  /// Asynchronous checkpoint: create this writer's files and write
+  /// the hierarchy meta data before any Block data is staged
+  void p_check_open(std::string name_dir);
+
+  /// Asynchronous checkpoint: write a staged Block in whatever order
+  /// Blocks arrive, closing the file once all its Blocks are written
+  void p_write_async(EnzoMsgCheck *);
+
   // void r_created(CkReductionMsg *msg);
 
 protected: // functions
 
   FileHdf5 * file_open_(std::string name_dir, std::string name_file);
+  /// Create the block list and HDF5 file and write hierarchy meta data
+  void open_files_(std::string name_dir);
+  /// Close the block list and HDF5 file, writing the block offset
+  /// table first if the aggregate layout is used
+  void close_files_();
   std::ofstream create_block_list_(std::string name_dir, std::string name_file);
   void file_write_hierarchy_();
   void file_write_block_(EnzoMsgCheck * msg_check);
+  /// Aggregate layout: return the Block's slot in the file's field
+  /// datasets, sizing them on the first Block written to the file
+  int aggregate_slot_(long long index_block, long long count_block);
+  /// Aggregate layout: create or open the field's dataset and select
+  /// the Block's slot for writing
+  void file_write_field_aggregate_
+  (std::string name, int type, int nx, int ny, int nz,
+   int slot, bool is_new);
   void write_meta_ ( FileHdf5 * file, Io * io, std::string type_meta );
 
   void write_block_list_(std::string block_name, int level);
@@ -83,6 +118,19 @@ protected: // attributes
 
   /// Whether to include ghost zones
   bool include_ghosts_;
+
+  /// Asynchronous checkpoint: order index of this file's first and
+  /// last Blocks (-1 until known), and number of Blocks written
+  long long async_index_first_;
+  long long async_index_last_;
+  long long async_count_;
+
+  /// Aggregate layout: number of Block slots in the file's field
+  /// datasets, ordering index of slot 0, and slot of each Block
+  /// written in block_list order
+  int aggregate_blocks_;
+  long long aggregate_first_;
+  std::vector<int> aggregate_offsets_;
 };
 
 #endif /* ENZO_IO_ENZO_WRITER_HPP */
@@ -160,7 +160,13 @@ IoEnzoReader::IoEnzoReader()
     level_(0),
     block_name_list_(),
     block_level_list_(),
-    blocks_in_level_()
+    blocks_in_level_(),
+    aggregate_blocks_(0),
+    block_offset_list_(),
+    aggregate_position_(),
+    aggregate_field_(),
+    aggregate_type_(),
+    aggregate_cells_()
 {
   proxy_enzo_simulation[0].p_io_reader_created();
 }
@@ -254,6 +260,9 @@ void IoEnzoReader::p_init_root
     }
   }
 
+  // Read the Block slots if fields use the aggregate layout
+  file_read_block_offsets_();
+
   // Allocate io_msg_check_ array
   io_msg_check_.resize(max_level+1);
   for (int level=1; level<=max_level; level++) {
@@ -265,6 +274,8 @@ void IoEnzoReader::p_init_root
   level_index.resize(max_level+1);
   std::fill(level_index.begin(), level_index.end(), 0);
 
+  file_read_aggregate_(0);
+
   // Save block's meta-data and initialize root-level blocks
   for (int i=0; i<block_name_list_.size(); i++) {
 
@@ -289,7 +300,7 @@ void IoEnzoReader::p_init_root
 
     msg_check->set_io_block(io_enzo_block);
     if (block_level <= 0) {
-      file_read_block_ (msg_check, block_name);
+      file_read_block_ (msg_check, block_name, i);
     }
 
     // save this file IoReader index
@@ -314,6 +325,8 @@ void IoEnzoReader::p_init_root
     }
   }
 
+  aggregate_field_.clear();
+
   // self + 1
   ++ sync_blocks_;
   block_ready_();
@@ -387,6 +400,7 @@ void IoEnzoReader::p_create_level (int level)
   const int num_blocks_level = io_msg_check_[level].size();
   sync_blocks_.reset();
   sync_blocks_.set_stop(num_blocks_level+1);
+  file_read_aggregate_(level);
   int i=0;
   for (int k=0; k<block_name_list_.size(); k++) {
     // skip over blocks not in current level
@@ -397,7 +411,7 @@ void IoEnzoReader::p_create_level (int level)
     msg_check->set_io_block (io_enzo_block);
 
     std::string block_name = block_name_list_[k];
-    file_read_block_ (msg_check, block_name);
+    file_read_block_ (msg_check, block_name, k);
 
     IoEnzoBlock * io_block = io_msg_check_[level][i]->io_block();
     int i3[3];
@@ -416,6 +430,7 @@ void IoEnzoReader::p_create_level (int level)
 
     i++;
   }
+  aggregate_field_.clear();
   // self
   block_created_();
 }
@@ -624,7 +639,8 @@ void IoEnzoReader::file_read_hierarchy_()
 
 void IoEnzoReader::file_read_block_
 (EnzoMsgCheck * msg_check,
- std::string    name_block)
+ std::string    name_block,
+ int            index_list)
 {
   // Open HDF5 group for the block
   std::string group_name = "/" + name_block;
@@ -657,7 +673,10 @@ void IoEnzoReader::file_read_block_
 
   file_read_block_particles_(data_msg);
 
-  file_read_block_fields_ (data_msg,nx,ny,nz);
+  const int slot = (aggregate_blocks_ > 0) ?
+    block_offset_list_[index_list] : -1;
+
+  file_read_block_fields_ (data_msg,nx,ny,nz,slot);
 
   file_->group_close();
 }
@@ -665,7 +684,7 @@ void IoEnzoReader::file_read_block_
 //----------------------------------------------------------------------
 
 void IoEnzoReader::file_read_block_fields_
-(DataMsg * data_msg, int nx, int ny, int nz)
+(DataMsg * data_msg, int nx, int ny, int nz, int slot)
 {
   FieldDescr * field_descr = cello::field_descr();
   // Initialize field data
@@ -695,11 +714,6 @@ void IoEnzoReader::file_read_block_fields_
     const std::string field_name = field_descr->field_name(i_f);
     int index_field = field_descr->field_id(field_name);
 
-    const std::string dataset_name = std::string("field_") + field_name;
-    int m4[4];
-    int type_data = type_unknown;
-    file_->data_open (dataset_name, &type_data,
-                      m4,m4+1,m4+2,m4+3);
     int mx,my,mz;
     int gx,gy,gz;
 
@@ -708,6 +722,17 @@ void IoEnzoReader::file_read_block_fields_
 
     char * buffer = field.values(field_name);
 
+    if (slot >= 0) {
+      copy_field_aggregate_(buffer,i_f,slot,mx,my,mz,gx,gy,gz);
+      continue;
+    }
+
+    const std::string dataset_name = std::string("field_") + field_name;
+    int m4[4];
+    int type_data = type_unknown;
+    file_->data_open (dataset_name, &type_data,
+                      m4,m4+1,m4+2,m4+3);
+
     file_read_dataset_
       (buffer, type_data, mx,my,mz,m4);
 
@@ -718,6 +743,166 @@ void IoEnzoReader::file_read_block_fields_
 
 //----------------------------------------------------------------------
 
+void IoEnzoReader::file_read_block_offsets_()
+{
+  aggregate_blocks_ = 0;
+  block_offset_list_.clear();
+
+  // Files written with the "block" layout have no aggregate_blocks
+  if (! file_->file_meta_exists("aggregate_blocks")) return;
+
+  int type = type_unknown;
+  file_->file_read_meta(&aggregate_blocks_,"aggregate_blocks",&type);
+
+  int nb;
+  file_->data_open ("block_offset",&type,&nb);
+
+  ASSERT2 ("IoEnzoReader::file_read_block_offsets_()",
+           "block_offset length %d differs from block_list length %d",
+           nb,int(block_name_list_.size()),
+           (nb == int(block_name_list_.size())));
+
+  block_offset_list_.resize(nb);
+  file_->mem_create(nb,1,1,nb,1,1,0,0,0);
+  file_->data_read(block_offset_list_.data());
+  file_->data_close();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::file_read_aggregate_(int level)
+{
+  aggregate_field_.clear();
+
+  if (aggregate_blocks_ == 0) return;
+
+  // Find the slots holding the level's Blocks (level 0 includes
+  // negative levels).  Slots follow the Block ordering, which
+  // interleaves levels, so only these slots are read rather than
+  // the whole range between them
+
+  std::vector<int> slots;
+  for (int k=0; k<block_name_list_.size(); k++) {
+    const int block_level = block_level_list_[k];
+    if ((level == 0) ? (block_level <= 0) : (block_level == level)) {
+      slots.push_back(block_offset_list_[k]);
+    }
+  }
+  if (slots.empty()) return;
+
+  std::sort(slots.begin(),slots.end());
+  slots.erase(std::unique(slots.begin(),slots.end()),slots.end());
+
+  const int ns = slots.size();
+  aggregate_position_.assign(aggregate_blocks_,-1);
+  for (int i=0; i<ns; i++) aggregate_position_[slots[i]] = i;
+
+  // Split the slots into runs of consecutive slots, each read with
+  // a single hyperslab
+
+  std::vector<int> run_first, run_count;
+  for (int i=0; i<ns; i++) {
+    if (i > 0 && slots[i] == slots[i-1] + 1) {
+      ++ run_count.back();
+    } else {
+      run_first.push_back(slots[i]);
+      run_count.push_back(1);
+    }
+  }
+  const int num_runs = run_first.size();
+
+  FieldDescr * field_descr = cello::field_descr();
+  const int num_fields = field_descr->num_permanent();
+
+  aggregate_field_.resize(num_fields);
+  aggregate_type_.resize(num_fields);
+  aggregate_cells_.resize(num_fields);
+
+  for (int i_f=0; i_f<num_fields; i_f++) {
+
+    const std::string dataset_name =
+      std::string("/field_") + field_descr->field_name(i_f);
+    int m4[4];
+    int type_data = type_unknown;
+    file_->data_open (dataset_name, &type_data,
+                      m4,m4+1,m4+2,m4+3);
+
+    const int cells = m4[1]*m4[2]*m4[3];
+    const int n = ns*cells;
+
+    const size_t bytes = cello::type_bytes[type_data];
+
+    aggregate_type_[i_f]  = type_data;
+    aggregate_cells_[i_f] = cells;
+    aggregate_field_[i_f].resize(size_t(n)*bytes);
+
+    char * buffer = aggregate_field_[i_f].data();
+    for (int i_run=0; i_run<num_runs; i_run++) {
+      const int n_run = run_count[i_run]*cells;
+      file_->data_slice
+        (m4[0],           m4[1],m4[2],m4[3],
+         run_count[i_run], m4[1],m4[2],m4[3],
+         run_first[i_run], 0,0,0);
+      file_->mem_create (n_run,1,1,n_run,1,1,0,0,0);
+      file_->data_read (buffer);
+      buffer += size_t(n_run)*bytes;
+    }
+    file_->data_close();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::copy_field_aggregate_
+(char * values, int i_f, int slot,
+ int mx, int my, int mz,
+ int gx, int gy, int gz)
+{
+  const int bytes = cello::type_bytes[aggregate_type_[i_f]];
+  const int cells = aggregate_cells_[i_f];
+  const int position = aggregate_position_[slot];
+
+  ASSERT1 ("IoEnzoReader::copy_field_aggregate_()",
+           "Slot %d was not read for the current level",
+           slot, (position >= 0));
+
+  // Values are copied as raw bytes, so the stored type must match the
+  // field's type
+  const int type_field = cello::field_descr()->data_type(i_f);
+  ASSERT3 ("IoEnzoReader::copy_field_aggregate_()",
+           "Stored type %s of field %s does not match its type %s",
+           cello::type_name[aggregate_type_[i_f]],
+           cello::field_descr()->field_name(i_f).c_str(),
+           cello::type_name[type_field],
+           (aggregate_type_[i_f] == type_field));
+
+  const char * block = aggregate_field_[i_f].data()
+    + size_t(position)*cells*bytes;
+
+  if (cells == mx*my*mz) {
+    // include_ghosts = true
+    std::copy_n (block, size_t(cells)*bytes, values);
+  } else {
+    // include_ghosts = false
+    const int nx = mx - 2*gx;
+    const int ny = my - 2*gy;
+    const int nz = mz - 2*gz;
+    ASSERT4 ("IoEnzoReader::copy_field_aggregate_()",
+             "Stored block size %d does not match field size %d x %d x %d",
+             cells,nx,ny,nz,
+             (cells == nx*ny*nz));
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        const size_t i_src = size_t(nx)*(iy + ny*iz);
+        const size_t i_dst = gx + size_t(mx)*((iy+gy) + size_t(my)*(iz+gz));
+        std::copy_n (block + i_src*bytes, nx*bytes, values + i_dst*bytes);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void IoEnzoReader::file_read_block_particles_ (DataMsg * data_msg)
 {
   ParticleDescr * particle_descr = cello::particle_descr();
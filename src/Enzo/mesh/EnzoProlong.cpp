@@ -63,13 +63,29 @@ void EnzoProlong::apply
   void *       values_f, int m3_f[3], int o3_f[3], int n3_f[3],
   const void * values_c, int m3_c[3], int o3_c[3], int n3_c[3],
   bool accumulate)
+{
+  apply_list (precision, 1,
+              &values_f, m3_f, o3_f, n3_f,
+              &values_c, m3_c, o3_c, n3_c,
+              accumulate);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoProlong::apply_list
+( precision_type precision, int num_fields,
+  void *       const * values_f, int m3_f[3], int o3_f[3], int n3_f[3],
+  const void * const * values_c, int m3_c[3], int o3_c[3], int n3_c[3],
+  bool accumulate)
 {
   if (!accumulate) {
     // only call EnzoProlong if accumulate = false
     if (!use_linear_) {
       // only call EnzoProlong if not reverting to linear
-      apply_((enzo_float *)     values_f,m3_f,o3_f,n3_f,
-             (const enzo_float*)values_c,m3_c,o3_c,n3_c,accumulate);
+      apply_(num_fields,
+             (enzo_float *       const *) values_f,m3_f,o3_f,n3_f,
+             (const enzo_float * const *) values_c,m3_c,o3_c,n3_c,
+             accumulate);
     }  else {
       static bool first_call = true;
       if (first_call) {
@@ -81,8 +97,8 @@ void EnzoProlong::apply
         n3_c[i]-=2;
         o3_c[i]+=1;
       }
-      prolong_linear.apply
-        (precision,
+      prolong_linear.apply_list
+        (precision, num_fields,
          values_f,m3_f,o3_f,n3_f,
          values_c,m3_c,o3_c,n3_c,accumulate);
       for (int i=0; i<cello::rank(); i++) {
@@ -100,8 +116,8 @@ void EnzoProlong::apply
     }
 
     ProlongLinear prolong_linear;
-    prolong_linear.apply
-      (precision,
+    prolong_linear.apply_list
+      (precision, num_fields,
        values_f,m3_f,o3_f,n3_f,
        values_c,m3_c,o3_c,n3_c,accumulate);
   }
@@ -110,10 +126,10 @@ void EnzoProlong::apply
 //----------------------------------------------------------------------
 
 void EnzoProlong::apply_
-( 
- enzo_float * values_f, int m3_f[3], int o3_f[3], int n3_f[3],
- const enzo_float * values_c, int m3_c[3], int o3_c[3], int n3_c[3],
- bool accumulate)
+( int num_fields,
+  enzo_float * const * values_f, int m3_f[3], int o3_f[3], int n3_f[3],
+  const enzo_float * const * values_c, int m3_c[3], int o3_c[3], int n3_c[3],
+  bool accumulate)
 {
   int rank = cello::rank();
 
@@ -133,13 +149,17 @@ void EnzoProlong::apply_
     gstart[i] = 0;
   }
   
+  // Work arrays depend only on the array sizes, so are shared by all
+  // fields
+
   int size=gdims[0]/2 + 1;
   if (rank >= 2) size*=gdims[1]/2 + 1;
   if (rank >= 3) size*=gdims[2]/2 + 1;
-  enzo_float * work = new enzo_float[2*size+100];
+  std::vector<enzo_float> work (2*size+100);
 
 #ifdef DEBUG_ENZO_PROLONG
   CkPrintf ("DEBUG_ENZO_PROLONG EnzoProlong\n");
+  CkPrintf ("DEBUG_ENZO_PROLONG num_fields %d\n",num_fields);
   CkPrintf ("DEBUG_ENZO_PROLONG m3_f    %d %d %d\n",m3_f[0],m3_f[1],m3_f[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG n3_f    %d %d %d\n",n3_f[0],n3_f[1],n3_f[2]);
   CkPrintf ("DEBUG_ENZO_PROLONG o3_f    %d %d %d\n",o3_f[0],o3_f[1],o3_f[2]);
@@ -171,29 +191,33 @@ void EnzoProlong::apply_
   int o_f = o3_f[0] + m3_f[0]*(o3_f[1] + m3_f[1]*o3_f[2]);
 
   const int mf = m3_f[0]*m3_f[1]*m3_f[2];
-  enzo_float * temp_f = (accumulate) ? (new enzo_float [mf]) : values_f;
-
-  FORTRAN_NAME(interpolate)
-    (&rank,
-     ((enzo_float*)(values_c))+o_c, pdims, pstart, pend, r3,
-     ((enzo_float*)(temp_f))+o_f, gdims, gstart, work, &method_,
-     &positive_, &error);
-
-  DEBUG_PRINT_ARRAY0("values_c",values_c,m3_c,n3_c,o3_c);
-  DEBUG_PRINT_ARRAY0("values_f",values_f,m3_f,n3_f,o3_f);
-
-  if (accumulate) {
-    int i0 = o3_f[0] + m3_f[0]*(o3_f[1] + m3_f[1]*o3_f[2]);
-    for (int iz=0; iz<n3_f[2]; iz++) {
-      for (int iy=0; iy<n3_f[1]; iy++) {
-        for (int ix=0; ix<n3_f[0]; ix++) {
-          int i = i0 + ix + m3_f[0]*(iy + m3_f[1]*iz);
-          values_f[i] += temp_f[i];
+  std::vector<enzo_float> temp;
+  if (accumulate) temp.resize(mf);
+
+  for (int i_field=0; i_field<num_fields; i_field++) {
+
+    enzo_float * temp_f = (accumulate) ? temp.data() : values_f[i_field];
+
+    FORTRAN_NAME(interpolate)
+      (&rank,
+       ((enzo_float*)(values_c[i_field]))+o_c, pdims, pstart, pend, r3,
+       ((enzo_float*)(temp_f))+o_f, gdims, gstart, work.data(), &method_,
+       &positive_, &error);
+
+    DEBUG_PRINT_ARRAY0("values_c",values_c[i_field],m3_c,n3_c,o3_c);
+    DEBUG_PRINT_ARRAY0("values_f",values_f[i_field],m3_f,n3_f,o3_f);
+
+    if (accumulate) {
+      enzo_float * vf = values_f[i_field];
+      int i0 = o3_f[0] + m3_f[0]*(o3_f[1] + m3_f[1]*o3_f[2]);
+      for (int iz=0; iz<n3_f[2]; iz++) {
+        for (int iy=0; iy<n3_f[1]; iy++) {
+          for (int ix=0; ix<n3_f[0]; ix++) {
+            int i = i0 + ix + m3_f[0]*(iy + m3_f[1]*iz);
+            vf[i] += temp_f[i];
+          }
         }
       }
     }
-    delete [] temp_f;
   }
-
-  delete [] work;
 }
@@ -43,6 +43,14 @@ public: // interface
     const void * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
 
+  /// Prolong a list of fields with the same geometry, sharing the
+  /// interpolate() work array
+  virtual void apply_list
+  ( precision_type precision, int num_fields,
+    void *       const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const void * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+    bool accumulate = false);
+
   /// Return the name identifying the prolongation operator
   virtual std::string name () const { return "enzo"; }
 
@@ -55,8 +63,9 @@ protected: // protected virtual methods
 private: // functions
 
   void apply_
-  ( enzo_float *  values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
-    const enzo_float * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+  ( int num_fields,
+    enzo_float * const * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const enzo_float * const * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
     bool accumulate = false);
   
 private: // attributes
@@ -0,0 +1,659 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodFof.cpp
+/// @date     2026-10-17
+/// @brief    Implements the EnzoMethodFof class, a distributed
+///           friends-of-friends halo finder
+///
+///           Rounds are synchronized with a global reduction, so a
+///           neighbor's message for round r+1 can only arrive after
+///           this Block has processed round r, though possibly before
+///           it receives the reduction result.  Messages for round 0
+///           may arrive before compute() is called, so the Block state
+///           is created by whichever comes first.
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/particle/particle.hpp"
+
+#include "Enzo/particle/FofLib.hpp"
+
+// #define DEBUG_FOF
+
+// number of partial sums per halo: count, mass, mass-weighted
+// position and momentum
+#define FOF_NUM_SUMS 8
+
+//----------------------------------------------------------------------
+
+struct EnzoMethodFof::State {
+
+  /// Current round, or -1 before compute() is called
+  int round = -1;
+  /// Whether the current round has been processed
+  bool round_done = false;
+  /// Number of neighbor messages received for even and odd rounds
+  int count[2] = {0,0};
+
+  /// Block center and half-width
+  double center[3];
+  double h[3];
+
+  /// Local particle positions relative to the Block center, velocities,
+  /// masses, and ids
+  std::vector<double> pos;
+  std::vector<double> vel;
+  std::vector<double> mass;
+  std::vector<long long> id;
+
+  /// Neighbor Blocks, their faces, and the local particles sent to them
+  std::vector<Index> neighbor_index;
+  std::vector<int> neighbor_face;
+  std::vector< std::vector<int> > neighbor_list;
+
+  /// Ghost particle positions, labels, and label owners, and the
+  /// offset of each sender's ghosts keyed by its Index and face
+  std::vector<double> ghost_pos;
+  std::vector<long long> ghost_label;
+  std::vector<int> ghost_owner;
+  std::map< std::vector<int>, int > ghost_offset;
+
+  /// Group of each local and ghost particle, and the label and label
+  /// owner of each group
+  std::vector<int> group;
+  std::vector<long long> group_label;
+  std::vector<int> group_owner;
+
+  /// Number of halo messages sent but not yet acknowledged
+  int acks = 0;
+
+  /// Partial sums of halos owned by this Block
+  std::map< long long, std::vector<double> > halo;
+};
+
+//----------------------------------------------------------------------
+
+std::set<std::string> EnzoMethodFof::files_written_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+EnzoMethodFof::EnzoMethodFof(ParameterGroup p)
+  : Method(),
+    particle_type_(p.value_string("particle_type","dark")),
+    linking_length_(p.value_float("linking_length",0.2)),
+    min_group_size_(p.value_integer("min_group_size",20)),
+    file_name_(),
+    is_state_(-1)
+{
+  ASSERT("EnzoMethodFof::EnzoMethodFof()",
+	 "EnzoMethodFof requires that we run a 3D problem (Domain:rank = 3)",
+	 cello::rank() == 3);
+
+  ASSERT1("EnzoMethodFof::EnzoMethodFof()",
+          "Method:fof:linking_length %g must be positive",
+          linking_length_, (linking_length_ > 0.0));
+
+  const int n = p.list_length("file_name");
+  if (n > 0) {
+    for (int i=0; i<n; i++) {
+      file_name_.push_back(p.list_value_string(i,"file_name"));
+    }
+  } else {
+    file_name_ = { "halos-%06d-%04d.txt", "cycle", "proc" };
+  }
+
+  is_state_ = cello::scalar_descr_void()->new_value("method_fof:state");
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::pup (PUP::er &p)
+{
+  // NOTE: Change this function whenever attributes change
+
+  TRACEPUP;
+
+  Method::pup(p);
+
+  p | particle_type_;
+  p | linking_length_;
+  p | min_group_size_;
+  p | file_name_;
+  p | is_state_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::compute ( Block * block) throw()
+{
+  State * state = state_(block);
+
+  double xm[3],xp[3];
+  block->lower(xm,xm+1,xm+2);
+  block->upper(xp,xp+1,xp+2);
+  for (int axis=0; axis<3; axis++) {
+    state->center[axis] = 0.5*(xm[axis] + xp[axis]);
+    state->h[axis]      = 0.5*(xp[axis] - xm[axis]);
+  }
+
+  if (block->is_leaf()) {
+
+    Particle particle = block->data()->particle();
+
+    const int it = particle.type_index(particle_type_);
+
+    ASSERT1("EnzoMethodFof::compute()",
+            "Particle type %s must have an \"id\" attribute",
+            particle_type_.c_str(),
+            particle.has_attribute(it,"id"));
+
+    const int ia_x  = particle.attribute_index(it,"x");
+    const int ia_y  = particle.attribute_index(it,"y");
+    const int ia_z  = particle.attribute_index(it,"z");
+    const int ia_vx = particle.attribute_index(it,"vx");
+    const int ia_vy = particle.attribute_index(it,"vy");
+    const int ia_vz = particle.attribute_index(it,"vz");
+    const int ia_id = particle.attribute_index(it,"id");
+
+    const bool mass_is_attribute = particle.has_attribute(it,"mass");
+    const int ia_m = mass_is_attribute ?
+      particle.attribute_index(it,"mass") : -1;
+    const enzo_float mass_constant = mass_is_attribute ? 0.0 :
+      *((enzo_float*)
+        particle.constant_value(it,particle.constant_index(it,"mass")));
+
+    const int np = particle.num_particles(it);
+    state->pos.reserve(3*np);
+    state->vel.reserve(3*np);
+    state->mass.reserve(np);
+    state->id.reserve(np);
+
+    const int nb = particle.num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+      const enzo_float * pa[3] =
+        { (enzo_float *) particle.attribute_array(it,ia_x,ib),
+          (enzo_float *) particle.attribute_array(it,ia_y,ib),
+          (enzo_float *) particle.attribute_array(it,ia_z,ib) };
+      const enzo_float * va[3] =
+        { (enzo_float *) particle.attribute_array(it,ia_vx,ib),
+          (enzo_float *) particle.attribute_array(it,ia_vy,ib),
+          (enzo_float *) particle.attribute_array(it,ia_vz,ib) };
+      const int64_t * ida =
+        (int64_t *) particle.attribute_array(it,ia_id,ib);
+      const enzo_float * ma = mass_is_attribute ?
+        (enzo_float *) particle.attribute_array(it,ia_m,ib) : NULL;
+
+      const int dp = particle.stride(it,ia_x);
+      const int dv = particle.stride(it,ia_vx);
+      const int did = particle.stride(it,ia_id);
+      const int dm = mass_is_attribute ? particle.stride(it,ia_m) : 0;
+
+      const int npb = particle.num_particles(it,ib);
+      for (int ip=0; ip<npb; ip++) {
+        for (int axis=0; axis<3; axis++) {
+          state->pos.push_back(pa[axis][ip*dp] - state->center[axis]);
+          state->vel.push_back(va[axis][ip*dv]);
+        }
+        state->mass.push_back(ma ? ma[ip*dm] : mass_constant);
+        state->id.push_back(ida[ip*did]);
+      }
+    }
+  }
+
+  state->round = 0;
+  state->round_done = false;
+
+  if (block->is_leaf()) {
+    send_labels_(block,state);
+  }
+
+  try_round_(block,state);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::recv_labels
+(Block * block, int round, Index index, int of3[3],
+ int n, double * pos, long long * label, int * owner)
+{
+  State * state = state_(block);
+
+  int v3[3];
+  index.values(v3);
+  const std::vector<int> key = {v3[0],v3[1],v3[2],of3[0],of3[1],of3[2]};
+
+  int k;
+  if (round == 0) {
+    // first message from this sender: append its ghost particles
+    k = state->ghost_label.size();
+    state->ghost_offset[key] = k;
+    state->ghost_pos.insert(state->ghost_pos.end(),pos,pos+3*n);
+    state->ghost_label.resize(k+n);
+    state->ghost_owner.resize(3*(k+n));
+  } else {
+    k = state->ghost_offset.at(key);
+  }
+  std::copy_n(label,n,state->ghost_label.begin()+k);
+  std::copy_n(owner,3*n,state->ghost_owner.begin()+3*k);
+
+  ++state->count[round % 2];
+
+  try_round_(block,state);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::round_end (Block * block, int count)
+{
+  State * state = state_(block);
+
+#ifdef DEBUG_FOF
+  CkPrintf ("DEBUG_FOF %s round %d changed %d\n",
+            block->name().c_str(),state->round,count);
+#endif
+
+  // Labels sent in round 0 are particle ids, not group labels, so
+  // always perform at least one more round
+  if (state->round == 0 || count > 0) {
+    ++state->round;
+    state->round_done = false;
+    send_labels_(block,state);
+    try_round_(block,state);
+  } else {
+    send_halos_(block,state);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::recv_halos
+(Block * block, Index index, int n, long long * label, double * data)
+{
+  State * state = state_(block);
+  for (int i=0; i<n; i++) {
+    add_halo_(block,state,label[i],data + FOF_NUM_SUMS*i);
+  }
+  enzo::block_array()[index].p_method_fof_ack();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::recv_ack (Block * block)
+{
+  State * state = state_(block);
+  if (--state->acks == 0) {
+    CkCallback callback (CkIndex_EnzoBlock::r_method_fof_end(NULL),
+                         enzo::block_array());
+    block->contribute(callback);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::write_catalog (Block * block)
+{
+  State * state = state_(block);
+
+  FILE * fp = nullptr;
+
+  for (auto & it_halo : state->halo) {
+    const std::vector<double> & sum = it_halo.second;
+    if (sum[0] < min_group_size_) continue;
+
+    if (fp == nullptr) {
+      // Blocks on the same process append to the same file, which
+      // is truncated by the first Block to write to it in this run
+      Simulation * simulation = cello::simulation();
+      std::string file_name = cello::expand_name
+        (&file_name_,0,simulation->cycle(),simulation->time());
+      std::set<std::string> & files_written =
+        files_written_[cello::index_static()];
+      const bool first = files_written.insert(file_name).second;
+      fp = fopen (file_name.c_str(), first ? "w" : "a");
+      ASSERT1 ("EnzoMethodFof::write_catalog()",
+               "Cannot open halo catalog file %s",
+               file_name.c_str(), (fp != nullptr));
+    }
+
+    const double mass = sum[1];
+    double x3[3], xf3[3];
+    for (int axis=0; axis<3; axis++) x3[axis] = sum[2+axis] / mass;
+    cello::hierarchy()->get_folded_position(x3,xf3);
+
+    fprintf (fp,"%lld %d %.10g %.10g %.10g %.10g %.10g %.10g %.10g\n",
+             it_halo.first, int(sum[0]), mass,
+             xf3[0], xf3[1], xf3[2],
+             sum[5]/mass, sum[6]/mass, sum[7]/mass);
+  }
+
+  if (fp) fclose(fp);
+
+  delete_state_(block);
+
+  block->compute_done();
+}
+
+//======================================================================
+
+EnzoMethodFof::State * EnzoMethodFof::state_(Block * block)
+{
+  ScalarData<void *> * scalar_void = block->data()->scalar_data_void();
+  State ** state = (State **)
+    scalar_void->value(cello::scalar_descr_void(),is_state_);
+  if (*state == nullptr) (*state) = new State;
+  return *state;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::delete_state_(Block * block)
+{
+  ScalarData<void *> * scalar_void = block->data()->scalar_data_void();
+  State ** state = (State **)
+    scalar_void->value(cello::scalar_descr_void(),is_state_);
+  delete *state;
+  *state = nullptr;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodFof::linking_distance_() const
+{
+  const EnzoConfig * enzo_config = enzo::config();
+  return linking_length_ *
+    (enzo_config->domain_upper[0] - enzo_config->domain_lower[0]) /
+    enzo_config->mesh_root_size[0];
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::send_labels_(Block * block, State * state)
+{
+  const int round = state->round;
+  const double b = linking_distance_();
+
+  if (round == 0) {
+
+    for (int axis=0; axis<3; axis++) {
+      ASSERT3("EnzoMethodFof::send_labels_()",
+              "Linking length %g exceeds Block %s width along axis %d",
+              b, block->name().c_str(), axis,
+              (b <= 2.0*state->h[axis]));
+    }
+
+    // Select local particles within one linking length of each
+    // neighbor's shared face, edge, or corner
+
+    const int np = state->id.size();
+    ItNeighbor it_neighbor =
+      block->it_neighbor(block->index(),0,neighbor_leaf,0,0);
+    int of3[3];
+    while (it_neighbor.next(of3)) {
+      state->neighbor_index.push_back(it_neighbor.index());
+      state->neighbor_face.insert(state->neighbor_face.end(),of3,of3+3);
+      state->neighbor_list.push_back(std::vector<int>());
+      std::vector<int> & list = state->neighbor_list.back();
+      for (int ip=0; ip<np; ip++) {
+        bool in = true;
+        for (int axis=0; axis<3; axis++) {
+          const double x = state->pos[3*ip+axis];
+          if (of3[axis] == -1) in = in && (x <  -state->h[axis] + b);
+          if (of3[axis] == +1) in = in && (x >=  state->h[axis] - b);
+        }
+        if (in) list.push_back(ip);
+      }
+    }
+  }
+
+  Hierarchy * hierarchy = cello::hierarchy();
+  int period3[3];
+  hierarchy->get_periodicity(period3,period3+1,period3+2);
+  double dm3[3],dp3[3];
+  hierarchy->lower(dm3,dm3+1,dm3+2);
+  hierarchy->upper(dp3,dp3+1,dp3+2);
+
+  int v3[3];
+  block->index().values(v3);
+
+  const int nn = state->neighbor_index.size();
+  for (int k=0; k<nn; k++) {
+    const int * of3 = &state->neighbor_face[3*k];
+    const std::vector<int> & list = state->neighbor_list[k];
+    const int n = list.size();
+
+    std::vector<long long> label(n);
+    std::vector<int> owner(3*n);
+    for (int i=0; i<n; i++) {
+      const int ip = list[i];
+      if (round == 0) {
+        label[i] = state->id[ip];
+        std::copy_n(v3,3,&owner[3*i]);
+      } else {
+        const int g = state->group[ip];
+        label[i] = state->group_label[g];
+        std::copy_n(&state->group_owner[3*g],3,&owner[3*i]);
+      }
+    }
+
+    // Positions are only sent in round 0, shifted to the periodic
+    // image adjacent to the neighbor if it lies across the domain
+    // boundary
+    std::vector<double> pos;
+    if (round == 0) {
+      double shift[3] = {0.0, 0.0, 0.0};
+      for (int axis=0; axis<3; axis++) {
+        const double x = state->center[axis] + 1.5*of3[axis]*state->h[axis];
+        if (period3[axis] && x < dm3[axis]) shift[axis] = dp3[axis]-dm3[axis];
+        if (period3[axis] && x > dp3[axis]) shift[axis] = dm3[axis]-dp3[axis];
+      }
+      pos.resize(3*n);
+      for (int i=0; i<n; i++) {
+        for (int axis=0; axis<3; axis++) {
+          pos[3*i+axis] = state->pos[3*list[i]+axis]
+            + state->center[axis] + shift[axis];
+        }
+      }
+    }
+
+    enzo::block_array()[state->neighbor_index[k]].p_method_fof_recv
+      (round, block->index(), (int*)of3, pos.size(), pos.data(),
+       n, label.data(), owner.data());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::try_round_(Block * block, State * state)
+{
+  const int round = state->round;
+  if (round < 0 || state->round_done ||
+      state->count[round % 2] < int(state->neighbor_index.size())) return;
+
+  state->round_done = true;
+  state->count[round % 2] = 0;
+
+  const int np = state->id.size();
+  const int ng = state->ghost_label.size();
+
+  if (round == 0) {
+
+    // Link local and ghost particles, labelling each group with its
+    // smallest local particle id
+
+    const int n = np + ng;
+    state->group.resize(n);
+    int num_groups = 0;
+    if (n > 0) {
+      std::vector<enzo_float> x(3*n);
+      std::copy_n(state->pos.begin(),3*np,x.begin());
+      for (int i=0; i<ng; i++) {
+        for (int axis=0; axis<3; axis++) {
+          x[3*(np+i)+axis] =
+            state->ghost_pos[3*i+axis] - state->center[axis];
+        }
+      }
+      const enzo_float b = linking_distance_();
+      int * group_size = nullptr;
+      num_groups = Fof(n, x.data(), b, state->group.data(), &group_size);
+      free(group_size);
+    }
+
+    state->group_label.assign
+      (num_groups,std::numeric_limits<long long>::max());
+    state->group_owner.resize(3*num_groups);
+    int v3[3];
+    block->index().values(v3);
+    for (int ip=0; ip<np; ip++) {
+      const int g = state->group[ip];
+      if (state->id[ip] < state->group_label[g]) {
+        state->group_label[g] = state->id[ip];
+        std::copy_n(v3,3,&state->group_owner[3*g]);
+      }
+    }
+  }
+
+  // Update group labels with smaller neighbor labels
+
+  int changed = 0;
+  for (int i=0; i<ng; i++) {
+    const int g = state->group[np+i];
+    if (state->ghost_label[i] < state->group_label[g]) {
+      state->group_label[g] = state->ghost_label[i];
+      std::copy_n(&state->ghost_owner[3*i],3,&state->group_owner[3*g]);
+      ++changed;
+    }
+  }
+
+  CkCallback callback (CkIndex_EnzoBlock::r_method_fof_round(NULL),
+                       enzo::block_array());
+  block->contribute(sizeof(int), &changed, CkReduction::sum_int, callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::send_halos_(Block * block, State * state)
+{
+  // Sum local particles in each group
+
+  const int np = state->id.size();
+  const int num_groups = state->group_label.size();
+
+  std::vector<double> sum(FOF_NUM_SUMS*num_groups,0.0);
+  for (int ip=0; ip<np; ip++) {
+    double * s = &sum[FOF_NUM_SUMS*state->group[ip]];
+    const double m = state->mass[ip];
+    s[0] += 1.0;
+    s[1] += m;
+    for (int axis=0; axis<3; axis++) {
+      s[2+axis] += m*(state->pos[3*ip+axis] + state->center[axis]);
+      s[5+axis] += m*state->vel[3*ip+axis];
+    }
+  }
+
+  // Collect partial sums by the Block owning the group label
+
+  std::map< Index, std::vector<long long> > send_label;
+  std::map< Index, std::vector<double> > send_data;
+  for (int g=0; g<num_groups; g++) {
+    const double * s = &sum[FOF_NUM_SUMS*g];
+    if (s[0] == 0.0) continue;
+    Index owner;
+    owner.set_values(&state->group_owner[3*g]);
+    if (owner == block->index()) {
+      add_halo_(block,state,state->group_label[g],s);
+    } else {
+      send_label[owner].push_back(state->group_label[g]);
+      std::vector<double> & data = send_data[owner];
+      data.insert(data.end(),s,s+FOF_NUM_SUMS);
+    }
+  }
+
+  state->acks = send_label.size();
+
+  for (auto & it_send : send_label) {
+    const Index & owner = it_send.first;
+    std::vector<double> & data = send_data[owner];
+    enzo::block_array()[owner].p_method_fof_recv_halos
+      (block->index(), it_send.second.size(),
+       it_send.second.data(), data.data());
+  }
+
+  if (state->acks == 0) {
+    CkCallback callback (CkIndex_EnzoBlock::r_method_fof_end(NULL),
+                         enzo::block_array());
+    block->contribute(callback);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFof::add_halo_
+(Block * block, State * state, long long label, const double * data)
+{
+  std::vector<double> & sum = state->halo[label];
+  if (sum.empty()) sum.resize(FOF_NUM_SUMS,0.0);
+
+  // Shift the partial center of mass to the periodic image nearest
+  // this Block so halos spanning the domain boundary are contiguous
+  const double mass = data[1];
+  if (mass > 0.0) {
+    double x3[3], npi3[3];
+    for (int axis=0; axis<3; axis++) x3[axis] = data[2+axis] / mass;
+    cello::hierarchy()->get_nearest_periodic_image(x3,state->center,npi3);
+    for (int axis=0; axis<3; axis++) sum[2+axis] += mass*npi3[axis];
+  }
+  sum[0] += data[0];
+  sum[1] += mass;
+  for (int axis=0; axis<3; axis++) sum[5+axis] += data[5+axis];
+}
+
+//======================================================================
+
+void EnzoBlock::p_method_fof_recv
+(int round, Index index, int of3[3], int np, double * pos,
+ int n, long long * label, int * owner)
+{
+  EnzoMethodFof * method = static_cast<EnzoMethodFof*>
+    (enzo::problem()->method("fof"));
+  method->recv_labels(this,round,index,of3,n,pos,label,owner);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_method_fof_round(CkReductionMsg * msg)
+{
+  const int count = *((int *)msg->getData());
+  delete msg;
+  EnzoMethodFof * method = static_cast<EnzoMethodFof*>
+    (enzo::problem()->method("fof"));
+  method->round_end(this,count);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_fof_recv_halos
+(Index index, int n, long long * label, double * data)
+{
+  EnzoMethodFof * method = static_cast<EnzoMethodFof*>
+    (enzo::problem()->method("fof"));
+  method->recv_halos(this,index,n,label,data);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_fof_ack()
+{
+  EnzoMethodFof * method = static_cast<EnzoMethodFof*>
+    (enzo::problem()->method("fof"));
+  method->recv_ack(this);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_method_fof_end(CkReductionMsg * msg)
+{
+  delete msg;
+  EnzoMethodFof * method = static_cast<EnzoMethodFof*>
+    (enzo::problem()->method("fof"));
+  method->write_catalog(this);
+}
@@ -0,0 +1,129 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodFof.hpp
+/// @date     2026-10-17
+/// @brief    [\ref Enzo] Declaration of EnzoMethodFof, a distributed
+///           friends-of-friends halo finder
+
+#ifndef ENZO_ENZO_METHOD_FOF_HPP
+#define ENZO_ENZO_METHOD_FOF_HPP
+
+class EnzoMethodFof : public Method {
+
+  /// @class    EnzoMethodFof
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Find friends-of-friends groups of particles
+  /// across Blocks and write a halo catalog.
+  ///
+  /// Each leaf Block links its own particles, together with "ghost"
+  /// copies of its neighbors' particles within one linking length of
+  /// the shared face, using the kd-tree in FofLib.  Every group is
+  /// labelled with the smallest particle id it contains, and labels
+  /// are exchanged with neighbors until a global reduction finds that
+  /// no label changed.  Partial sums for each group are then sent to
+  /// the Block owning the particle with the group's label, which
+  /// writes one catalog row per halo.
+
+public: // interface
+
+  /// Constructor
+  EnzoMethodFof(ParameterGroup p);
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMethodFof);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoMethodFof (CkMigrateMessage *m)
+    : Method (m),
+      particle_type_(),
+      linking_length_(0.0),
+      min_group_size_(0),
+      file_name_(),
+      is_state_(-1)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Apply the method
+  virtual void compute( Block * block) throw();
+
+  /// Name
+  virtual std::string name () throw()
+  { return "fof"; }
+
+  /// Particle type the groups are found for
+  virtual std::string particle_type () throw()
+  { return particle_type_; }
+
+  /// Receive boundary particle labels (and positions in round 0)
+  /// from a neighbor
+  void recv_labels
+  (Block * block, int round, Index index, int of3[3],
+   int n, double * pos, long long * label, int * owner);
+
+  /// Global number of labels changed in the last round
+  void round_end (Block * block, int count);
+
+  /// Receive partial sums for halos owned by this Block
+  void recv_halos (Block * block, Index index,
+                   int n, long long * label, double * data);
+
+  /// Owner Block has received partial sums sent by this Block
+  void recv_ack (Block * block);
+
+  /// All partial sums have been received: write the catalog
+  void write_catalog (Block * block);
+
+protected: // methods
+
+  struct State;
+
+  /// Return the Block's state, creating it if needed
+  State * state_(Block * block);
+
+  /// Return the linking length in problem units
+  double linking_distance_() const;
+
+  /// Delete the Block's state
+  void delete_state_(Block * block);
+
+  /// Send boundary particles in round 0, or their labels in later rounds
+  void send_labels_(Block * block, State * state);
+
+  /// Process the current round if all neighbor messages have arrived
+  void try_round_(Block * block, State * state);
+
+  /// Send each group's partial sums to the owner of its label
+  void send_halos_(Block * block, State * state);
+
+  /// Add partial sums for halo label to the Block's halo catalog
+  void add_halo_(Block * block, State * state,
+                 long long label, const double * data);
+
+protected: // attributes
+
+  /// Name of the particle type to find groups of
+  std::string particle_type_;
+
+  /// Linking length in units of the root grid cell width, which is
+  /// the mean interparticle spacing for one particle per root cell
+  double linking_length_;
+
+  /// Minimum number of particles in a halo written to the catalog
+  int min_group_size_;
+
+  /// Catalog file name and format variables
+  std::vector<std::string> file_name_;
+
+  /// Index of the Block's State void pointer scalar
+  int is_state_;
+
+  /// Catalog files this PE has written to in this run.  A file is
+  /// truncated when first opened, so rerunning a cycle (e.g. after a
+  /// restart) does not append duplicate halos
+  static std::set<std::string> files_written_[CONFIG_NODE_SIZE];
+
+};
+
+#endif /* ENZO_ENZO_METHOD_FOF_HPP */
@@ -193,8 +193,16 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
         const int np = particle.num_particles(it,ib);
 
+        // extent of the updated positions, used to skip the batch when
+        // refreshing particles if none of them left the block
+        double lower[3] = {0.0, 0.0, 0.0};
+        double upper[3] = {0.0, 0.0, 0.0};
+
         if (rank >= 1) {
 
+          lower[0] = std::numeric_limits<double>::max();
+          upper[0] = std::numeric_limits<double>::lowest();
+
 	        for (int ip=0; ip<np; ip++) {
 
 	          const int ipdv = ip*dv;
@@ -211,12 +219,17 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
       	    vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
       	    x [ipdp] += cp*vx[ipdv];
       	    vx[ipdv] = cvv*vx[ipdv] + cva*ax[ipda];
+            lower[0] = std::min(lower[0], double(x[ipdp]));
+            upper[0] = std::max(upper[0], double(x[ipdp]));
 
 	        } // ip
         }
 
         if (rank >= 2) {
 
+          lower[1] = std::numeric_limits<double>::max();
+          upper[1] = std::numeric_limits<double>::lowest();
+
 	         for (int ip=0; ip<np; ip++) {
 
         	   const int ipdv = ip*dv;
@@ -232,12 +245,17 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
              vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
              y [ipdp] += cp*vy[ipdv];
              vy[ipdv] = cvv*vy[ipdv] + cva*ay[ipda];
+             lower[1] = std::min(lower[1], double(y[ipdp]));
+             upper[1] = std::max(upper[1], double(y[ipdp]));
 
 	         } // ip
         }
 
         if (rank >= 3) {
 
+          lower[2] = std::numeric_limits<double>::max();
+          upper[2] = std::numeric_limits<double>::lowest();
+
 	        for (int ip=0; ip<np; ip++) {
 
 	          const int ipdv = ip*dv;
@@ -254,9 +272,14 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
       	    vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
       	    z [ipdp] += cp*vz[ipdv];
       	    vz[ipdv] = cvv*vz[ipdv] + cva*az[ipda];
+            lower[2] = std::min(lower[2], double(z[ipdp]));
+            upper[2] = std::max(upper[2], double(z[ipdp]));
 
 	        } // ip
         } // rank 3
+
+        if (np > 0) particle.set_position_extent(it,ib,lower,upper);
+
       } // ib loop
     } // end loop over particle types
 
@@ -525,7 +525,6 @@ void EnzoMethodDistributedFeedback::compute_ (Block * block)
         int explosion_flag = -1, will_explode = -1;
         double soonest_explosion = -1.0, s49_tot = 0.0, td7 = -1.0;
         double star_age = 0.0;
-        unsigned long long int rand_int;
 
         const double time_last_sn = 37.7 * enzo_constants::Myr_s / enzo_units->time();
 
@@ -535,11 +534,13 @@ void EnzoMethodDistributedFeedback::compute_ (Block * block)
           soonest_explosion = -1.0;
 
 
-          // Assign seed for stochastic sampling using unique particle IDs
-          //
-          //  WARNING : This may not work for completley unique IDs if
-          //            number of processors used changes!!!  
-          srand(id[ipid]);
+          // Key the random numbers by the unique particle ID, so each
+          // particle draws the same numbers every cycle independent of
+          // which Block or PE it is on
+          const int id3[3] = { int(uint64_t(id[ipid])),
+                               int(uint64_t(id[ipid]) >> 32), 0 };
+          const Philox random (random_stream_feedback_distributed, 0, id3);
+          uint32_t i_random = 0;
 
           explosion_flag = -1;
           will_explode   =  0;
@@ -565,8 +566,7 @@ void EnzoMethodDistributedFeedback::compute_ (Block * block)
           int   k = 0;
           while (p>L){
             ++k;
-            //rand_int = (rand()) / (double( RAND_MAX));;
-            float u      = double(rand()) / (double(RAND_MAX)); // float(rand_int%RAND_MAX) / RAND_MAX;
+            float u      = random.uniform(i_random++);
             p*=u;
           }
 
@@ -597,8 +597,7 @@ void EnzoMethodDistributedFeedback::compute_ (Block * block)
           // Loop over these SN
           for (int kk=0; kk<number_of_sn; kk++){
             // Draw delay time for the event
-//            rand_int = (double(rand())) / (double(RAND_MAX));
-            double  x = double(rand()) / (double(RAND_MAX));
+            double  x = random.uniform(i_random++);
             double delay_time = p_delay[0] + p_delay[1]*x + p_delay[2]*x*x +
                                 p_delay[3]*x*x*x + p_delay[4]*x*x*x*x + p_delay[5]*x*x*x*x*x; // yr
 
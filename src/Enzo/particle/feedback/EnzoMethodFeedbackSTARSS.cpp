@@ -16,22 +16,60 @@
 #include "Enzo/enzo.hpp"
 #include "Enzo/particle/particle.hpp"
 
-#include <time.h>
+#include <array>
+#include <cstring>
+#include <map>
+#include <set>
 
 //#ifdef NOTDEFINED // for now... since not done coding
 
 //#define DEBUG_FEEDBACK_STARSS
 //#define DEBUG_FEEDBACK_STARSS_SN
 
+// Number of values sent per cell to neighbors: d, te, ge, mf, vx, vy,
+// vz, and d_shell deposits
+#define FEEDBACK_NUM_DEPOSITS 8
+
+//----------------------------------------------------------------------
+
+struct EnzoMethodFeedbackSTARSS::State {
+  /// Nonzero ghost zone deposits to send, as global cell indices at
+  /// this Block's level and FEEDBACK_NUM_DEPOSITS values per cell
+  std::vector<int> i3;
+  std::vector<double> values;
+  /// Whether this Block has sent its deposits to its neighbors
+  bool sent = false;
+  /// Number of leaf neighbors expected to send deposits
+  int num_neighbors = 0;
+  /// Number of neighbor messages received
+  int count = 0;
+  /// Deposits received from neighbors, keyed by cell index
+  std::map<int, std::array<double,FEEDBACK_NUM_DEPOSITS> > deposit;
+};
+
 // =============================================================================
 // splice these off to a different file (later)
 // TODO: Maybe create EnzoStarParticle class and add rate-calculating functions there?
 
+namespace {
+
+  /// Counter for a star's Philox random draws. Stars in the same cell
+  /// formed at different times get different draws, independent of the
+  /// order of the particles in the Block
+  uint32_t star_random_counter_(int index, double creation_time)
+  {
+    uint64_t bits;
+    std::memcpy(&bits, &creation_time, sizeof(bits));
+    return uint32_t(index) ^ (uint32_t(bits ^ (bits >> 32)) * 0x9E3779B9u);
+  }
+
+}
+
 int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA,
-                double pmass_Msun, double tunit, float dt){
+                double pmass_Msun, double tunit, float dt,
+                double random_II, double random_IA){
 
     const EnzoConfig * enzo_config = enzo::config();
-    std::mt19937 mt(std::time(nullptr));
 
     if (NEvents > 0){
         *nSNII = 1;
@@ -41,7 +79,7 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
     /* else, calculate SN rate, probability and determine number of events */
     *nSNII = 0;
     *nSNIA = 0;
-    double RII=0, RIA=0, PII=0, PIA=0, random = 0;
+    double RII=0, RIA=0, PII=0, PIA=0;
     if (this->supernovae_ && NEvents < 0)
     {
         /* age-dependent rates */
@@ -68,7 +106,6 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
         /* rates -> probabilities */
         if (RII > 0){
             PII = RII * pmass_Msun / enzo_constants::Myr_s *tunit*dt;
-            double random = double(mt())/double(mt.max());
             if (PII > 1.0){
                 if (this->unrestricted_sn_) {
                     int round = (int)PII;
@@ -83,7 +120,7 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
                 }
             }
            
-            if (random <= PII){
+            if (random_II <= PII){
                 *nSNII += 1;
             }
         }
@@ -95,7 +132,6 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
 
         if (RIA > 0){
             PIA = RIA*pmass_Msun / enzo_constants::Myr_s *tunit*dt;
-            float random = float(rand())/float(RAND_MAX);
 
             if (PIA > 1.0)
             {
@@ -117,7 +153,7 @@ int EnzoMethodFeedbackSTARSS::determineSN(double age_Myr, int* nSNII, int* nSNIA
                 PIA = 0;
             }
 
-            if (random < PIA){
+            if (random_IA < PIA){
                 *nSNIA += 1;
             }
         }
@@ -242,7 +278,7 @@ extern "C" void FORTRAN_NAME(cic_deposit)
 
 EnzoMethodFeedbackSTARSS::EnzoMethodFeedbackSTARSS(ParameterGroup p)
   : Method()
-  , ir_feedback_(-1)
+  , is_state_(-1)
 {
   FieldDescr * field_descr = cello::field_descr();
   const EnzoConfig * enzo_config = enzo::config();
@@ -294,49 +330,13 @@ EnzoMethodFeedbackSTARSS::EnzoMethodFeedbackSTARSS(ParameterGroup p)
   i_vz_dep = cello::field_descr()->insert_temporary();
   i_d_shell= cello::field_descr()->insert_temporary();
 
-  i_d_dep_a  = cello::field_descr()->insert_temporary();
-  i_te_dep_a = cello::field_descr()->insert_temporary();
-  i_ge_dep_a = cello::field_descr()->insert_temporary();
-  i_mf_dep_a = cello::field_descr()->insert_temporary();
-  i_vx_dep_a = cello::field_descr()->insert_temporary();
-  i_vy_dep_a = cello::field_descr()->insert_temporary();
-  i_vz_dep_a = cello::field_descr()->insert_temporary();
-  i_d_shell_a= cello::field_descr()->insert_temporary();
-
-  // Deposition across grid boundaries is handled using refresh with set_accumulate=true.
-  // The set_accumulate flag tells Cello to include ghost zones in the refresh operation,
-  // and adds the ghost zone values from the "src" field to the corresponding active zone
-  // values in the "dst" field.
- 
-  // I'm currently using a set of two initially empty fields for each field that SNe directly affect.
-  // CIC deposition directly modifies the *_deposit fields (including ghost zones). The ghost zone
-  // values are then sent to the *deposit_accumulate fields during the refresh operation. Values are then
-  // copied back to the original field. 
-  
-  ir_feedback_ = add_refresh_();
-  cello::simulation()->refresh_set_name(ir_feedback_,name()+":add");
-  Refresh * refresh_fb = cello::refresh(ir_feedback_); 
-
-  refresh_fb->set_accumulate(true);
-
-  refresh_fb->add_field_src_dst
-    (i_d_dep, i_d_dep_a);
-  refresh_fb->add_field_src_dst
-    (i_te_dep, i_te_dep_a);
-  refresh_fb->add_field_src_dst
-    (i_ge_dep, i_ge_dep_a);
-  refresh_fb->add_field_src_dst
-    (i_mf_dep, i_mf_dep_a);
-  refresh_fb->add_field_src_dst
-    (i_vx_dep, i_vx_dep_a);
-  refresh_fb->add_field_src_dst
-    (i_vy_dep, i_vy_dep_a);
-  refresh_fb->add_field_src_dst
-    (i_vz_dep, i_vz_dep_a);
-  refresh_fb->add_field_src_dst
-    (i_d_shell, i_d_shell_a);
- 
-  refresh_fb->set_callback(CkIndex_EnzoBlock::p_method_feedback_starss_end());
+  // Deposition across Block boundaries is handled by sending the nonzero
+  // ghost zone values of the deposit fields, tagged with their global
+  // cell indices, to the neighbors containing them. Each neighbor adds
+  // them to its own cells once all of its neighbors' messages (empty
+  // if a neighbor had no feedback events) have arrived.
+
+  is_state_ = cello::scalar_descr_void()->new_value("method_feedback:state");
 
   return;
 }
@@ -356,7 +356,7 @@ void EnzoMethodFeedbackSTARSS::pup (PUP::er &p)
   p | analytic_SNR_shell_mass_;
   p | fade_SNR_;
   p | NEvents;
-  p | ir_feedback_;
+  p | is_state_;
 
   p | i_d_dep;
   p | i_te_dep;
@@ -367,15 +367,6 @@ void EnzoMethodFeedbackSTARSS::pup (PUP::er &p)
   p | i_vz_dep;
   p | i_d_shell;
 
-  p | i_d_dep_a;
-  p | i_te_dep_a;
-  p | i_ge_dep_a;
-  p | i_mf_dep_a;
-  p | i_vx_dep_a;
-  p | i_vy_dep_a;
-  p | i_vz_dep_a;
-  p | i_d_shell_a;
-
   return;
 }
 
@@ -387,7 +378,9 @@ void EnzoMethodFeedbackSTARSS::compute (Block * block) throw()
   }
 
   else {
-    block->compute_done();
+    // non-leaf Blocks take part in the reduction, then end the method
+    // in send_deposits()
+    contribute_deposits_(block,false);
   }
   return;
 }
@@ -418,24 +411,7 @@ void EnzoMethodFeedbackSTARSS::add_accumulate_fields(EnzoBlock * enzo_block) thr
   enzo_float * vy = (enzo_float *) field.values("velocity_y");
   enzo_float * vz = (enzo_float *) field.values("velocity_z");
   
-  enzo_float * d_dep  = (enzo_float *) field.values(i_d_dep);
-  enzo_float * te_dep = (enzo_float *) field.values(i_te_dep);
-  enzo_float * ge_dep = (enzo_float *) field.values(i_ge_dep);
-  enzo_float * mf_dep = (enzo_float *) field.values(i_mf_dep);
-  enzo_float * vx_dep = (enzo_float *) field.values(i_vx_dep);
-  enzo_float * vy_dep = (enzo_float *) field.values(i_vy_dep);
-  enzo_float * vz_dep = (enzo_float *) field.values(i_vz_dep);
-
-  enzo_float * d_dep_a  = (enzo_float *) field.values(i_d_dep_a);
-  enzo_float * te_dep_a = (enzo_float *) field.values(i_te_dep_a);
-  enzo_float * ge_dep_a = (enzo_float *) field.values(i_ge_dep_a);
-  enzo_float * mf_dep_a = (enzo_float *) field.values(i_mf_dep_a);
-  enzo_float * vx_dep_a = (enzo_float *) field.values(i_vx_dep_a);
-  enzo_float * vy_dep_a = (enzo_float *) field.values(i_vy_dep_a);
-  enzo_float * vz_dep_a = (enzo_float *) field.values(i_vz_dep_a);
-
-  enzo_float * d_shell   = (enzo_float *) field.values(i_d_shell);
-  enzo_float * d_shell_a = (enzo_float *) field.values(i_d_shell_a);
+  State * state = state_(enzo_block);
 
   EnzoUnits * enzo_units = enzo::units();
   double cell_volume_code = hx*hy*hz;
@@ -448,75 +424,379 @@ void EnzoMethodFeedbackSTARSS::add_accumulate_fields(EnzoBlock * enzo_block) thr
   // to cell mass in Msun
   double rho_to_m = rhounit*cell_volume_cgs / enzo_constants::mass_solar;
 
-  for (int iz=gz; iz<nz+gz; iz++){
-    for (int iy=gy; iy<ny+gy; iy++){
-      for (int ix=gx; ix<nx+gx; ix++){
-        int i = INDEX(ix,iy,iz,mx,my);
-        if (d_dep_a[i] != 0) { // if any deposition
-
-          double d_old = d[i];
-          
-          // Could have a race condition here where if one particle updates the density of a cell,
-          // that update won't get communicated to the other block until the end of the cycle.
-          // In rare cases, this could result in a cell having a negative density because "centralMass"
-          // and "centralMetals" in deposit_feedback() will be overpredicted going into the negative-mass
-          // CiC for clearing out gas from the central cell. Catch this case by setting density
-          // to (1-maxEvacFraction) * density[i] and metal_density to (1-maxEvacFraction) * metal_density[i] if
-          // either go negative.
-
-          if (d[i] + d_dep_a[i] < 0) {
-            d[i] *= 1-maxEvacFraction;
-          }
-          else {
-            d[i] += d_dep_a[i];
-          }
+  // deposits are keyed by cell index, so cells are updated in the same
+  // order as a loop over the Block
+  for (const auto & cell_deposit : state->deposit) {
+    const int i = cell_deposit.first;
+    const double d_dep_a  = cell_deposit.second[0];
+    const double te_dep_a = cell_deposit.second[1];
+    const double ge_dep_a = cell_deposit.second[2];
+    const double mf_dep_a = cell_deposit.second[3];
+    const double vx_dep_a = cell_deposit.second[4];
+    const double vy_dep_a = cell_deposit.second[5];
+    const double vz_dep_a = cell_deposit.second[6];
+    const double d_shell_a = cell_deposit.second[7];
+    if (d_dep_a != 0) { // if any deposition
+
+      double d_old = d[i];
+      
+      // Could have a race condition here where if one particle updates the density of a cell,
+      // that update won't get communicated to the other block until the end of the cycle.
+      // In rare cases, this could result in a cell having a negative density because "centralMass"
+      // and "centralMetals" in deposit_feedback() will be overpredicted going into the negative-mass
+      // CiC for clearing out gas from the central cell. Catch this case by setting density
+      // to (1-maxEvacFraction) * density[i] and metal_density to (1-maxEvacFraction) * metal_density[i] if
+      // either go negative.
+
+      if (d[i] + d_dep_a < 0) {
+        d[i] *= 1-maxEvacFraction;
+      }
+      else {
+        d[i] += d_dep_a;
+      }
 
-          if (mf[i] + mf_dep_a[i] < 0) {
-            mf[i] *= 1-maxEvacFraction;
-          }
-          else {
-            mf[i] += mf_dep_a[i];
-          }
+      if (mf[i] + mf_dep_a < 0) {
+        mf[i] *= 1-maxEvacFraction;
+      }
+      else {
+        mf[i] += mf_dep_a;
+      }
 
-          double d_new = d[i];
-          double inv_dens_new = 1.0/d_new;
+      double d_new = d[i];
+      double inv_dens_new = 1.0/d_new;
 
-          double M_scale_tot = d_new / d_old;
-          double M_scale_shell = d_shell_a[i]/d[i];
+      double M_scale_tot = d_new / d_old;
+      double M_scale_shell = d_shell_a/d[i];
 
-          // Here, te_dep_a and ge_dep_a are carrying "energy density" (not specific energy)
-          // and vx_dep_a, vy_dep_a, and vy_dep_a are carrying velocity of the shell (not momentum density)
+      // Here, te_dep_a and ge_dep_a are carrying "energy density" (not specific energy)
+      // and vx_dep_a, vy_dep_a, and vy_dep_a are carrying velocity of the shell (not momentum density)
  
-          te[i] = te[i] / M_scale_tot + std::max( (double) te_dep_a[i], 0.0) * inv_dens_new; 
-          ge[i] = ge[i] / M_scale_tot + std::max( (double) ge_dep_a[i], 0.0) * inv_dens_new;
-          vx[i] += vx_dep_a[i] * M_scale_shell;
-          vy[i] += vy_dep_a[i] * M_scale_shell;
-          vz[i] += vz_dep_a[i] * M_scale_shell;
-
-          // rescale color fields to account for new densities
-          EnzoMethodStarMaker::rescale_densities(enzo_block, i, M_scale_tot);
-          // undo rescaling of metal_density field
-          mf[i] /= M_scale_tot;
-
-         }        
-        
+      te[i] = te[i] / M_scale_tot + std::max(te_dep_a, 0.0) * inv_dens_new; 
+      ge[i] = ge[i] / M_scale_tot + std::max(ge_dep_a, 0.0) * inv_dens_new;
+      vx[i] += vx_dep_a * M_scale_shell;
+      vy[i] += vy_dep_a * M_scale_shell;
+      vz[i] += vz_dep_a * M_scale_shell;
+
+      // rescale color fields to account for new densities
+      EnzoMethodStarMaker::rescale_densities(enzo_block, i, M_scale_tot);
+      // undo rescaling of metal_density field
+      mf[i] /= M_scale_tot;
+
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_feedback_starss_recv
+(int level, int n, int * i3, double * values)
+{
+  EnzoMethodFeedbackSTARSS * method = static_cast<EnzoMethodFeedbackSTARSS*>
+    (enzo::problem()->method("feedback"));
+  method->recv_deposits(this,level,n,i3,values);
+}
+
+//----------------------------------------------------------------------
+
+EnzoMethodFeedbackSTARSS::State * EnzoMethodFeedbackSTARSS::state_
+(Block * block)
+{
+  ScalarData<void *> * scalar_void = block->data()->scalar_data_void();
+  State ** state = (State **)
+    scalar_void->value(cello::scalar_descr_void(),is_state_);
+  if (*state == nullptr) (*state) = new State;
+  return *state;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFeedbackSTARSS::delete_state_(Block * block)
+{
+  ScalarData<void *> * scalar_void = block->data()->scalar_data_void();
+  State ** state = (State **)
+    scalar_void->value(cello::scalar_descr_void(),is_state_);
+  delete *state;
+  *state = nullptr;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFeedbackSTARSS::collect_deposits_
+(Block * block, State * state)
+{
+  const int rank = cello::rank();
+
+  Field field = block->data()->field();
+  int n3[3], g3[3];
+  field.size(n3,n3+1,n3+2);
+  field.ghost_depth(0,g3,g3+1,g3+2);
+  const int mx = n3[0] + 2*g3[0];
+  const int my = n3[1] + 2*g3[1];
+  const int mz = n3[2] + 2*g3[2];
+
+  // Collect the nonzero ghost zone deposits as global cell indices at
+  // this Block's level, wrapped across periodic domain boundaries
+
+  std::vector<int> & i3 = state->i3;
+  std::vector<double> & values = state->values;
+
+  int ib3[3], nb3[3];
+  block->index_global(ib3,ib3+1,ib3+2,nb3,nb3+1,nb3+2);
+  int period3[3];
+  cello::hierarchy()->get_periodicity(period3,period3+1,period3+2);
+
+  const enzo_float * dep[FEEDBACK_NUM_DEPOSITS] = {
+    (enzo_float *) field.values(i_d_dep),
+    (enzo_float *) field.values(i_te_dep),
+    (enzo_float *) field.values(i_ge_dep),
+    (enzo_float *) field.values(i_mf_dep),
+    (enzo_float *) field.values(i_vx_dep),
+    (enzo_float *) field.values(i_vy_dep),
+    (enzo_float *) field.values(i_vz_dep),
+    (enzo_float *) field.values(i_d_shell) };
+
+  for (int iz=0; iz<mz; iz++) {
+    for (int iy=0; iy<my; iy++) {
+      for (int ix=0; ix<mx; ix++) {
+        const int c3[3] = {ix,iy,iz};
+        bool ghost = false;
+        for (int axis=0; axis<rank; axis++) {
+          ghost = ghost ||
+            (c3[axis] < g3[axis]) || (c3[axis] >= g3[axis]+n3[axis]);
+        }
+        if (! ghost) continue;
+        const int i = INDEX(ix,iy,iz,mx,my);
+        bool nonzero = false;
+        for (int k=0; k<FEEDBACK_NUM_DEPOSITS; k++) {
+          nonzero = nonzero || (dep[k][i] != 0.0);
+        }
+        if (! nonzero) continue;
+        int ig3[3] = {0,0,0};
+        bool in_domain = true;
+        for (int axis=0; axis<rank; axis++) {
+          const int nc = nb3[axis]*n3[axis];
+          ig3[axis] = ib3[axis]*n3[axis] + c3[axis] - g3[axis];
+          if (ig3[axis] < 0 || ig3[axis] >= nc) {
+            if (period3[axis]) {
+              ig3[axis] = (ig3[axis] + nc) % nc;
+            } else {
+              in_domain = false;
+            }
+          }
+        }
+        if (! in_domain) continue;
+        i3.insert(i3.end(),ig3,ig3+3);
+        for (int k=0; k<FEEDBACK_NUM_DEPOSITS; k++) {
+          values.push_back(dep[k][i]);
+        }
       }
     }
   }
+}
 
-  deallocate_temporary_(enzo_block);
-  return;
+//----------------------------------------------------------------------
+
+void EnzoMethodFeedbackSTARSS::contribute_deposits_
+(Block * block, bool has_deposits)
+{
+  // Blocks with ghost zone deposits contribute their Index, so that
+  // every Block learns which of its neighbors will send it deposits
+
+  int v3[3];
+  block->index().values(v3);
+
+  CkCallback callback
+    (CkIndex_EnzoBlock::r_method_feedback_starss_send(NULL),
+     enzo::block_array());
+  block->contribute(has_deposits ? 3*sizeof(int) : 0, v3,
+                    CkReduction::concat, callback);
 }
 
-void EnzoBlock::p_method_feedback_starss_end() 
-{  
-  EnzoMethodFeedbackSTARSS * method = static_cast<EnzoMethodFeedbackSTARSS*> (this->method());
-  method->add_accumulate_fields(this);
+//----------------------------------------------------------------------
 
-  compute_done();
-  return;
+void EnzoBlock::r_method_feedback_starss_send(CkReductionMsg * msg)
+{
+  std::set<Index> senders;
+  const int * v3 = (const int *) msg->getData();
+  const int n = msg->getSize() / (3*sizeof(int));
+  for (int k=0; k<n; k++) {
+    Index index;
+    index.set_values(v3 + 3*k);
+    senders.insert(index);
+  }
+  delete msg;
+
+  EnzoMethodFeedbackSTARSS * method = static_cast<EnzoMethodFeedbackSTARSS*>
+    (enzo::problem()->method("feedback"));
+  method->send_deposits(this,senders);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFeedbackSTARSS::send_deposits
+(Block * block, const std::set<Index> & senders) throw()
+{
+  if (! block->is_leaf()) {
+    block->compute_done();
+    return;
+  }
+
+  State * state = state_(block);
+
+  const int rank = cello::rank();
+  const int level = block->level();
+
+  Field field = block->data()->field();
+  int n3[3];
+  field.size(n3,n3+1,n3+2);
+
+  // Only Blocks with deposits send, and they send to each leaf
+  // neighbor, with an empty message if none of their deposits are in
+  // the neighbor's cells.  So a Block expects a message from each of
+  // its leaf neighbors that has deposits
+
+  std::set<Index> neighbors;
+  ItNeighbor it_neighbor =
+    block->it_neighbor(block->index(),0,neighbor_leaf,0,0);
+  int of3[3];
+  while (it_neighbor.next(of3)) {
+    neighbors.insert(it_neighbor.index());
+  }
+  state->num_neighbors = 0;
+  for (const Index & index : neighbors) {
+    if (senders.count(index) > 0) ++state->num_neighbors;
+  }
+
+  const std::vector<int> & i3 = state->i3;
+  const std::vector<double> & values = state->values;
+
+  // Blocks without deposits send nothing
+  if (senders.count(block->index()) == 0) neighbors.clear();
+
+  const int n = i3.size() / 3;
+  for (const Index & index : neighbors) {
+
+    // neighbor's cell index range, at this Block's level
+    int lo3[3] = {0,0,0}, hi3[3] = {1,1,1};
+    const int level_neighbor = index.level();
+    int jb3[3];
+    block->index_global(index,jb3,jb3+1,jb3+2,nullptr,nullptr,nullptr);
+    for (int axis=0; axis<rank; axis++) {
+      lo3[axis] = jb3[axis]*n3[axis];
+      hi3[axis] = (jb3[axis]+1)*n3[axis];
+      if (level_neighbor < level) {
+        lo3[axis] *= 2;
+        hi3[axis] *= 2;
+      } else if (level_neighbor > level) {
+        lo3[axis] /= 2;
+        hi3[axis] /= 2;
+      }
+    }
+
+    std::vector<int> i3_send;
+    std::vector<double> values_send;
+    for (int k=0; k<n; k++) {
+      bool in = true;
+      for (int axis=0; axis<rank; axis++) {
+        const int c = i3[3*k+axis];
+        in = in && (lo3[axis] <= c) && (c < hi3[axis]);
+      }
+      if (in) {
+        i3_send.insert(i3_send.end(),&i3[3*k],&i3[3*k+3]);
+        values_send.insert(values_send.end(),
+                           &values[FEEDBACK_NUM_DEPOSITS*k],
+                           &values[FEEDBACK_NUM_DEPOSITS*(k+1)]);
+      }
+    }
+    enzo::block_array()[index].p_method_feedback_starss_recv
+      (level, i3_send.size()/3, i3_send.data(), values_send.data());
+  }
+
+  state->i3.clear();
+  state->values.clear();
+  state->sent = true;
+  try_end_(block, state);
 }
 
+//----------------------------------------------------------------------
+
+void EnzoMethodFeedbackSTARSS::recv_deposits
+(Block * block, int level, int n, int * i3, double * values) throw()
+{
+  State * state = state_(block);
+
+  const int rank = cello::rank();
+  const int level_block = block->level();
+
+  Field field = block->data()->field();
+  int n3[3], g3[3];
+  field.size(n3,n3+1,n3+2);
+  field.ghost_depth(0,g3,g3+1,g3+2);
+  const int mx = n3[0] + 2*g3[0];
+  const int my = n3[1] + 2*g3[1];
+
+  int ib3[3];
+  block->index_global(ib3,ib3+1,ib3+2,nullptr,nullptr,nullptr);
+
+  // Deposits from a finer neighbor are averaged into this Block's
+  // cells, and deposits from a coarser neighbor are copied to each of
+  // the finer cells they cover, matching restriction and prolongation
+  // in the accumulating refresh
+
+  const double weight = (level > level_block) ? 1.0 / (1 << rank) : 1.0;
+
+  for (int k=0; k<n; k++) {
+    // range of this Block's cells covered by the deposit
+    int lo3[3] = {0,0,0}, hi3[3] = {1,1,1};
+    bool in = true;
+    for (int axis=0; axis<rank; axis++) {
+      int c = i3[3*k+axis];
+      int nc = 1;
+      if (level > level_block) {
+        c /= 2;
+      } else if (level < level_block) {
+        c *= 2;
+        nc = 2;
+      }
+      lo3[axis] = std::max(c - ib3[axis]*n3[axis], 0);
+      hi3[axis] = std::min(c + nc - ib3[axis]*n3[axis], n3[axis]);
+      in = in && (lo3[axis] < hi3[axis]);
+    }
+    if (! in) continue;
+    const double * v = &values[FEEDBACK_NUM_DEPOSITS*k];
+    for (int iz=lo3[2]; iz<hi3[2]; iz++) {
+      for (int iy=lo3[1]; iy<hi3[1]; iy++) {
+        for (int ix=lo3[0]; ix<hi3[0]; ix++) {
+          const int i = INDEX(ix+g3[0],iy+g3[1],iz+g3[2],mx,my);
+          // value-initialized to zero if not present
+          std::array<double,FEEDBACK_NUM_DEPOSITS> & deposit =
+            state->deposit[i];
+          for (int m=0; m<FEEDBACK_NUM_DEPOSITS; m++) {
+            deposit[m] += weight*v[m];
+          }
+        }
+      }
+    }
+  }
+
+  ++state->count;
+  try_end_(block, state);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFeedbackSTARSS::try_end_(Block * block, State * state)
+{
+  if (state->sent && state->count == state->num_neighbors) {
+    add_accumulate_fields(enzo::block(block));
+    delete_state_(block);
+    block->compute_done();
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
 {
 
@@ -570,48 +850,20 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
   int numSN = 0; // counter of SN events
   int count = 0; // counter of particles
 
-  allocate_temporary_(enzo_block);
-
-  // initialize temporary fields as zero
-  enzo_float * d_dep  = (enzo_float *) field.values(i_d_dep);
-  enzo_float * te_dep = (enzo_float *) field.values(i_te_dep);
-  enzo_float * ge_dep = (enzo_float *) field.values(i_ge_dep);
-  enzo_float * mf_dep = (enzo_float *) field.values(i_mf_dep);
-  enzo_float * vx_dep = (enzo_float *) field.values(i_vx_dep);
-  enzo_float * vy_dep = (enzo_float *) field.values(i_vy_dep);
-  enzo_float * vz_dep = (enzo_float *) field.values(i_vz_dep);
-
-  enzo_float * d_dep_a  = (enzo_float *) field.values(i_d_dep_a);
-  enzo_float * te_dep_a = (enzo_float *) field.values(i_te_dep_a);
-  enzo_float * ge_dep_a = (enzo_float *) field.values(i_ge_dep_a);
-  enzo_float * mf_dep_a = (enzo_float *) field.values(i_mf_dep_a);
-  enzo_float * vx_dep_a = (enzo_float *) field.values(i_vx_dep_a);
-  enzo_float * vy_dep_a = (enzo_float *) field.values(i_vy_dep_a);
-  enzo_float * vz_dep_a = (enzo_float *) field.values(i_vz_dep_a);
-
-  enzo_float * d_shell   = (enzo_float *) field.values(i_d_shell);
-  enzo_float * d_shell_a = (enzo_float *) field.values(i_d_shell_a);
-
-
-  for (int i=0; i<mx*my*mz; i++){
-    d_dep [i] = 0;    
-    te_dep[i] = 0;   
-    ge_dep[i] = 0;
-    mf_dep[i] = 0;
-    vx_dep[i] = 0;
-    vy_dep[i] = 0;
-    vz_dep[i] = 0;
-    d_shell[i] = 0;
-
-    d_dep_a [i] = 0;
-    te_dep_a[i] = 0;
-    ge_dep_a[i] = 0;
-    mf_dep_a[i] = 0;
-    vx_dep_a[i] = 0;
-    vy_dep_a[i] = 0;
-    vz_dep_a[i] = 0;
-    d_shell_a[i] = 0;
-  }
+  // deposit fields are only allocated (and their ghost zones sent to
+  // neighbors) on Blocks with feedback events
+  bool deposited = false;
+  auto allocate_deposits = [&]() {
+    if (deposited) return;
+    deposited = true;
+    allocate_temporary_(enzo_block);
+    const int ind[] = {i_d_dep, i_te_dep, i_ge_dep, i_mf_dep,
+                       i_vx_dep, i_vy_dep, i_vz_dep, i_d_shell};
+    for (int index_field : ind) {
+      enzo_float * values = (enzo_float *) field.values(index_field);
+      std::fill_n(values, mx*my*mz, 0.0);
+    }
+  };
 
   double cell_volume = hx*hy*hz;
 
@@ -637,6 +889,14 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
   const int dsn = particle.stride(it, ia_sn);
   const int dlum = particle.stride(it, ia_lum);
 
+  // random numbers depend only on the Block, cycle, and star
+  int index3[3];
+  block->index().values(index3);
+  const Philox random_snii (random_stream_feedback_starss_snii,
+                            block->cycle(), index3);
+  const Philox random_snia (random_stream_feedback_starss_snia,
+                            block->cycle(), index3);
+
   const int nb = particle.num_batches(it);
 
   for (int ib=0; ib<nb; ib++){
@@ -694,8 +954,13 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
 
           /* Determine number of SN events from rates (currently taken from Hopkins 2018) */
 
+          const uint32_t i_random =
+            star_random_counter_(index, pcreation[ipdc]);
+
           determineSN(age, &nSNII, &nSNIa, pmass_solar,
-                      tunit, block->dt());
+                      tunit, block->dt(),
+                      random_snii.uniform(i_random),
+                      random_snia.uniform(i_random));
 
           numSN += nSNII + nSNIa;
 
@@ -716,6 +981,7 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
 
             /* Fixed mass ejecta */
 
+            allocate_deposits();
             this->deposit_feedback( block, energySN, SNMassEjected, SNMetalEjected,
                                     pvx[ipdv],pvy[ipdv],pvz[ipdv],
                                     px[ipdp],py[ipdp],pz[ipdp],
@@ -741,6 +1007,7 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
             #ifdef DEBUG_FEEDBACK_STARSS
               CkPrintf("STARSS_FB: Adding stellar winds...\n");
             #endif
+            allocate_deposits();
             this->deposit_feedback( block, windEnergy, windMass, windMetals,
                                     pvx[ipdv],pvy[ipdv],pvz[ipdv],
                                     px[ipdp],py[ipdp],pz[ipdp],
@@ -780,10 +1047,14 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
               count, numSN, 0.00);
   }
 
-  // refresh
-  cello::refresh(ir_feedback_)->set_active(enzo_block->is_leaf());
-  enzo_block->refresh_start(ir_feedback_, CkIndex_EnzoBlock::p_method_feedback_starss_end());
-  return;
+  // collect ghost zone deposits, and agree with all Blocks on which
+  // ones send deposits to their neighbors
+  State * state = state_(block);
+  if (deposited) {
+    collect_deposits_(block, state);
+    deallocate_temporary_(enzo_block);
+  }
+  contribute_deposits_(block, ! state->i3.empty());
 }
 
 
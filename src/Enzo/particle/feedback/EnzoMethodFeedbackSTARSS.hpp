@@ -32,7 +32,7 @@ public:
   /// Charm++ Pup::able migration Constructor
   EnzoMethodFeedbackSTARSS (CkMigrateMessage *m)
    : Method (m)
-   , ir_feedback_(-1)
+   , is_state_(-1)
    {  }
 
    /// Charm++ Pack / Unpack function
@@ -50,8 +50,11 @@ public:
    // Compute the maximum timestep for this method
    virtual double timestep (Block * block) throw();
 
+   /// Determine the number of supernovae from the star's rates and the
+   /// uniform random numbers random_II and random_IA in [0,1)
    int determineSN (double age_Myr, int * nSNII, int * nSNIA,
-                    double mass_Msun, double tunit, float dt);
+                    double mass_Msun, double tunit, float dt,
+                    double random_II, double random_IA);
    
    int determineWinds(double age_Myr, double * eWinds, double * mWinds, double * zWinds,
                       double mass_Msun, double metallicity_Zsun, double tunit, double dt); 
@@ -70,12 +73,45 @@ public:
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
                                   const int mx, const int my, const int mz, int direction) const throw();
 
+   /// Send the ghost zone deposits to the leaf neighbors containing
+   /// them if this Block is in senders, the Blocks that have deposits
+   /// to send, and end the method on non-leaf Blocks
+   void send_deposits (Block * block,
+                       const std::set<Index> & senders) throw();
+
+   /// Receive deposits into this Block's cells from a neighbor's
+   /// ghost zones, as global cell indices at the neighbor's level and
+   /// eight deposit values per cell
+   void recv_deposits (Block * block, int level,
+                       int n, int * i3, double * values) throw();
+
+   /// Apply the deposits received from neighbors to the fields
    void add_accumulate_fields(EnzoBlock * enzo_block) throw();
 
    // window function for calculating CiC fractions. May make more sense to put this in Cello somewhere
    double Window(double xd, double yd, double zd, double width) const throw();
 
 protected: // methods
+
+   struct State;
+
+   /// Return the Block's state, creating it if needed
+   State * state_(Block * block);
+
+   /// Delete the Block's state
+   void delete_state_(Block * block);
+
+   /// Collect the nonzero ghost zone deposits to send to neighbors
+   void collect_deposits_(Block * block, State * state);
+
+   /// Contribute to the reduction of the Blocks that have deposits to
+   /// send, which calls send_deposits() on every Block
+   void contribute_deposits_(Block * block, bool has_deposits);
+
+   /// Apply the deposits and end the method if all neighbor messages
+   /// have arrived
+   void try_end_(Block * block, State * state);
+
    void allocate_temporary_(EnzoBlock * enzo_block)
    {
      Field field = enzo_block->data()->field();
@@ -87,15 +123,6 @@ protected: // methods
      field.allocate_temporary(i_vy_dep);
      field.allocate_temporary(i_vz_dep);
      field.allocate_temporary(i_d_shell);
-
-     field.allocate_temporary(i_d_dep_a);
-     field.allocate_temporary(i_te_dep_a);
-     field.allocate_temporary(i_ge_dep_a);
-     field.allocate_temporary(i_mf_dep_a);
-     field.allocate_temporary(i_vx_dep_a);
-     field.allocate_temporary(i_vy_dep_a);
-     field.allocate_temporary(i_vz_dep_a);
-     field.allocate_temporary(i_d_shell_a);
    }
 
    void deallocate_temporary_(EnzoBlock * enzo_block)
@@ -109,15 +136,6 @@ protected: // methods
      field.deallocate_temporary(i_vy_dep);
      field.deallocate_temporary(i_vz_dep);
      field.deallocate_temporary(i_d_shell);
-
-     field.deallocate_temporary(i_d_dep_a);
-     field.deallocate_temporary(i_te_dep_a);
-     field.deallocate_temporary(i_ge_dep_a);
-     field.deallocate_temporary(i_mf_dep_a);
-     field.deallocate_temporary(i_vx_dep_a);
-     field.deallocate_temporary(i_vy_dep_a);
-     field.deallocate_temporary(i_vz_dep_a);
-     field.deallocate_temporary(i_d_shell_a);
    }
 
 protected:
@@ -136,19 +154,19 @@ protected:
 
 
   // internal fields
-  
-  // Refresh ID
-  int ir_feedback_;
-
-  // deposit field id's
-  int i_d_dep , i_d_dep_a;
-  int i_te_dep, i_te_dep_a;
-  int i_ge_dep, i_ge_dep_a;
-  int i_mf_dep, i_mf_dep_a;
-  int i_vx_dep, i_vx_dep_a;
-  int i_vy_dep, i_vy_dep_a;
-  int i_vz_dep, i_vz_dep_a;
-  int i_d_shell, i_d_shell_a;
+
+  // Index of the Block's State void pointer scalar
+  int is_state_;
+
+  // deposit field id's (only allocated on Blocks with feedback events)
+  int i_d_dep;
+  int i_te_dep;
+  int i_ge_dep;
+  int i_mf_dep;
+  int i_vx_dep;
+  int i_vy_dep;
+  int i_vz_dep;
+  int i_d_shell;
 
 };
 
@@ -14,8 +14,6 @@
 #include "Enzo/enzo.hpp"
 #include "Enzo/particle/particle.hpp"
 
-#include <time.h>
-
 // #define DEBUG_SF_CRITERIA
 // #define DEBUG_STORE_INITIAL_PROPERTIES
 //-------------------------------------------------------------------
@@ -54,8 +52,6 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
   // Loop through the grid and check star formation criteria
   // stochastically form stars if zone meets these criteria
 
-  // TODO: Make random seed an input parameter
-  std::mt19937 mt(std::time(nullptr));
   int count = 0;
 
   const EnzoConfig * enzo_config = enzo::config();
@@ -95,6 +91,12 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
   double lx, ly, lz;
   block->lower(&lx,&ly,&lz);
 
+  // random numbers depend only on the Block, cycle, and cell
+  int index3[3];
+  block->index().values(index3);
+  const Philox random_draw (random_stream_star_maker_starss,
+                            block->cycle(), index3);
+
   // declare particle position arrays
   const int it   = particle.type_index (this->particle_type());
 
@@ -374,7 +376,7 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
 
         if (this->turn_off_probability_) p_form = 1.0;
 
-        double random = double(mt()) / double(mt.max()); 
+        double random = random_draw.uniform(i);
 
         /* New star is mass_should_form up to f_shield*maximum_star_fraction_ * baryon mass of the cell,
            but at least 15 msun */       
@@ -12,8 +12,6 @@
 #include "Enzo/enzo.hpp"
 #include "Enzo/particle/particle.hpp"
 
-#include <time.h>
-
 // #define DEBUG_SF
 
 
@@ -23,8 +21,6 @@ EnzoMethodStarMakerStochasticSF::EnzoMethodStarMakerStochasticSF
 (ParameterGroup p)
   : EnzoMethodStarMaker(p)
 {
-  // To Do: Make the seed an input parameter
-  srand(time(NULL)); // need randum number generator for later
   return;
 }
 
@@ -151,6 +147,12 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
 
   compute_temperature.compute(enzo_block);
 
+  // random numbers depend only on the Block, cycle, and cell
+  int index3[3];
+  block->index().values(index3);
+  const Philox random (random_stream_star_maker_stochastic_sf,
+                       block->cycle(), index3);
+
   // iterate over all cells (not including ghost zones)
   //
   //   To Do: Allow for multi-zone star formation by adding mass in
@@ -215,7 +217,7 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
         // use a random number draw to generate the particle
         if ( star_fraction * mass < this->star_particle_min_mass_){
           // get a random number
-          double rnum = (double(rand())) / (double(RAND_MAX));
+          double rnum = random.uniform(i);
           double probability = this->efficiency_ * mass / this->star_particle_min_mass_;
           if (rnum > probability){
               continue; // do not form stars
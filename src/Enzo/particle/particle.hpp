@@ -26,10 +26,25 @@
 
 #include "Enzo/enzo.hpp" // enzo_float, EnzoBlock
 
+//----------------------------------------------------------------------
+// Random number streams
+//----------------------------------------------------------------------
+
+/// Stream ids of the Philox random numbers drawn by particle Methods, so
+/// that different Methods (or draws within a Method) are independent
+enum random_stream_enum {
+  random_stream_star_maker_stochastic_sf,
+  random_stream_star_maker_starss,
+  random_stream_feedback_starss_snii,
+  random_stream_feedback_starss_snia,
+  random_stream_feedback_distributed
+};
+
 //----------------------------------------------------------------------
 // Component headers
 //----------------------------------------------------------------------
 
+#include "particle/EnzoMethodFof.hpp"
 #include "particle/EnzoMethodPmUpdate.hpp"
 
 // [order dependencies:]
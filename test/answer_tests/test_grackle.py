@@ -28,6 +28,29 @@ def _get_decimals(field_name):
     else:
         return 6
 
+def _summary_statistics(block_list):
+    # computes a variety of summary statistics of each field
+    ds = yt.load(block_list)
+    ad = ds.all_data()
+
+    quan_entry_sets = [
+        ('min_location', ('min', 'min_xloc', 'min_yloc', 'min_zloc'), {}),
+        ('max_location', ('max', 'max_xloc', 'max_yloc', 'max_zloc'), {}),
+        ('weighted_standard_deviation',
+         ('std_dev', 'mean'), {'weight' : ("gas", "cell_volume")}),
+    ]
+
+    data = {}
+    for field in ds.field_list:
+        for derived_quantity, rslt_names, kwargs in quan_entry_sets:
+            quan_func = getattr(ad.quantities,derived_quantity)
+            rslts = quan_func(field, **kwargs)
+            num_rslts = len(rslts)
+            assert num_rslts == len(rslt_names)
+            for i in range(num_rslts):
+                data[f'{field[1]}:{rslt_names[i]}'] = rslts[i]
+    return data
+
 @uses_grackle
 class TestGrackleGeneral(EnzoETest):
     parameter_file = "Grackle/method_grackle_general.in"
@@ -48,26 +71,25 @@ class TestGrackleGeneral(EnzoETest):
 
         This was adapted from an earlier test.
         """
-        ds = yt.load("GeneralGrackle-500.00/GeneralGrackle-500.00.block_list")
-        ad = ds.all_data()
-
-        quan_entry_sets = [
-            ('min_location', ('min', 'min_xloc', 'min_yloc', 'min_zloc'), {}),
-            ('max_location', ('max', 'max_xloc', 'max_yloc', 'max_zloc'), {}),
-            ('weighted_standard_deviation',
-             ('std_dev', 'mean'), {'weight' : ("gas", "cell_volume")}),
-        ]
-
-        data = {}
-        for field in ds.field_list:
-            for derived_quantity, rslt_names, kwargs in quan_entry_sets:
-                quan_func = getattr(ad.quantities,derived_quantity)
-                rslts = quan_func(field, **kwargs)
-                num_rslts = len(rslts)
-                assert num_rslts == len(rslt_names)
-                for i in range(num_rslts):
-                    data[f'{field[1]}:{rslt_names[i]}'] = rslts[i]
-        return data
+        return _summary_statistics(
+            "GeneralGrackle-500.00/GeneralGrackle-500.00.block_list")
+
+@uses_grackle
+class TestGrackleBatch(EnzoETest):
+    parameter_file = "Grackle/method_grackle_batch.in"
+    max_runtime = 240
+    ncpus = 1
+
+    # sharing the name of TestGrackleGeneral.test_grackle_general means the
+    # results are compared against the same file
+    @ytdataset_test(assert_array_rel_equal, decimals = _get_decimals)
+    def test_grackle_general(self):
+        """
+        Checks that solving the chemistry of all blocks on a PE in a single
+        batch gives the same summary statistics as TestGrackleGeneral.
+        """
+        return _summary_statistics(
+            "BatchGrackle-500.00/BatchGrackle-500.00.block_list")
 
 @uses_grackle
 class TestGrackleCoolingDt(EnzoETest):